@@ -0,0 +1,359 @@
+"""
+Benchmark suite for the hot paths of the driver.
+
+It runs against a live CUBRID server (the demodb DSN of tests/conftest.py by
+default) and measures:
+
+- oltp: latency of a single-row primary key select
+- fetchall[<type>]: fetchall() of the whole table, one column type at a time
+- fetch_cursor[<kind>]: fetchall() with tuple, dict and Row cursors
+- executemany: batched inserts
+- lob_import / lob_export: BLOB transfers
+- threads[<n>]: single-row selects from n threads, one connection each
+
+Every benchmark is repeated and the timings are written as JSON, together
+with the Python, platform and driver versions. Passing the JSON file of a
+previous run with --compare reports the benchmarks whose median time got
+worse by more than --threshold, and exits with status 1 if there are any.
+
+Example:
+    python benchmarks/bench_driver.py --rows 100000 -o before.json
+    python setup.py build_ext --inplace
+    python benchmarks/bench_driver.py --rows 100000 -o after.json --compare before.json
+"""
+import argparse
+import datetime
+import decimal
+import json
+import os
+import platform
+import statistics
+import sys
+import threading
+import time
+
+import _cubrid
+import cubrid_db
+
+
+DEFAULT_DSN = 'CUBRID:localhost:33000:demodb:::'
+
+TABLE = 'bench_driver'
+LOB_TABLE = 'bench_driver_lob'
+
+# name -> (column definition, value for row i)
+COLUMNS = {
+    'int': ('c_int int', lambda i: i),
+    'bigint': ('c_bigint bigint', lambda i: i * 1000003),
+    'double': ('c_double double', lambda i: i / 7.0),
+    'numeric': ('c_numeric numeric(15,2)', lambda i: decimal.Decimal(i) / 4),
+    'varchar': ('c_varchar varchar(64)', lambda i: f'row {i:010d} of the benchmark'),
+    'datetime': ('c_datetime datetime',
+                 lambda i: datetime.datetime(2000, 1, 1) + datetime.timedelta(seconds=i)),
+    'varbit': ('c_varbit bit varying(256)', lambda i: i.to_bytes(8, 'big') * 4),
+}
+
+INSERT_BATCH = 10000
+
+
+def _stats(samples):
+    return {
+        'min': min(samples),
+        'median': statistics.median(samples),
+        'mean': statistics.mean(samples),
+        'max': max(samples),
+    }
+
+
+class Runner:
+    """Runs the benchmarks and collects their results."""
+
+    def __init__(self, args):
+        self.args = args
+        self.results = []
+        self.conn = cubrid_db.connect(dsn=args.dsn, user=args.user,
+                                      password=args.password)
+
+    def connect(self):
+        """Open another connection with the same arguments."""
+        return cubrid_db.connect(dsn=self.args.dsn, user=self.args.user,
+                                 password=self.args.password)
+
+    def record(self, name, samples, work, unit):
+        """
+        Record a benchmark. samples are the durations in seconds of the
+        repetitions, each of which processed work units (rows, bytes...)
+        """
+        stats = _stats(samples)
+        result = {
+            'name': name,
+            'samples': samples,
+            'work': work,
+            'unit': unit,
+            'throughput': work / stats['median'] if stats['median'] else None,
+        }
+        result.update(stats)
+        self.results.append(result)
+        print(f'{name:<24} median {stats["median"] * 1e3:10.3f} ms'
+              f'  {result["throughput"] or 0:14.1f} {unit}/s', file=sys.stderr)
+
+    def measure(self, func, repeat=None):
+        """Call func() repeat times and return the durations."""
+        samples = []
+        for _ in range(repeat or self.args.repeat):
+            start = time.perf_counter()
+            func()
+            samples.append(time.perf_counter() - start)
+        return samples
+
+    def setup(self):
+        """Create and fill the benchmark table."""
+        cur = self.conn.cursor()
+        cur.executemany_array = True
+        columns = ', '.join(definition for definition, _ in COLUMNS.values())
+        cur.execute(f'drop table if exists {TABLE}')
+        cur.execute(f'create table {TABLE} (id int primary key, {columns})')
+        sql = f'insert into {TABLE} values ({", ".join("?" * (len(COLUMNS) + 1))})'
+        for first in range(0, self.args.rows, INSERT_BATCH):
+            last = min(first + INSERT_BATCH, self.args.rows)
+            cur.executemany(sql, [[i] + [value(i) for _, value in COLUMNS.values()]
+                                  for i in range(first, last)])
+        self.conn.commit()
+        cur.close()
+
+    def teardown(self):
+        """Drop the benchmark tables and close the connection."""
+        cur = self.conn.cursor()
+        cur.execute(f'drop table if exists {TABLE}')
+        cur.execute(f'drop table if exists {LOB_TABLE}')
+        self.conn.commit()
+        cur.close()
+        self.conn.close()
+
+    def bench_oltp(self):
+        """Latency of single-row primary key selects."""
+        cur = self.conn.cursor()
+        sql = f'select id, c_varchar from {TABLE} where id = ?'
+        count = self.args.rows
+        keys = iter(range(sys.maxsize))
+
+        def query():
+            cur.execute(sql, (next(keys) % count,))
+            cur.fetchone()
+
+        query()
+        self.record('oltp', self.measure(query, self.args.oltp_iterations), 1, 'queries')
+        cur.close()
+
+    def bench_fetchall(self):
+        """fetchall() of every row, one column type at a time."""
+        cur = self.conn.cursor()
+        for name, (definition, _) in COLUMNS.items():
+            sql = f'select {definition.split()[0]} from {TABLE}'
+
+            def fetch(sql=sql):
+                cur.execute(sql)
+                cur.fetchall()
+
+            self.record(f'fetchall[{name}]', self.measure(fetch), self.args.rows, 'rows')
+        cur.close()
+
+    def bench_cursor_kinds(self):
+        """fetchall() of a few columns with each kind of cursor."""
+        sql = f'select id, c_int, c_double, c_varchar from {TABLE}'
+        for name, kwargs in (('tuple', {}), ('dict', {'dict_cursor': True}),
+                             ('row', {'row_cursor': True})):
+            cur = self.conn.cursor(**kwargs)
+
+            def fetch(cur=cur):
+                cur.execute(sql)
+                cur.fetchall()
+
+            self.record(f'fetch_cursor[{name}]', self.measure(fetch), self.args.rows, 'rows')
+            cur.close()
+
+    def bench_executemany(self):
+        """Batched inserts into an empty copy of the table."""
+        cur = self.conn.cursor()
+        cur.executemany_array = True
+        rows = [[i] + [value(i) for _, value in COLUMNS.values()]
+                for i in range(self.args.batch)]
+        sql = f'insert into {TABLE}_copy values ({", ".join("?" * (len(COLUMNS) + 1))})'
+        cur.execute(f'drop table if exists {TABLE}_copy')
+        cur.execute(f'create table {TABLE}_copy like {TABLE}')
+
+        def insert():
+            cur.execute(f'delete from {TABLE}_copy')
+            cur.executemany(sql, rows)
+            self.conn.commit()
+
+        self.record('executemany', self.measure(insert), self.args.batch, 'rows')
+        cur.execute(f'drop table if exists {TABLE}_copy')
+        cur.close()
+
+    def bench_lob(self):
+        """Import a BLOB from memory and export it back."""
+        con = self.conn.connection
+        data = os.urandom(self.args.lob_size)
+        out = bytearray(len(data))
+        cur = con.cursor()
+        cur.prepare(f'drop table if exists {LOB_TABLE}')
+        cur.execute()
+        cur.prepare(f'create table {LOB_TABLE} (data blob)')
+        cur.execute()
+
+        def store():
+            lob = con.lob()
+            lob.imports(data)
+            cur.prepare(f'insert into {LOB_TABLE} values (?)')
+            cur.bind_lob(1, lob)
+            cur.execute()
+            lob.close()
+
+        def load():
+            cur.prepare(f'select data from {LOB_TABLE} limit 1')
+            cur.execute()
+            lob = con.lob()
+            cur.fetch_lob(1, lob)
+            lob.export(out)
+            lob.close()
+
+        self.record('lob_import', self.measure(store), len(data), 'bytes')
+        self.record('lob_export', self.measure(load), len(data), 'bytes')
+        cur.close()
+
+    def bench_threads(self):
+        """Single-row selects from several threads, one connection each."""
+        sql = f'select id, c_varchar from {TABLE} where id = ?'
+        count = self.args.rows
+        per_thread = self.args.oltp_iterations
+
+        def worker(conn, barrier, errors):
+            cur = conn.cursor()
+            try:
+                barrier.wait()
+                for i in range(per_thread):
+                    cur.execute(sql, (i % count,))
+                    cur.fetchone()
+            except cubrid_db.Error as e:
+                errors.append(e)
+            finally:
+                cur.close()
+
+        for nthreads in self.args.threads:
+            conns = [self.connect() for _ in range(nthreads)]
+            errors = []
+
+            def run(conns=conns, errors=errors):
+                barrier = threading.Barrier(len(conns))
+                threads = [threading.Thread(target=worker, args=(conn, barrier, errors))
+                           for conn in conns]
+                for t in threads:
+                    t.start()
+                for t in threads:
+                    t.join()
+
+            samples = self.measure(run)
+            for conn in conns:
+                conn.close()
+            if errors:
+                raise errors[0]
+            self.record(f'threads[{nthreads}]', samples, nthreads * per_thread, 'queries')
+
+
+BENCHMARKS = {
+    'oltp': Runner.bench_oltp,
+    'fetchall': Runner.bench_fetchall,
+    'cursors': Runner.bench_cursor_kinds,
+    'executemany': Runner.bench_executemany,
+    'lob': Runner.bench_lob,
+    'threads': Runner.bench_threads,
+}
+
+
+def compare(results, baseline, threshold):
+    """
+    Print the change of the median time of each benchmark against the
+    baseline results, and return the names of the ones that regressed.
+    """
+    previous = {result['name']: result for result in baseline['results']}
+    regressions = []
+    for result in results:
+        old = previous.get(result['name'])
+        if old is None or old['work'] != result['work']:
+            continue
+        change = result['median'] / old['median'] - 1
+        flag = ''
+        if change > threshold:
+            regressions.append(result['name'])
+            flag = '  REGRESSION'
+        print(f'{result["name"]:<24} {change * 100:+8.1f}%{flag}', file=sys.stderr)
+    return regressions
+
+
+def parse_args(argv=None):
+    """Parse the command line."""
+    parser = argparse.ArgumentParser(description=__doc__.split('\n\n', maxsplit=1)[0])
+    parser.add_argument('--dsn', default=DEFAULT_DSN)
+    parser.add_argument('--user', default='public')
+    parser.add_argument('--password', default='')
+    parser.add_argument('--rows', type=int, default=1000000,
+                        help='rows in the benchmark table (default: %(default)s)')
+    parser.add_argument('--batch', type=int, default=10000,
+                        help='rows inserted per executemany() (default: %(default)s)')
+    parser.add_argument('--lob-size', type=int, default=16 * 1024 * 1024,
+                        help='BLOB size in bytes (default: %(default)s)')
+    parser.add_argument('--oltp-iterations', type=int, default=2000,
+                        help='single-row queries per sample (default: %(default)s)')
+    parser.add_argument('--threads', type=int, nargs='+', default=[1, 2, 4, 8],
+                        help='thread counts of the concurrency benchmark')
+    parser.add_argument('--repeat', type=int, default=5,
+                        help='repetitions of each benchmark (default: %(default)s)')
+    parser.add_argument('--only', nargs='+', choices=sorted(BENCHMARKS),
+                        help='run only these benchmarks')
+    parser.add_argument('-o', '--output', help='JSON output file (default: stdout)')
+    parser.add_argument('--compare', metavar='BASELINE',
+                        help='JSON output of a previous run to compare against')
+    parser.add_argument('--threshold', type=float, default=0.10,
+                        help='relative slowdown reported as a regression (default: %(default)s)')
+    return parser.parse_args(argv)
+
+
+def main(argv=None):
+    """Run the benchmarks, write the results, and compare them if asked."""
+    args = parse_args(argv)
+    runner = Runner(args)
+    try:
+        runner.setup()
+        for name, bench in BENCHMARKS.items():
+            if args.only is None or name in args.only:
+                bench(runner)
+    finally:
+        runner.teardown()
+
+    report = {
+        'created': datetime.datetime.now(datetime.timezone.utc).isoformat(),
+        'python': sys.version,
+        'platform': platform.platform(),
+        'driver': _cubrid.__version__,
+        'parameters': {key: value for key, value in vars(args).items()
+                       if key not in ('password', 'output', 'compare')},
+        'results': runner.results,
+    }
+    if args.output:
+        with open(args.output, 'w', encoding='utf-8') as f:
+            json.dump(report, f, indent=2)
+    else:
+        json.dump(report, sys.stdout, indent=2)
+        print()
+
+    if args.compare:
+        with open(args.compare, 'r', encoding='utf-8') as f:
+            baseline = json.load(f)
+        if compare(runner.results, baseline, args.threshold):
+            return 1
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,55 @@
+#!/bin/bash
+#
+# Collect the profile of a PGO build of the extension: build it (and CCI)
+# instrumented, run the benchmarks on it, then remove the instrumented
+# build. A following build with CUBRID_DB_OPTIMIZE=pgo-use, e.g. pip wheel,
+# is then optimized with the profile.
+#
+# The benchmarks need a live server: CUBRID_DB_PGO_DSN is its DSN. When it
+# is not set, no profile is collected and pgo-use builds are LTO builds.
+# The script waits up to CUBRID_DB_PGO_WAIT seconds (default 300) for the
+# server to accept connections, e.g. a service container still starting.
+#
+# The profile is matched to the object files by path, so it must be used
+# from the same source directory, with the same Python.
+#
+set -e
+
+cd "$(dirname "$0")/.."
+
+if [ -z "$CUBRID_DB_PGO_DSN" ]; then
+    echo "CUBRID_DB_PGO_DSN is not set, no PGO profile collected"
+    exit 0
+fi
+
+PYTHON=${PYTHON:-python}
+export CUBRID_DB_PROFILE_DIR=${CUBRID_DB_PROFILE_DIR:-$PWD/build/pgo}
+
+rm -rf "$CUBRID_DB_PROFILE_DIR"
+CUBRID_DB_OPTIMIZE=pgo-generate "$PYTHON" setup.py build_ext --inplace --force
+
+# Wait for the server
+PYTHONPATH=$PWD "$PYTHON" - "$CUBRID_DB_PGO_DSN" "${CUBRID_DB_PGO_WAIT:-300}" <<'EOF'
+import sys
+import time
+
+import cubrid_db
+
+dsn, deadline = sys.argv[1], time.monotonic() + float(sys.argv[2])
+while True:
+    try:
+        cubrid_db.connect(dsn=dsn, user='public', password='').close()
+        break
+    except cubrid_db.Error as e:
+        if time.monotonic() > deadline:
+            sys.exit(f'The server of {dsn} is not available: {e}')
+        time.sleep(5)
+EOF
+
+# A short run of every benchmark: the profile needs the code paths, not
+# stable timings
+PYTHONPATH=$PWD "$PYTHON" benchmarks/bench_driver.py --dsn "$CUBRID_DB_PGO_DSN" \
+    --rows 50000 --batch 5000 --lob-size 1048576 --oltp-iterations 1000 \
+    --threads 1 4 --repeat 2 -o "$CUBRID_DB_PROFILE_DIR/train.json"
+
+rm -rf _cubrid*.so build/lib.* build/temp.*
@@ -60,7 +60,9 @@ class DBAPISet(frozenset):
 STRING = DBAPISet([field_type.CHAR, field_type.STRING, field_type.NCHAR, field_type.VARCHAR])
 BINARY = DBAPISet([field_type.BIT, field_type.VARBIT])
 NUMBER = DBAPISet([field_type.NUMERIC, field_type.INT, field_type.SMALLINT, field_type.BIGINT])
-DATETIME = DBAPISet([field_type.DATE, field_type.TIME, field_type.TIMESTAMP])
+DATETIME = DBAPISet([field_type.DATE, field_type.TIME, field_type.TIMESTAMP,
+                     field_type.DATETIME, field_type.TIMESTAMPTZ, field_type.TIMESTAMPLTZ,
+                     field_type.DATETIMETZ, field_type.DATETIMELTZ])
 FLOAT = DBAPISet([field_type.FLOAT, field_type.DOUBLE])
 SET = DBAPISet([field_type.SET, field_type.MULTISET, field_type.SEQUENCE])
 BLOB = DBAPISet([field_type.BLOB])
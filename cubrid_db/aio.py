@@ -0,0 +1,282 @@
+"""
+Module: aio.py
+
+This module provides an asyncio interface on top of cubrid_db. CCI calls are
+blocking, so each call runs on a bounded thread pool executor; the extension
+releases the GIL while it waits on the server, so the event loop keeps running
+and concurrent requests scale with the number of connections.
+
+Calls on one connection are serialized with an asyncio lock, since CCI does
+not allow concurrent requests on a connection. Waiting coroutines therefore
+do not hold an executor thread.
+
+Cancelling a task that waits on a statement, e.g. with asyncio.wait_for(),
+cancels the statement on the server too, so that it does not keep running
+and holding the connection.
+
+Example:
+    import asyncio
+    from cubrid_db import aio
+
+    async def main():
+        con = await aio.connect(dsn='CUBRID:localhost:33000:demodb:::')
+        async with con.cursor() as cur:
+            await cur.execute('select * from db_class')
+            async for row in cur:
+                print(row)
+        await con.close()
+
+    asyncio.run(main())
+"""
+import asyncio
+import functools
+import threading
+from collections import deque
+from concurrent.futures import Future, ThreadPoolExecutor
+
+from .connections import Connection
+from .exceptions import Error
+
+
+DEFAULT_MAX_WORKERS = 16
+
+_default_executor = None
+
+
+def get_default_executor():
+    """
+    Return the executor shared by the connections opened without one,
+    creating it with DEFAULT_MAX_WORKERS threads on first use.
+    """
+    global _default_executor  # pylint: disable=global-statement
+    if _default_executor is None:
+        _default_executor = ThreadPoolExecutor(
+            max_workers=DEFAULT_MAX_WORKERS, thread_name_prefix='cubrid_db.aio')
+    return _default_executor
+
+
+def _cancel_on_thread(conn):
+    """
+    Call conn.cancel() on a thread of its own rather than on the executor,
+    whose threads may all be busy with the very calls to cancel. Returns
+    a concurrent.futures.Future of its completion.
+    """
+    future = Future()
+
+    def cancel():
+        try:
+            conn.cancel()
+        except Error as e:
+            future.set_exception(e)
+        else:
+            future.set_result(None)
+
+    threading.Thread(target=cancel, name='cubrid_db.aio.cancel', daemon=True).start()
+    return future
+
+
+class AsyncConnection:
+    """
+    An asyncio wrapper around a cubrid_db Connection. Use connect() to
+    create one.
+    """
+
+    def __init__(self, conn, executor):
+        self._conn = conn
+        self._executor = executor
+        self._lock = asyncio.Lock()
+
+    @property
+    def connection(self):
+        """The wrapped cubrid_db Connection."""
+        return self._conn
+
+    async def run(self, func, *args):
+        """
+        Run a blocking call on the executor and return its result. Calls
+        made through the same connection run one at a time.
+        """
+        await self._lock.acquire()
+        release = True
+        try:
+            call = self._executor.submit(functools.partial(func, *args))
+            try:
+                return await asyncio.wrap_future(call)
+            except asyncio.CancelledError:
+                # The awaited future is cancelled, not the running call
+                if not call.done():
+                    # Keep the lock until the call and its cancel are over:
+                    # a late cancel must not hit the next statement
+                    release = False
+                    done = asyncio.gather(asyncio.wrap_future(call),
+                                          asyncio.wrap_future(_cancel_on_thread(self._conn)),
+                                          return_exceptions=True)
+                    done.add_done_callback(lambda _: self._lock.release())
+                raise
+        finally:
+            if release:
+                self._lock.release()
+
+    async def cancel(self):
+        """
+        Cancel the statement running on the connection, see
+        Connection.cancel(). It does not wait for the running call.
+        """
+        await asyncio.wrap_future(_cancel_on_thread(self._conn))
+
+    def cursor(self, dict_cursor=False, row_cursor=False, stream=False):
+        """Return a new AsyncCursor using the connection."""
+        return AsyncCursor(self, self._conn.cursor(dict_cursor, row_cursor, stream))
+
+    @property
+    def autocommit(self):
+        """autocommit value for current Cubrid session"""
+        return self._conn.autocommit
+
+    async def set_autocommit(self, value):
+        """Set the autocommit attribute of the connection."""
+        await self.run(self._conn.set_autocommit, value)
+
+    async def commit(self):
+        """Commit any pending transaction to the database."""
+        await self.run(self._conn.commit)
+
+    async def rollback(self):
+        """Roll back to the start of any pending transaction."""
+        await self.run(self._conn.rollback)
+
+    async def ping(self):
+        """Check whether or not the connection to the server is working."""
+        return await self.run(self._conn.ping)
+
+    async def close(self):
+        """Close the connection now."""
+        await self.run(self._conn.close)
+
+    async def __aenter__(self):
+        return self
+
+    async def __aexit__(self, exc_type, exc_value, traceback):
+        await self.close()
+
+
+class AsyncCursor:
+    """
+    An asyncio wrapper around a cubrid_db cursor. The fetch methods and
+    async iteration return the same rows as the wrapped cursor.
+
+    iter_batch_size::
+        number of rows async iteration fetches per executor call
+    """
+
+    def __init__(self, conn, cursor):
+        self._conn = conn
+        self._cursor = cursor
+        self._rows = deque()
+        self.iter_batch_size = 100
+
+    @property
+    def description(self):
+        """The description of the last executed query, see PEP-249."""
+        return self._cursor.description
+
+    @property
+    def rowcount(self):
+        """The row count of the last executed query, see PEP-249."""
+        return self._cursor.rowcount
+
+    @property
+    def arraysize(self):
+        """Default number of rows fetchmany() will fetch."""
+        return self._cursor.arraysize
+
+    @arraysize.setter
+    def arraysize(self, value):
+        self._cursor.arraysize = value
+
+    def _take(self, size):
+        """Return up to size rows left over from async iteration."""
+        return [self._rows.popleft() for _ in range(min(size, len(self._rows)))]
+
+    @property
+    def query_timeout(self):
+        """Execution timeout of the statements, see Cursor.query_timeout."""
+        return self._cursor.query_timeout
+
+    @query_timeout.setter
+    def query_timeout(self, value):
+        self._cursor.query_timeout = value
+
+    async def cancel(self):
+        """Cancel the statement the cursor is executing."""
+        await self._conn.cancel()
+
+    async def execute(self, query, args=None):
+        """Execute a query, see Cursor.execute()."""
+        self._rows.clear()
+        return await self._conn.run(self._cursor.execute, query, args)
+
+    async def executemany(self, query, args_list):
+        """Execute a multi-row query, see Cursor.executemany()."""
+        self._rows.clear()
+        return await self._conn.run(self._cursor.executemany, query, args_list)
+
+    async def fetchone(self):
+        """Fetch the next row, or None when no more data is available."""
+        if self._rows:
+            return self._rows.popleft()
+        return await self._conn.run(self._cursor.fetchone)
+
+    async def fetchmany(self, size=None):
+        """Fetch the next set of rows, see Cursor.fetchmany()."""
+        if size is None:
+            size = self._cursor.arraysize
+        rows = self._take(size)
+        if len(rows) < size:
+            rows += await self._conn.run(self._cursor.fetchmany, size - len(rows))
+        return rows
+
+    async def fetchall(self):
+        """Fetch all (remaining) rows of a query result."""
+        rows = self._take(len(self._rows))
+        return rows + await self._conn.run(self._cursor.fetchall)
+
+    async def close(self):
+        """Close the cursor."""
+        self._rows.clear()
+        await self._conn.run(self._cursor.close)
+
+    def __aiter__(self):
+        return self
+
+    async def __anext__(self):
+        if not self._rows:
+            self._rows.extend(await self._conn.run(
+                self._cursor.fetchmany, max(1, self.iter_batch_size)))
+            if not self._rows:
+                raise StopAsyncIteration
+        return self._rows.popleft()
+
+    async def __aenter__(self):
+        return self
+
+    async def __aexit__(self, exc_type, exc_value, traceback):
+        await self.close()
+
+
+async def connect(*, executor=None, **kwargs):
+    """
+    Open a connection without blocking the event loop. Returns an
+    AsyncConnection.
+
+    executor -- concurrent.futures executor that runs the CCI calls of
+        this connection; defaults to a shared pool of DEFAULT_MAX_WORKERS
+        threads
+
+    The other keyword arguments are passed to cubrid_db.connect().
+    """
+    if executor is None:
+        executor = get_default_executor()
+    loop = asyncio.get_running_loop()
+    conn = await loop.run_in_executor(executor, functools.partial(Connection, **kwargs))
+    return AsyncConnection(conn, executor)
@@ -0,0 +1,241 @@
+"""
+Module: bulk.py
+
+This module implements Connection.bulk_load(), a loader for high-volume
+ingest. Rows are read from any iterable, or from a CSV file object, and
+inserted in large array-bound batches: each batch is transposed into
+columns, bound with bind_param_array() and sent with one execute_array()
+request.
+
+Text values, as read from CSV, are bound with the type of their target
+column, as reported by schema_info(), so CCI converts them in C instead
+of the loader converting every cell in Python.
+
+With sessions > 1, the batches are spread over that many connections,
+each inserting from its own thread. The extension releases the GIL while
+it waits on the server, so the sessions load concurrently. The progress
+callback is then called from those threads.
+
+The table and column names are quoted, so reserved words and special
+characters can be used as they are.
+
+Example:
+    with open('events.csv', newline='', encoding='utf-8') as f:
+        stats = conn.bulk_load('events', ['id', 'kind', 'created'], f,
+                               batch_rows=50000, sessions=4,
+                               progress=lambda s: print(s['rows_per_sec']))
+"""
+import csv
+import queue
+import threading
+import time
+from itertools import islice
+
+import _cubrid
+
+from . import field_type
+from .exceptions import InterfaceError
+
+
+DEFAULT_BATCH_ROWS = 10000
+
+# Columns whose text values are left for the server to convert
+_NO_STR_TYPE = {
+    field_type.SET, field_type.MULTISET, field_type.SEQUENCE,
+    field_type.BLOB, field_type.CLOB,
+}
+
+
+def _column_types(conn, table, columns):
+    """
+    Return the type code of each column, from schema_info(), or 0 when it
+    is not known or not usable as a bind type.
+    """
+    types = []
+    for column in columns:
+        info = conn.connection.schema_info(_cubrid.CUBRID_SCH_ATTRIBUTE, table, column)
+        # The name is a pattern, so check that this is the column asked for
+        if not info or str(info[0]).lower() != column.lower():
+            types.append(0)
+            continue
+        domain = info[1] if isinstance(info[1], int) else 0
+        types.append(0 if domain in _NO_STR_TYPE else domain)
+    return types
+
+
+def _quote_name(name, dotted=False):
+    """
+    Quote an identifier for the SQL text. With dotted, an owner.table name
+    is quoted as two identifiers.
+    """
+    if '`' in name:
+        raise InterfaceError(f"Invalid identifier {name!r}")
+    parts = name.split('.') if dotted else [name]
+    return '.'.join(f'`{part}`' for part in parts)
+
+
+def _table_columns(conn, table):
+    """Return the column names of table, in order."""
+    cur = conn.cursor()
+    try:
+        cur.execute(f'select * from {_quote_name(table, True)} where 1 = 0')
+        return [d[0] for d in cur.description]
+    finally:
+        cur.close()
+
+
+def _csv_rows(f, null, csv_options):
+    """Read the rows of a CSV file object, with null fields as None."""
+    for row in csv.reader(f, **csv_options):
+        yield [None if field == null else field for field in row]
+
+
+class _Session:
+    """A connection, and the cursor that inserts the batches on it."""
+    # pylint: disable=too-few-public-methods
+
+    def __init__(self, conn, sql, types, commit):
+        self.conn = conn
+        self.cursor = conn.cursor()
+        self.sql = sql
+        self.types = types
+        self.commit = commit
+
+    def load(self, rows):
+        """Insert one batch of rows. Returns the number of rows inserted."""
+        # pylint: disable=protected-access
+        count = self.cursor._insert_rows(self.sql, rows, self.types)
+        if self.commit:
+            self.conn.commit()
+        return count
+
+    def close(self):
+        """Close the cursor of the session."""
+        self.cursor.close()
+
+
+class _Progress:
+    """Counts the loaded rows and reports them after each batch."""
+
+    def __init__(self, callback):
+        self.lock = threading.Lock()
+        self.callback = callback
+        self.start = time.monotonic()
+        self.rows = 0
+        self.batches = 0
+
+    def stats(self):
+        """Return the counters as a dict."""
+        elapsed = time.monotonic() - self.start
+        return {
+            'rows': self.rows,
+            'batches': self.batches,
+            'elapsed': elapsed,
+            'rows_per_sec': self.rows / elapsed if elapsed > 0 else 0.0,
+        }
+
+    def add(self, rows):
+        """Count a loaded batch of rows."""
+        with self.lock:
+            self.rows += rows
+            self.batches += 1
+            stats = self.stats()
+        if self.callback is not None:
+            self.callback(stats)
+
+
+def _batches(rows, batch_rows):
+    """Split an iterable of rows into lists of batch_rows rows."""
+    it = iter(rows)
+    while True:
+        batch = [row if isinstance(row, (list, tuple)) else tuple(row)
+                 for row in islice(it, batch_rows)]
+        if not batch:
+            return
+        yield batch
+
+
+def _load_parallel(sessions, batches, progress):
+    """Load the batches with one thread per session."""
+    work = queue.Queue(maxsize=2 * len(sessions))
+    errors = []
+    failed = threading.Event()
+
+    def worker(session):
+        while True:
+            batch = work.get()
+            if batch is None:
+                return
+            if failed.is_set():
+                continue
+            try:
+                progress.add(session.load(batch))
+            except Exception as e:  # pylint: disable=broad-exception-caught
+                errors.append(e)
+                failed.set()
+
+    threads = [threading.Thread(target=worker, args=(s,), name='cubrid_db.bulk')
+               for s in sessions]
+    for t in threads:
+        t.start()
+    try:
+        for batch in batches:
+            if failed.is_set():
+                break
+            work.put(batch)
+    finally:
+        for _ in threads:
+            work.put(None)
+        for t in threads:
+            t.join()
+
+    if errors:
+        raise errors[0]
+
+
+def bulk_load(conn, table, columns, rows, *, batch_rows=DEFAULT_BATCH_ROWS,
+              sessions=1, connect=None, commit=True, progress=None,
+              null='', **csv_options):
+    """
+    Insert rows into table. See Connection.bulk_load().
+    """
+    # pylint: disable=too-many-arguments,too-many-locals
+    if batch_rows < 1 or sessions < 1:
+        raise ValueError("batch_rows and sessions must be positive")
+    if sessions > 1 and not commit:
+        raise InterfaceError("commit=False needs a single session")
+
+    if columns is None:
+        columns = _table_columns(conn, table)
+    columns = list(columns)
+    types = _column_types(conn, table, columns)
+    sql = (f'insert into {_quote_name(table, True)} '
+           f'({", ".join(_quote_name(c) for c in columns)}) '
+           f'values ({", ".join("?" * len(columns))})')
+
+    if hasattr(rows, 'read'):
+        rows = _csv_rows(rows, null, csv_options)
+    elif csv_options:
+        raise TypeError("CSV options need a file object")
+
+    if connect is None:
+        connect = conn.reconnect
+    conns = [conn]
+    loaders = []
+    progress = _Progress(progress)
+    try:
+        for _ in range(sessions - 1):
+            conns.append(connect())
+        loaders = [_Session(c, sql, types, commit) for c in conns]
+        if sessions == 1:
+            for batch in _batches(rows, batch_rows):
+                progress.add(loaders[0].load(batch))
+        else:
+            _load_parallel(loaders, _batches(rows, batch_rows), progress)
+    finally:
+        for loader in loaders:
+            loader.close()
+        for c in conns[1:]:
+            c.close()
+
+    return progress.stats()
@@ -3,9 +3,108 @@ This module implements connections for cubrid_db. Presently there is
 only one class: Connection. Others are unlikely. However, you might
 want to make your own subclasses.
 """
+import threading
+from collections import Counter
+
 from _cubrid import connect as cubrid_connect
 
-from .cursors import DictCursor, Cursor
+from .bulk import bulk_load
+from .cursors import (
+    DictCursor, Cursor, RowCursor, LazyCursor, StreamCursor, StreamDictCursor,
+    StreamRowCursor, ScrollCursor, ScrollDictCursor, ScrollRowCursor,
+)
+from .exceptions import InterfaceError
+
+
+ROUTING_ROUND_ROBIN = 'round_robin'
+ROUTING_LEAST_LOADED = 'least_loaded'
+
+
+def _format_host(host):
+    """Return a broker given as "host:port" or (host, port) as "host:port"."""
+    if isinstance(host, str):
+        return host
+    name, port = host
+    return f'{name}:{port}'
+
+
+def make_url(dsn, host=None, alt_hosts=None, connect_timeout=None):
+    """
+    Return the CCI connection URL for dsn, with the broker replaced by
+    host ("host:port"), and the althosts and loginTimeout properties set
+    from alt_hosts (a list of brokers tried in order when the first one
+    cannot be reached) and connect_timeout (seconds). The althosts of the
+    dsn itself are kept, after alt_hosts.
+    """
+    base, _, query = dsn.partition('?')
+    if host is not None:
+        parts = base.split(':')
+        # [cci:]CUBRID:host:port:db:user:password:
+        first = 2 if parts[0].lower() == 'cci' else 1
+        if len(parts) < first + 2:
+            raise ValueError(f"Invalid CUBRID URL: {dsn!r}")
+        parts[first:first + 2] = host.rsplit(':', 1)
+        base = ':'.join(parts)
+
+    props = {}
+    for prop in filter(None, query.split('&')):
+        name, _, value = prop.partition('=')
+        props[name] = value
+    if alt_hosts:
+        hosts = [_format_host(h) for h in alt_hosts]
+        for name in [name for name in props if name.lower() == 'althosts']:
+            hosts += [h for h in props.pop(name).split(',') if h and h not in hosts]
+        props['althosts'] = ','.join(hosts)
+    if connect_timeout is not None:
+        props['loginTimeout'] = str(int(connect_timeout * 1000))
+
+    if not props:
+        return base
+    return base + '?' + '&'.join(f'{name}={value}' for name, value in props.items())
+
+
+class _ReplicaRouter:
+    """
+    Chooses the replica broker of new read-only connections, and counts
+    the read-only connections open on each broker.
+    """
+
+    def __init__(self):
+        # Reentrant: Connection.__del__ may run during a collection
+        # triggered while the lock is held
+        self._lock = threading.RLock()
+        self._next = 0
+        self.open = Counter()
+
+    def order(self, hosts, routing):
+        """Return hosts in the order to try them, the chosen one first."""
+        with self._lock:
+            if routing == ROUTING_LEAST_LOADED:
+                start = min(range(len(hosts)), key=lambda i: self.open[hosts[i]])
+            elif routing == ROUTING_ROUND_ROBIN:
+                start = self._next % len(hosts)
+                self._next += 1
+            else:
+                raise ValueError(f"Unknown routing: {routing!r}")
+        return hosts[start:] + hosts[:start]
+
+    def opened(self, host):
+        """Count a connection opened on host."""
+        with self._lock:
+            self.open[host] += 1
+
+    def closed(self, host):
+        """Count a connection on host closed."""
+        with self._lock:
+            self.open[host] -= 1
+            if self.open[host] <= 0:
+                del self.open[host]
+
+
+replica_router = _ReplicaRouter()
+
+# Metadata caches shared by the connections to a database, by (url, user)
+_shared_meta_caches = {}
 
 
 class Connection:
@@ -16,27 +115,178 @@ class Connection:
         user = "public",
         password = "",
         charset = "utf8",
+        fetch_size = 0,
+        stmt_cache_size = 0,
+        meta_cache_ttl = 0,
+        shared_meta_cache = False,
+        collect_stats = False,
+        native_collections = False,
+        intern_strings = False,
+        epoch_datetimes = False,
+        alt_hosts = None,
+        connect_timeout = None,
+        query_timeout = None,
+        read_only = False,
+        replicas = None,
+        routing = ROUTING_ROUND_ROBIN,
     ):
         """
         Create a connecton to the database.
         Note:
         The guideline for arguments can be found here:
         https://peps.python.org/pep-0249/#id48
+
+        fetch_size -- default number of rows per server fetch packet for
+        the cursors of this connection; 0 keeps the CCI default.
+
+        stmt_cache_size -- number of idle prepared statements kept per
+        connection and reused when the same SQL text is executed again;
+        0 disables the cache.
+
+        meta_cache_ttl -- seconds the schema_info() results and the
+        descriptions of the statements are cached; 0 disables the cache.
+        It is cleared when the schema is changed through the connection.
+
+        shared_meta_cache -- share the metadata cache with the other
+        connections of this process to the same database, so that a
+        schema change through any of them clears it for all.
+
+        collect_stats -- count and time the prepare, execute, fetch and
+        bind calls of this connection, see stats().
+
+        native_collections -- fetch the elements of SET, MULTISET and
+        SEQUENCE values as the Python type of their domain (int, float,
+        Decimal, date/time, bytes) instead of str.
+
+        intern_strings -- intern the short strings fetched by the cursors
+        of this connection, so the repeated values of low-cardinality
+        columns share one object.
+
+        epoch_datetimes -- fetch DATETIME and TIMESTAMP values, with or
+        without time zone, as int microseconds since 1970-01-01 (UTC for
+        the zoned types) instead of datetime objects.
+
+        alt_hosts -- brokers ("host:port" or (host, port)) that CCI tries
+        in order when the broker of the dsn cannot be reached, and that
+        it fails over to if the connection is lost. They come before the
+        althosts of the dsn URL, which are kept.
+
+        connect_timeout -- seconds to wait for each broker before trying
+        the next one.
+
+        query_timeout -- seconds a statement executed by the cursors of
+        this connection may run before it fails with QueryCanceledError;
+        0 waits indefinitely, None keeps the queryTimeout of the URL. See
+        also Cursor.query_timeout.
+
+        read_only -- the connection is only used for reads. With replicas,
+        it is opened on a replica broker instead of the primary.
+
+        replicas -- brokers of the read replicas. The first one is chosen
+        by routing; the other replicas, then the primary broker and its
+        alt_hosts, are the failover hosts.
+
+        routing -- how read-only connections pick their replica:
+        ROUTING_ROUND_ROBIN ('round_robin') rotates over the replicas, and
+        ROUTING_LEAST_LOADED ('least_loaded') picks the one with the fewest
+        read-only connections open by this process.
         """
+        # Kept for reconnect(), the password included
+        self._connect_args = {
+            name: value for name, value in locals().items() if name != 'self'
+        }
         self.charset = charset
+        self.fetch_size = fetch_size
+        self.intern_strings = intern_strings
+        self.epoch_datetimes = epoch_datetimes
+        self.query_timeout = query_timeout
+        self.read_only = read_only
+        self.host = None
+        host = None
 
+        alt_hosts = [_format_host(h) for h in alt_hosts or ()]
+        if read_only and replicas:
+            hosts = replica_router.order([_format_host(h) for h in replicas], routing)
+            host = hosts[0]
+            primary = make_url(dsn).partition('?')[0].split(':')
+            first = 2 if primary[0].lower() == 'cci' else 1
+            alt_hosts = hosts[1:] + [':'.join(primary[first:first + 2])] + alt_hosts
+
+        url = make_url(dsn, host, alt_hosts, connect_timeout)
         self.connection = cubrid_connect(
-            url = dsn,
+            url = url,
             user = user,
             passwd = password,
         )
+        if host is not None:
+            # Only counted once open, so that close() and __del__ can
+            # release it
+            replica_router.opened(host)
+            self.host = host
+        self.connection.stmt_cache_size = stmt_cache_size
+        self.connection.meta_cache_ttl = meta_cache_ttl
+        if shared_meta_cache:
+            key = (make_url(dsn).partition('?')[0].lower(), user.lower())
+            self.connection.set_meta_cache(_shared_meta_caches.setdefault(key, {}))
+        self.connection.stats_enabled = collect_stats
+        self.connection.native_collections = native_collections
 
     def __del__(self):
-        pass
+        # A connection dropped without close() still frees its replica
+        host, self.host = getattr(self, 'host', None), None
+        if host is not None:
+            replica_router.closed(host)
 
-    def cursor(self, dict_cursor = False):
-        """Return a new Cursor Object using the connection."""
-        cursor_class = DictCursor if dict_cursor else Cursor
+    def reconnect(self):
+        """
+        Open a new Connection with the arguments this one was opened with.
+        The connection keeps them for this, so its password stays in the
+        memory of the process while it is open.
+        """
+        return type(self)(**self._connect_args)
+
+    def cursor(self, dict_cursor = False, row_cursor = False, stream = False,
+               scroll = False, *, lazy = False):
+        """
+        Return a new Cursor Object using the connection.
+        dict_cursor -- return rows as dictionaries
+        row_cursor -- return rows as _cubrid.Row tuples, which can also be
+            indexed by column name
+        stream -- read the rows from the server block by block instead of
+            keeping the result set in the client, see StreamCursor
+        scroll -- allow to move back and forth over the result set, with a
+            cache of the blocks read, see ScrollCursor
+        lazy -- return rows as _cubrid.LazyRow objects, which convert
+            each column on first access, see LazyCursor
+        """
+        # pylint: disable=too-many-arguments
+        if stream and scroll:
+            raise InterfaceError("A cursor cannot be both streaming and scrollable")
+        if lazy and (stream or scroll or dict_cursor or row_cursor):
+            raise InterfaceError("A lazy cursor cannot be streaming, scrollable, "
+                                 "or return dict or Row rows")
+        if lazy:
+            cursor_class = LazyCursor
+        elif scroll:
+            if dict_cursor:
+                cursor_class = ScrollDictCursor
+            elif row_cursor:
+                cursor_class = ScrollRowCursor
+            else:
+                cursor_class = ScrollCursor
+        elif stream:
+            if dict_cursor:
+                cursor_class = StreamDictCursor
+            elif row_cursor:
+                cursor_class = StreamRowCursor
+            else:
+                cursor_class = StreamCursor
+        elif dict_cursor:
+            cursor_class = DictCursor
+        elif row_cursor:
+            cursor_class = RowCursor
+        else:
+            cursor_class = Cursor
         return cursor_class(self)
 
     def set_autocommit(self, value):
@@ -84,6 +334,84 @@ class Connection:
         """
         return self.connection.set()
 
+    def stmt_cache_stats(self):
+        """
+        Return the statement cache hits and misses, as a dict.
+        """
+        return {
+            'size': self.connection.stmt_cache_size,
+            'hits': self.connection.stmt_cache_hits,
+            'misses': self.connection.stmt_cache_misses,
+        }
+
+    def meta_cache_stats(self):
+        """
+        Return the metadata cache ttl, hits and misses, as a dict.
+        """
+        return {
+            'ttl': self.connection.meta_cache_ttl,
+            'hits': self.connection.meta_cache_hits,
+            'misses': self.connection.meta_cache_misses,
+        }
+
+    def meta_cache_clear(self):
+        """
+        Drop the cached schema_info() results and descriptions, e.g. after
+        the schema was changed by another process.
+        """
+        self.connection.meta_cache_clear()
+
+    def schema_info(self, schema_type, table_name, attr_name=None):
+        """
+        Return the first row of the schema information of table_name, see
+        _cubrid.connection.schema_info(). Cached while meta_cache_ttl is set.
+        """
+        if attr_name is None:
+            return self.connection.schema_info(schema_type, table_name)
+        return self.connection.schema_info(schema_type, table_name, attr_name)
+
+    def stats(self):
+        """
+        Return the client-side metrics of the connection, as a dict:
+        prepare_count, prepare_time, execute_count, execute_time,
+        fetch_calls, fetch_time, convert_time, rows_fetched,
+        bytes_converted and bind_count. Times are in seconds; fetch_time
+        minus convert_time is the time spent waiting for the server.
+        The counters only move while collect_stats is on.
+        """
+        return self.connection.stats()
+
+    def reset_stats(self):
+        """Set the counters returned by stats() back to zero."""
+        self.connection.reset_stats()
+
+    @property
+    def collect_stats(self):
+        """Whether the metrics returned by stats() are collected."""
+        return bool(self.connection.stats_enabled)
+
+    @collect_stats.setter
+    def collect_stats(self, value):
+        self.connection.stats_enabled = bool(value)
+
+    def set_trace_callback(self, callback):
+        """
+        Call callback(sql, elapsed, rowcount) after each statement is
+        executed, e.g. to record OpenTelemetry spans. elapsed is in
+        seconds, and rowcount is -1 when the statement failed.
+        None removes the callback.
+        """
+        self.connection.set_trace_callback(callback)
+
+    def cancel(self):
+        """
+        Cancel the statement running on the connection. It is meant to be
+        called from another thread, or from an asyncio task, while a
+        cursor of the connection executes; the statement then fails with
+        QueryCanceledError. Does nothing when no statement is running.
+        """
+        self.connection.cancel()
+
     def ping(self):
         """
         Checks whether or not the connection to the server is working.
@@ -101,6 +429,9 @@ class Connection:
         """
         Close the connection now
         """
+        host, self.host = self.host, None
+        if host is not None:
+            replica_router.closed(host)
         self.connection.close()
 
     def escape_string(self, buf):
@@ -120,3 +451,65 @@ class Connection:
         Executes more than one sql statement at the same time.
         """
         return self.connection.batch_execute(sql)
+
+    def execute_batch(self, statements):
+        """
+        Execute a batch of statements with bound parameters, in order.
+
+        statements -- iterable of (sql, params) pairs, where params is a
+            sequence of parameters or None; a plain SQL string is the
+            same as (sql, None)
+
+        The batch uses as few requests as the protocol allows: consecutive
+        statements without parameters are sent in one request, as with
+        batch_execute(), and consecutive executions of one DML statement
+        are array bound, like executemany() with executemany_array set. A
+        request that fails as a whole fails each of its statements. The
+        other statements are
+        prepared (through the statement cache) and executed one by one.
+
+        Returns a list with one int per statement: the number of affected
+        rows, or the negative CUBRID error code if the statement failed
+        (-1 for an error without a code). A failed statement does not
+        stop the batch, whether the server or the driver rejected it.
+        """
+        cur = self.cursor()
+        try:
+            return cur.execute_batch(statements)
+        finally:
+            cur.close()
+
+    def bulk_load(self, table, columns, rows, **kwargs):
+        """
+        Insert a large number of rows into a table.
+
+        table -- name of the table, or owner.table
+        columns -- names of the columns the rows fill, or None for all the
+            columns of the table, in order; the names are quoted, so
+            reserved words and special characters need no quoting
+        rows -- iterable of row sequences, or a text file object read as
+            CSV
+
+        Keyword arguments:
+        batch_rows -- rows inserted per array-bound request (default
+            10000)
+        sessions -- number of connections inserting batches concurrently,
+            this one included; the others are opened with connect
+        connect -- callable that opens another session; defaults to
+            reconnect()
+        commit -- commit after each batch (default True); with False the
+            rows are left in the transaction of this connection, which
+            needs sessions=1
+        progress -- callable called after each batch with the stats dict
+            below; with sessions > 1 it runs on the loader threads, and
+            calls for different sessions may overlap
+        null -- CSV field value read as NULL (default '')
+        Any other keyword argument is passed to csv.reader().
+
+        str values are bound with the type of their column, so numbers,
+        dates etc. read from CSV are converted by CCI.
+
+        Returns a dict with the number of 'rows' and 'batches' loaded,
+        the 'elapsed' seconds and the 'rows_per_sec' rate.
+        """
+        return bulk_load(self, table, columns, rows, **kwargs)
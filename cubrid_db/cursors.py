@@ -31,16 +31,31 @@ Note:
 For more detailed documentation on the use of this module and the Python CUBRID API,
 refer to the official CUBRID documentation and Python API guidelines.
 """
+import re
+import sys
+from collections import OrderedDict, deque
 from datetime import date, time, datetime
 from decimal import Decimal
+from itertools import groupby
 
 from . import field_type
-from .exceptions import InterfaceError
+from .exceptions import DatabaseError, Error, InterfaceError, ProgrammingError
 
 
 INT_MIN = -2147483648
 INT_MAX = +2147483647
 
+# Rows per fetch packet that CCI uses when no fetch size is set
+CCI_DEFAULT_FETCH_SIZE = 100
+
+# Statements that executemany() sends with array binding
+ARRAY_DML_RE = re.compile(r'\s*(insert|update|delete|replace|merge)\b', re.IGNORECASE)
+
+# Python types that can be bound with bind_param_array(), in the order
+# they are checked (bool is an int, datetime is a date)
+ARRAY_TYPES = (int, float, Decimal, str, bytes, datetime, date, time)
+BIGINT_MIN, BIGINT_MAX = -2 ** 63, 2 ** 63 - 1
+
 
 def is_iterable(obj):
     """Returns whether an object is iterable"""
@@ -68,7 +83,8 @@ def get_set_element_type(iterable):
     This function iterates over each element in the provided iterable and
     determines its data type based on predefined type categories. The categories
     include INT for integers, FLOAT for floating point numbers, MONETARY for Decimal,
-    DATE for date objects, TIME for time objects, DATETIME for datetime objects,
+    DATE for date objects, TIME for time objects, DATETIME for datetime objects
+    (and for dates mixed with datetimes),
     VARBIT for bytes, and VARCHAR for strings. These categories are represented by
     field_type attributes.
 
@@ -101,12 +117,12 @@ def get_set_element_type(iterable):
             t = field_type.FLOAT
         elif isinstance(obj, Decimal):
             t = field_type.NUMERIC
+        elif isinstance(obj, datetime):
+            t = field_type.DATETIME
         elif isinstance(obj, date):
             t = field_type.DATE
         elif isinstance(obj, time):
             t = field_type.TIME
-        elif isinstance(obj, datetime):
-            t = field_type.DATETIME
         elif isinstance(obj, bytes):
             t = field_type.VARBIT
         elif isinstance(obj, str):
@@ -114,12 +130,120 @@ def get_set_element_type(iterable):
 
         if chosen_type is None:
             chosen_type = t
+        elif {t, chosen_type} == {field_type.DATE, field_type.DATETIME}:
+            # Dates mixed with datetimes are taken at midnight
+            chosen_type = field_type.DATETIME
         elif t is not chosen_type:
             raise TypeError(f"Iterable contains elements of different types: {t} != {chosen_type}")
 
     return chosen_type
 
 
+def get_array_column(values, str_type=0):
+    """
+    Prepare the values of one column for bind_param_array().
+
+    The non-None values must share one of the ARRAY_TYPES, aware
+    datetimes and int values outside of BIGINT excepted. A column that
+    mixes int and float values is not array bound either: converting the
+    ints to float could round them. A column of str is bound as str_type,
+    if given, so that CCI converts the text to that type.
+
+    Returns a (values, bind_type) pair, or None when the column cannot be
+    array bound.
+    """
+    kinds = set()
+    for value in values:
+        if value is None:
+            continue
+        kind = next((t for t in ARRAY_TYPES if isinstance(value, t)), None)
+        if kind is None or (kind is datetime and value.tzinfo is not None):
+            # Aware datetimes are bound one by one, as DATETIMETZ
+            return None
+        if kind is int and not BIGINT_MIN <= value <= BIGINT_MAX:
+            # Bound one by one, as NUMERIC
+            return None
+        kinds.add(kind)
+
+    if len(kinds) > 1:
+        return None
+
+    if kinds == {bytes}:
+        bind_type = field_type.VARBIT
+    elif kinds == {str}:
+        bind_type = str_type
+    else:
+        bind_type = 0
+    return values, bind_type
+
+
+def get_array_columns(rows, str_types=None):
+    """
+    Transpose a list of parameter rows into columns for bind_param_array().
+
+    Every row must be a sequence of the same length, and each column must
+    be accepted by get_array_column(). str_types optionally gives the
+    str_type of each column.
+
+    Returns a list of (values, bind_type) pairs, or None when the rows
+    cannot be array bound and have to be executed one by one.
+    """
+    if not rows or not all(isinstance(row, (list, tuple)) for row in rows):
+        return None
+    width = len(rows[0])
+    if width == 0 or any(len(row) != width for row in rows):
+        return None
+
+    columns = []
+    for i, values in enumerate(zip(*rows)):
+        column = get_array_column(values, str_types[i] if str_types else 0)
+        if column is None:
+            return None
+        columns.append(column)
+
+    return columns
+
+
+def _batch_items(statements):
+    """Normalize the items of a batch to (sql, params) pairs."""
+    for item in statements:
+        if isinstance(item, (str, bytes, bytearray)):
+            sql, params = item, None
+        else:
+            sql, params = item
+        if isinstance(sql, (bytes, bytearray)):
+            sql = sql.decode()
+        yield sql, params
+
+
+# Errors that fail one statement of a batch, not the batch: the driver
+# raises OverflowError for a value that does not fit its column type
+_BATCH_ERRORS = (Error, OverflowError)
+
+
+def _error_code(error):
+    """
+    The CUBRID error code of error, for the results of a batch, or -1 for
+    an error raised without one.
+    """
+    code = error.args[0] if error.args else None
+    return code if isinstance(code, int) and code < 0 else -1
+
+
+def group_batch_statements(statements):
+    """
+    Split a batch of statements into the runs that can share requests.
+    Yields (sqls, None) for consecutive statements without parameters,
+    and (sql, params_list) for consecutive executions of one statement.
+    """
+    for key, run in groupby(_batch_items(statements),
+                            key=lambda item: None if item[1] is None else item[0]):
+        if key is None:
+            yield [sql for sql, _ in run], None
+        else:
+            yield key, [params for _, params in run]
+
+
 class BaseCursor:
     """
     A base for Cursor classes. Useful attributes:
@@ -130,6 +254,23 @@ class BaseCursor:
 
     arraysize::
         default number of rows fetchmany() will fetch
+
+    executemany_array::
+        when set, executemany() array binds the rows it can, see there;
+        off by default
+
+    executemany_batch_size::
+        maximum number of rows executemany() sends in one request
+
+    fetch_size::
+        number of rows the server sends per fetch packet; 0 means
+        that arraysize is used when it is larger than the CCI default
+
+    query_timeout::
+        seconds a statement may run before it fails with
+        QueryCanceledError, 0 for no limit, None to keep the timeout of
+        the connection URL; defaults to the query_timeout of the
+        connection
     """
 
     def __init__(self, conn):
@@ -140,11 +281,76 @@ class BaseCursor:
             raise InterfaceError("Bad connection, invalid cursor")
 
         self.arraysize = 1
+        self.executemany_array = False
+        self.executemany_batch_size = 1000
+        self.fetch_size = conn.fetch_size
         self.rowcount = -1
-        self.description = None
+        self._has_result = False
+        self._description = None
 
         self.charset = conn.charset
         self._cs.set_charset(conn.charset)
+        self._cs.intern_strings = conn.intern_strings
+        self._cs.epoch_datetimes = conn.epoch_datetimes
+        self.query_timeout = conn.query_timeout
+
+    @property
+    def description(self):
+        """
+        The description of the last executed query, see PEP-249. It is
+        built by the extension on first access, and reused while the
+        cursor executes the same statement.
+        """
+        if self._description is not None:
+            return self._description[0]
+        if self._cs is None or not self._has_result:
+            return None
+        return self._cs.description
+
+    @description.setter
+    def description(self, value):
+        """Replace the description until the next execute."""
+        self._description = (value,)
+
+    @property
+    def query_timeout(self):
+        """Execution timeout of the statements of the cursor, in seconds."""
+        timeout = self._cs.query_timeout if self._cs is not None else -1
+        return timeout / 1000 if timeout >= 0 else None
+
+    @query_timeout.setter
+    def query_timeout(self, value):
+        self.__check_state()
+        if value is not None and value < 0:
+            raise ValueError("query_timeout must not be negative")
+        # -1 leaves the CCI timeout of the URL, 0 disables it; round up so
+        # that small values still time out
+        if value is None:
+            self._cs.query_timeout = -1
+        else:
+            self._cs.query_timeout = max(1, int(value * 1000)) if value else 0
+
+    @property
+    def allocations(self):
+        """
+        Heap allocations the extension made for the last execute, a debug
+        counter: the ones of the calls of this cursor since its previous
+        execute, which include the bind buffers, the imports of the sets
+        bound and the fetches. Other cursors and connection calls, e.g.
+        escape_string(), do not count. Bind buffers come from a per-cursor
+        arena that is reused between executes, so it is 0 once a loop of
+        executes of the same shape is in its steady state. The arena keeps
+        at most arena_cap bytes between executes; one execute takes as
+        much as its binds need.
+        """
+        return self._cs.allocs if self._cs is not None else 0
+
+    def cancel(self):
+        """
+        Cancel the statement this cursor is executing, from another thread;
+        it fails with QueryCanceledError. See Connection.cancel().
+        """
+        self.con.cancel()
 
     def __del__(self):
         try:
@@ -169,26 +375,39 @@ class BaseCursor:
         if isinstance(query, (bytes, bytearray)):
             query = query.decode()
 
+        self._cs.set_fetch_size(self._get_fetch_size())
         self._cs.prepare(query)
 
+    def _get_fetch_size(self):
+        """
+        Return the fetch size for the next statement: the explicit
+        fetch_size if set, otherwise arraysize when it exceeds the CCI
+        default packet size, otherwise 0 (CCI default).
+        """
+        if self.fetch_size:
+            return self.fetch_size
+        if self.arraysize > CCI_DEFAULT_FETCH_SIZE:
+            return self.arraysize
+        return 0
+
     def _bind_params(self, args):
         """
         Bind parameters to a command statement in a database cursor.
 
-        This method processes the provided arguments (args) and binds them to a command
-        statement associated with the database cursor. It handles different types of
-        arguments including booleans, iterables, bytes, and other data types by converting
-        or processing them appropriately before binding.
-
-        For each argument in 'args':
-        - If the argument is None, it is skipped.
-        - If the argument is a boolean, it is converted to '1' or '0' string.
-        - If the argument is an iterable (except strings and bytes), its element type
-        is determined using 'get_set_element_type', and then it's bound as a set.
-        - If the argument is a bytes object, it is converted to a binary string using
-        'bytes_to_binstr' and bound with type 'field_type.VARBIT'.
-        - For strings and other data types, the argument is bound directly or after
-        converting to string, respectively.
+        This method binds the provided arguments (args) to the command statement
+        associated with the database cursor. The scalar arguments are bound by the
+        extension in a single bind_params() call:
+        - None is bound as NULL.
+        - A boolean is bound as 1 or 0.
+        - An int is bound as INT, or as BIGINT when it does not fit.
+        - bytes, bytearray and memoryview are bound as 'field_type.VARBIT'. Other
+        buffer objects (array.array, numpy arrays) are refused: wrap them in a
+        memoryview to bind their bytes.
+        - Strings, floats, Decimal and date/time values are bound with their type,
+        and other objects after converting them to string.
+
+        The iterables (except strings and bytes) are left to this method: their element
+        type is determined using 'get_set_element_type', and they are bound as sets.
 
         The method uses 'self.__check_state()' to ensure that the cursor is in an appropriate
         state for binding parameters.
@@ -204,29 +423,11 @@ class BaseCursor:
 
         self.__check_state()
 
-        if not is_iterable(args):
-            args = [args,]
-
-        for i, arg in enumerate(args, start=1):
-            if arg is None:
-                continue
-
-            if isinstance(arg, bool):
-                self._cs.bind_param(i, 1 if arg else 0)
-            elif isinstance(arg, int):
-                if arg < INT_MIN or arg > INT_MAX:
-                    self._cs.bind_param(i, arg, field_type.BIGINT)
-                else:
-                    self._cs.bind_param(i, arg)
-            elif isinstance(arg, (float, str, date, time, datetime, Decimal)):
-                self._cs.bind_param(i, arg)
-            elif isinstance(arg, bytes):
-                self._cs.bind_param(i, arg, field_type.VARBIT)
-            elif is_iterable(arg):
-                self._bind_set(i, arg)
-            else:
-                arg = str(arg)
-                self._cs.bind_param(i, arg)
+        if not isinstance(args, (tuple, list)):
+            args = list(args) if is_iterable(args) else [args,]
+
+        for i in self._cs.bind_params(args):
+            self._bind_set(i, args[i - 1])
 
     def _bind_set(self, i, set_arg):
         """
@@ -236,11 +437,13 @@ class BaseCursor:
         element_type = get_set_element_type(set_arg)
         s = self.con.connection.set()
 
-        adapt = str
-        if element_type == field_type.VARBIT:
-            adapt = bytes_to_binary_string
+        # Numbers, dates, bytes and Decimal are encoded natively by the
+        # extension; only strings are sent for the server to parse
+        values = tuple(set_arg)
+        if element_type in (None, field_type.VARCHAR):
+            values = tuple(map(str, values))
 
-        s.imports(tuple(map(adapt, set_arg)), element_type)
+        s.imports(values, element_type)
         self._cs.bind_set(i, s)
 
     def execute(self, query, args=None):
@@ -261,7 +464,8 @@ class BaseCursor:
 
         r = self._cs.execute()
         self.rowcount = self._cs.rowcount
-        self.description = self._cs.description
+        self._has_result = True
+        self._description = None
         return r
 
     def executemany(self, query, args_list):
@@ -272,19 +476,134 @@ class BaseCursor:
 
         args_list -- Sequence of sequences or mappings, parameters to use with query
 
-        This method improves performance on multiple-row INSERT and REPLACE.
-        Otherwise it is equivalent to looping over args with execute().
+        By default this is equivalent to looping over args with execute():
+        the rows before a failed one are applied, the later ones are not.
+
+        With executemany_array set, multiple-row INSERT, UPDATE, DELETE,
+        REPLACE and MERGE are faster: when the parameters of each column
+        share one type, the rows are array bound and sent
+        executemany_batch_size rows per request. When a row fails, the
+        error raised has the index of the row in args_list as its row
+        attribute. The later requests are not sent, but the server
+        executes all the rows of an array bound request: the rows after
+        the failed one in its request are applied, and committed in
+        autocommit mode.
         """
         self.__check_state()
 
         self._prepare(query)
 
+        args_list = list(args_list)
+        columns = None
+        if self.executemany_array and ARRAY_DML_RE.match(
+                query if isinstance(query, str) else query.decode()):
+            columns = get_array_columns(args_list)
+
+        if columns is None:
+            for args in args_list:
+                self._bind_params(args)
+                self._cs.execute()
+
+            self.rowcount = self._cs.rowcount
+            self._has_result = True
+            self._description = None
+            return
+
+        results = self._execute_array(columns, len(args_list)) or [-1]
+
+        # Same as the execute() loop: the row count of the last row
+        self.rowcount = results[-1]
+        self._has_result = False
+        self._description = None
+
+    def _insert_rows(self, query, rows, str_types):
+        """
+        Execute an INSERT for a list of rows, array bound when possible,
+        with str values bound as the str_types of their columns. Used by
+        bulk_load(). Returns the number of rows.
+        """
+        self._prepare(query)
+        columns = get_array_columns(rows, str_types)
+        if columns is None:
+            for args in rows:
+                self._bind_params(args)
+                self._cs.execute()
+        else:
+            self._execute_array(columns, len(rows))
+        self.rowcount = len(rows)
+        self._has_result = False
+        self._description = None
+        return len(rows)
+
+    def _execute_array(self, columns, count, keep_errors=False):
+        """
+        Execute the prepared statement for count rows of array bound
+        columns, executemany_batch_size rows per request. Returns the
+        results of all the rows, see _cubrid.cursor.execute_array().
+        With keep_errors, a request that fails as a whole gives the error
+        code to each of its rows, and the next requests are still sent.
+        """
+        results = []
+        size = max(1, self.executemany_batch_size)
+        for start in range(0, count, size):
+            try:
+                for i, (values, bind_type) in enumerate(columns, start=1):
+                    self._cs.bind_param_array(i, values[start:start + size], bind_type)
+                results += self._cs.execute_array(keep_errors)
+            except _BATCH_ERRORS as e:
+                if keep_errors:
+                    results += [_error_code(e)] * min(size, count - start)
+                    continue
+                # The index of the failed row in the whole list
+                if isinstance(e, DatabaseError) and hasattr(e, 'row'):
+                    e.row += start
+                raise
+        return results
+
+    def _execute_run(self, query, args_list):
+        """
+        Execute one statement once per parameter row, array bound when
+        possible. Returns the result of each row, errors included.
+        """
+        try:
+            self._prepare(query)
+        except Error as e:
+            return [_error_code(e)] * len(args_list)
+
+        if len(args_list) > 1 and ARRAY_DML_RE.match(query):
+            columns = get_array_columns(args_list)
+            if columns is not None:
+                return self._execute_array(columns, len(args_list), True)
+
+        results = []
         for args in args_list:
-            self._bind_params(args)
-            self._cs.execute()
+            try:
+                self._bind_params(args)
+                self._cs.execute()
+                results.append(self._cs.rowcount)
+            except _BATCH_ERRORS as e:
+                results.append(_error_code(e))
+        return results
+
+    def execute_batch(self, statements):
+        """
+        Execute a batch of statements with their parameters, see
+        Connection.execute_batch(). Returns a list with the number of
+        affected rows, or the negative error code, of each statement.
+        """
+        self.__check_state()
 
-        self.rowcount = self._cs.rowcount
-        self.description = self._cs.description
+        results = []
+        for query, args_list in group_batch_statements(statements):
+            if args_list is None:
+                results += self.con.connection.batch_execute(query, True)
+            else:
+                results += self._execute_run(query, args_list)
+
+        self.rowcount = -1
+        self._has_result = False
+        self._description = None
+        return results
 
     @classmethod
     def _get_fetch_type(cls):
@@ -303,16 +622,12 @@ class BaseCursor:
         return self._cs.fetch_row(self._get_fetch_type())
 
     def _fetch_many(self, size):
+        """
+        Fetch up to size rows (all remaining rows if size is negative).
+        The result list is built by the extension in a single call.
+        """
         self.__check_state()
-        rlist = []
-        i = 0
-        while size < 0 or i < size:
-            r = self.fetchone()
-            if not r:
-                break
-            rlist.append(r)
-            i = i+1
-        return rlist
+        return self._cs.fetch_many(size, self._get_fetch_type())
 
     def fetchmany(self, size=None):
         """
@@ -343,6 +658,50 @@ class BaseCursor:
         self.__check_state()
         return self._fetch_many(-1)
 
+    def fetch(self, size=None, columns=None):
+        """
+        Fetch up to size rows (all remaining rows by default), like
+        fetchmany(). With columns, a sequence of column names or 0-based
+        indexes, the rows hold only those columns, in that order: the
+        other columns are not read from the fetch buffer at all, which
+        saves most of the conversion work of wide SELECT * results.
+        """
+        self.__check_state()
+        if size is None:
+            size = -1
+        if columns is None:
+            return self._fetch_many(size)
+        return self._cs.fetch_many(size, self._get_fetch_type(),
+                                   self._column_indexes(columns))
+
+    def _column_indexes(self, columns):
+        """Return the 0-based indexes of columns, given by name or index."""
+        names = [column[0] for column in self.description or ()]
+        indexes = []
+        for column in columns:
+            if isinstance(column, str):
+                if column not in names:
+                    raise ProgrammingError(f"No column {column!r} in the result set")
+                indexes.append(names.index(column))
+            else:
+                indexes.append(column)
+        return indexes
+
+    def fetch_columns(self, size=None):
+        """
+        Fetch up to size rows (all remaining rows by default) column by
+        column, into contiguous typed buffers instead of Python objects.
+
+        Returns a list with a (format, data, validity, offsets) tuple per
+        column, see _cubrid.cursor.fetch_columns() for the layout. The
+        buffers can be wrapped without copying, e.g. with numpy.frombuffer
+        or pyarrow.foreign_buffer.
+        """
+        self.__check_state()
+        if size is None:
+            size = -1
+        return self._cs.fetch_columns(size)
+
     def setinputsizes(self, *args):
         """Does nothing, required by DB API."""
 
@@ -415,3 +774,333 @@ class DictCursor(BaseCursor):
     @classmethod
     def _get_fetch_type(cls):
         return 1 # Dict tuple rows
+
+
+class RowCursor(BaseCursor):
+    '''
+    This is a Cursor class that returns rows as _cubrid.Row objects:
+    tuples that can also be indexed by column name, e.g. row['name'].
+    The rows of a result share their column names, so they cost about
+    the same as plain tuples. Use dict(row) to get a dictionary.
+    '''
+    # pylint: disable=abstract-method
+
+    @classmethod
+    def _get_fetch_type(cls):
+        return 2 # Named tuple rows
+
+
+class LazyCursor(BaseCursor):
+    '''
+    This is a Cursor class that returns rows as _cubrid.LazyRow objects,
+    which convert a column value only when it is first accessed, by
+    index or by column name, and keep it. Rows of wide results of which
+    only a few columns are read cost little more than the fetch itself.
+
+    The rows read their values from the result set of the cursor: the
+    columns not accessed yet can no longer be read once the cursor
+    executes another statement or is closed.
+
+    Reading a row other than the last one read moves the CCI cursor back
+    to it, and fetches its rows from the server again once they are no
+    longer in the CCI fetch buffer (see fetch_size). Read the rows as
+    they are fetched: fetchall() followed by reading the rows fetches the
+    result twice.
+    '''
+    # pylint: disable=abstract-method
+
+    @classmethod
+    def _get_fetch_type(cls):
+        return 3 # Lazy rows
+
+
+class _BlockCursor(BaseCursor):
+    '''
+    Base class of the cursors that read the result set from the server
+    block_size rows at a time, with fetch_block(). Subclasses keep the
+    blocks read and drop them in _reset_blocks().
+    '''
+    # pylint: disable=abstract-method
+
+    _block_kind = 'block'
+
+    def __init__(self, conn):
+        super().__init__(conn)
+        self.block_size = 1000
+
+    @classmethod
+    def _get_fetch_type(cls):
+        return 0 # Tuple rows
+
+    def _get_fetch_size(self):
+        return max(1, self.block_size)
+
+    def _check_open(self):
+        if self._cs is None:
+            raise InterfaceError("The cursor has been closed. No operation is allowed any more.")
+
+    def _reset_blocks(self):
+        """Drop the blocks read from the previous result set."""
+        raise NotImplementedError
+
+    def close(self):
+        self._reset_blocks()
+        super().close()
+
+    def execute(self, query, args=None):
+        self._reset_blocks()
+        return super().execute(query, args)
+
+    def executemany(self, query, args_list):
+        self._reset_blocks()
+        return super().executemany(query, args_list)
+
+    def fetch(self, size=None, columns=None):
+        if columns is not None:
+            raise InterfaceError(
+                f"fetch() columns are not supported by {self._block_kind} cursors")
+        return super().fetch(size)
+
+    def fetch_columns(self, size=None):
+        raise InterfaceError(
+            f"fetch_columns() is not supported by {self._block_kind} cursors")
+
+
+class StreamCursor(_BlockCursor):
+    '''
+    This is a Cursor class that returns rows as tuples and does not
+    store the result set in the client. The rows are read from the server
+    block_size rows at a time, and the CCI buffer of each block is freed
+    once the block is read, so the client holds at most one block however
+    large the result is. Iterate over the cursor to process the rows, e.g.
+    to export a large table.
+
+    The bound is in rows, not bytes: the server sends whole packets of
+    fetch size rows, so the memory of a block grows with the width of its
+    rows. Lower block_size for wide rows, e.g. long strings.
+
+    block_size::
+        number of rows fetched from the server per request, also used as
+        the fetch size of the statements
+    '''
+    # pylint: disable=abstract-method
+
+    _block_kind = 'streaming'
+
+    def __init__(self, conn):
+        super().__init__(conn)
+        self._block = deque()
+
+    def _reset_blocks(self):
+        self._block = deque()
+
+    def _next_block(self):
+        """
+        Replace the consumed block with the next one from the server.
+        Returns False at the end of the result set.
+        """
+        self._block = deque(self._cs.fetch_block(self._get_fetch_size(),
+                                                 self._get_fetch_type()))
+        return bool(self._block)
+
+    def fetchone(self):
+        self._check_open()
+        if not self._block and not self._next_block():
+            return None
+        return self._block.popleft()
+
+    def _fetch_many(self, size):
+        self._check_open()
+        rows = []
+        while size < 0 or len(rows) < size:
+            if not self._block and not self._next_block():
+                break
+            need = size - len(rows)
+            if 0 <= need < len(self._block):
+                rows.extend(self._block.popleft() for _ in range(need))
+            else:
+                rows.extend(self._block)
+                self._block.clear()
+        return rows
+
+    def __iter__(self):
+        self._check_open()
+        return self._rows()
+
+    def _rows(self):
+        """Yield the remaining rows, one block in memory at a time."""
+        while self._block or self._next_block():
+            block = self._block
+            while block:
+                yield block.popleft()
+
+
+class StreamDictCursor(StreamCursor):
+    '''
+    This is a StreamCursor class that returns rows as dictionaries.
+    '''
+    # pylint: disable=abstract-method
+
+    @classmethod
+    def _get_fetch_type(cls):
+        return 1 # Dict tuple rows
+
+
+class StreamRowCursor(StreamCursor):
+    '''
+    This is a StreamCursor class that returns rows as _cubrid.Row objects.
+    '''
+    # pylint: disable=abstract-method
+
+    @classmethod
+    def _get_fetch_type(cls):
+        return 2 # Named tuple rows
+
+
+def _rows_size(rows):
+    """
+    Estimate the memory held by a block of rows: the list itself, and its
+    rows from the size of a few of them.
+    """
+    sample = rows[::max(1, len(rows) // 4)][:4]
+    size = 0
+    for row in sample:
+        values = row.values() if isinstance(row, dict) else row
+        size += sys.getsizeof(row) + sum(sys.getsizeof(v) for v in values)
+    return sys.getsizeof(rows) + size * len(rows) // max(1, len(sample))
+
+
+class ScrollCursor(_BlockCursor):
+    '''
+    This is a Cursor class that returns rows as tuples and can move back
+    and forth over the result set with scroll(). The rows are read from
+    the server block_size rows at a time, and the decoded blocks are kept
+    in an LRU cache, so scrolling back over rows read recently does not
+    fetch or convert them again.
+
+    block_size::
+        number of rows fetched from the server per request, also used as
+        the fetch size of the statements; a change applies from the next
+        execute
+
+    cache_size::
+        memory budget of the block cache, in bytes (estimated); the least
+        recently used blocks are dropped beyond it
+
+    rownumber::
+        0-based index of the next row the fetch methods return
+    '''
+    # pylint: disable=abstract-method
+
+    _block_kind = 'scrollable'
+
+    def __init__(self, conn):
+        super().__init__(conn)
+        self.cache_size = 64 * 1024 * 1024
+        self.cache_hits = 0
+        self.cache_misses = 0
+        self.rownumber = 0
+        self._blocks = OrderedDict()
+        self._cached_bytes = 0
+        self._result_block_size = self._get_fetch_size()
+
+    def _reset_blocks(self):
+        self.rownumber = 0
+        self._blocks = OrderedDict()
+        self._cached_bytes = 0
+        # The cached blocks split the result set with a fixed size
+        self._result_block_size = self._get_fetch_size()
+
+    def _get_block(self, index):
+        """Return block index of the result set, from the cache if possible."""
+        entry = self._blocks.get(index)
+        if entry is not None:
+            self._blocks.move_to_end(index)
+            self.cache_hits += 1
+            return entry[0]
+
+        self.cache_misses += 1
+        size = self._result_block_size
+        self._cs.data_seek(index * size + 1)
+        rows = self._cs.fetch_block(size, self._get_fetch_type())
+        nbytes = _rows_size(rows)
+        self._blocks[index] = (rows, nbytes)
+        self._cached_bytes += nbytes
+        while self._cached_bytes > self.cache_size and len(self._blocks) > 1:
+            _, (_, evicted) = self._blocks.popitem(last=False)
+            self._cached_bytes -= evicted
+        return rows
+
+    def scroll(self, value, mode='relative'):
+        """
+        Move the cursor by value rows (mode 'relative'), or to row index
+        value (mode 'absolute'), see PEP-249. Raises IndexError when the
+        target is outside of the result set. Scrolling itself does not
+        talk to the server: the rows are fetched, unless they are cached,
+        by the next fetch call.
+        """
+        self._check_open()
+        if mode == 'relative':
+            target = self.rownumber + value
+        elif mode == 'absolute':
+            target = value
+        else:
+            raise ProgrammingError(f"Unknown scroll mode {mode!r}")
+        if not 0 <= target <= max(self.rowcount, 0):
+            raise IndexError("Scroll target out of the result set")
+        self.rownumber = target
+
+    def fetchone(self):
+        rows = self._fetch_many(1)
+        return rows[0] if rows else None
+
+    def _fetch_many(self, size):
+        self._check_open()
+        if not self._has_result:
+            return []
+        end = self.rowcount if size < 0 else min(self.rowcount, self.rownumber + size)
+        block_size = self._result_block_size
+        rows = []
+        while self.rownumber < end:
+            index, offset = divmod(self.rownumber, block_size)
+            block = self._get_block(index)
+            if offset >= len(block):
+                break
+            taken = block[offset:offset + end - self.rownumber]
+            rows.extend(taken)
+            self.rownumber += len(taken)
+        return rows
+
+    def cache_stats(self):
+        """
+        Return the block cache hits and misses, and the number of blocks
+        and estimated bytes it holds, as a dict.
+        """
+        return {
+            'hits': self.cache_hits,
+            'misses': self.cache_misses,
+            'blocks': len(self._blocks),
+            'bytes': self._cached_bytes,
+        }
+
+
+class ScrollDictCursor(ScrollCursor):
+    '''
+    This is a ScrollCursor class that returns rows as dictionaries.
+    '''
+    # pylint: disable=abstract-method
+
+    @classmethod
+    def _get_fetch_type(cls):
+        return 1 # Dict tuple rows
+
+
+class ScrollRowCursor(ScrollCursor):
+    '''
+    This is a ScrollCursor class that returns rows as _cubrid.Row objects.
+    '''
+    # pylint: disable=abstract-method
+
+    @classmethod
+    def _get_fetch_type(cls):
+        return 2 # Named tuple rows
@@ -9,6 +9,7 @@ from _cubrid import (
     DatabaseError,
     DataError,
     OperationalError,
+    QueryCanceledError,
     IntegrityError,
     InternalError,
     ProgrammingError,
@@ -41,4 +41,9 @@ CLOB        = 24
 
 STRING = VARCHAR
 
+TIMESTAMPTZ     = 29
+TIMESTAMPLTZ    = 30
+DATETIMETZ      = 31
+DATETIMELTZ     = 32
+
 JSON    = 34
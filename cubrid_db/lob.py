@@ -0,0 +1,114 @@
+"""
+Module: lob.py
+
+This module exposes CUBRID large objects (BLOB/CLOB) as raw binary streams,
+so they can be used wherever Python expects a file object: shutil.copyfileobj(),
+io.BufferedReader, zipfile, image libraries, etc.
+
+Data is read into the caller's buffer with _cubrid.lob.readinto(), without an
+intermediate string, and moved chunk_size bytes per request with the GIL
+released.
+
+Example:
+    con = _cubrid.connect('CUBRID:localhost:33000:demodb:::')
+    cur = con.cursor()
+    cur.prepare('select picture from images')
+    cur.execute()
+    lob = con.lob()
+    cur.fetch_lob(1, lob)
+    with LobIO(lob) as src, open('picture.png', 'wb') as dst:
+        shutil.copyfileobj(src, dst, src.chunk_size)
+"""
+import io
+
+import _cubrid
+
+
+class LobIO(io.RawIOBase):
+    """
+    A raw binary stream over a _cubrid.lob object. It is readable,
+    writable and seekable; the position is the one of the lob.
+
+    lob -- the _cubrid.lob to wrap
+    chunk_size -- if given, the number of bytes the lob transfers per
+        request
+    closelob -- close the lob when the stream is closed
+    """
+
+    def __init__(self, lob, chunk_size=None, closelob=True):
+        super().__init__()
+        self._lob = lob
+        self._closelob = closelob
+        if chunk_size is not None:
+            lob.chunk_size = chunk_size
+
+    @property
+    def lob(self):
+        """The wrapped _cubrid.lob object."""
+        return self._lob
+
+    @property
+    def chunk_size(self):
+        """Number of bytes the lob transfers per request."""
+        return self._lob.chunk_size
+
+    @chunk_size.setter
+    def chunk_size(self, value):
+        self._lob.chunk_size = value
+
+    def _check_open(self):
+        if self.closed:
+            raise ValueError("I/O operation on closed LOB stream.")
+
+    def readable(self):
+        return True
+
+    def writable(self):
+        return True
+
+    def seekable(self):
+        return True
+
+    def readinto(self, buffer):
+        self._check_open()
+        return self._lob.readinto(buffer)
+
+    def readall(self):
+        self._check_open()
+        data = bytearray(max(0, self.size() - self.tell()))
+        size = self._lob.readinto(data)
+        del data[size:]
+        return bytes(data)
+
+    def write(self, b):
+        self._check_open()
+        with memoryview(b) as view:
+            self._lob.write(view)
+            return view.nbytes
+
+    def seek(self, offset, whence=io.SEEK_SET):
+        self._check_open()
+        if whence == io.SEEK_SET:
+            pos = self._lob.seek(offset, _cubrid.SEEK_SET)
+        elif whence == io.SEEK_CUR:
+            pos = self._lob.seek(offset, _cubrid.SEEK_CUR)
+        elif whence == io.SEEK_END:
+            # _cubrid.lob counts SEEK_END offsets backwards from the end
+            pos = self._lob.seek(-offset, _cubrid.SEEK_END)
+        else:
+            raise ValueError(f"invalid whence ({whence})")
+        return pos
+
+    def tell(self):
+        self._check_open()
+        return self._lob.seek(0, _cubrid.SEEK_CUR)
+
+    def size(self):
+        """Return the size of the large object in bytes."""
+        self._check_open()
+        return self._lob.size()
+
+    def close(self):
+        if not self.closed and self._closelob:
+            self._lob.close()
+        super().close()
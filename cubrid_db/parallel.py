@@ -0,0 +1,251 @@
+"""
+Module: parallel.py
+
+This module runs one query as several partitions, each on its own pooled
+connection, and merges their results. The extension releases the GIL
+while it waits on the server and while CCI fetches, so the partitions are
+executed and transferred concurrently.
+
+A partition is a (predicate, params) pair that replaces the {partition}
+placeholder of the query template. ranges() and modulo() build the usual
+partitionings.
+
+Example:
+    pool = cubrid_db.pool.ConnectionPool(maxsize=8, dsn=DSN)
+    rows = cubrid_db.parallel.query(
+        pool, 'select id, amount from orders where {partition} and amount > ?',
+        cubrid_db.parallel.modulo('id', 8), params=(100,))
+"""
+import threading
+from array import array
+from concurrent.futures import FIRST_EXCEPTION, ThreadPoolExecutor, wait
+
+from .exceptions import Error, InterfaceError
+
+
+PARTITION = '{partition}'
+
+BLOCK_ROWS = 10000
+
+# Bytes per value of the fixed width fetch_columns() formats
+_FORMAT_WIDTHS = {'i': 4, 'l': 8, 'g': 8, 'tdD': 4, 'tts': 4, 'tsu:': 8}
+
+
+def ranges(column, bounds):
+    """
+    Partition on column by consecutive bounds: bounds [a, b, c] gives
+    column < a, a <= column < b, b <= column < c and column >= c.
+    """
+    bounds = list(bounds)
+    parts = []
+    lower = None
+    for upper in bounds + [None]:
+        if lower is None and upper is None:
+            parts.append(('1 = 1', ()))
+        elif lower is None:
+            parts.append((f'{column} < ?', (upper,)))
+        elif upper is None:
+            parts.append((f'{column} >= ?', (lower,)))
+        else:
+            parts.append((f'{column} >= ? and {column} < ?', (lower, upper)))
+        lower = upper
+    return parts
+
+
+def modulo(column, count):
+    """Partition on the remainder of the integer column divided by count."""
+    if count < 1:
+        raise ValueError("count must be positive")
+    return [(f'mod({column}, {count}) = ?', (i,)) for i in range(count)]
+
+
+def _partition_sql(template, predicate, params, partition_params):
+    """
+    Return the SQL and parameters of one partition. The parameters of the
+    predicate are placed after those of the template that precede the
+    {partition} placeholder.
+    """
+    if PARTITION not in template:
+        raise InterfaceError(f"The query template has no {PARTITION} placeholder")
+    position = template[:template.index(PARTITION)].count('?')
+    params = tuple(params)
+    sql = template.replace(PARTITION, f'({predicate})')
+    return sql, params[:position] + tuple(partition_params) + params[position:]
+
+
+def _column_rows(column):
+    """Number of rows of a fetch_columns() column."""
+    fmt, data, _, offsets = column
+    if offsets is not None:
+        return len(offsets) // 8 - 1
+    return len(data) // _FORMAT_WIDTHS[fmt]
+
+
+def _concat_validity(parts, counts):
+    """
+    Concatenate the validity bitmaps of parts of counts rows into one
+    bytearray; a part without a bitmap has no NULL. Only the bytes of a
+    part that does not start on a byte boundary are shifted, so the cost
+    is linear in the number of rows.
+    """
+    validity = bytearray((sum(counts) + 7) // 8)
+    shift = 0
+    for part, count in zip(parts, counts):
+        size = (count + 7) // 8
+        bits = b'\xff' * size if part[2] is None else part[2][:size]
+        start, offset = divmod(shift, 8)
+        if offset == 0:
+            validity[start:start + size] = bits
+            if count % 8:
+                validity[start + size - 1] &= (1 << count % 8) - 1
+        else:
+            value = int.from_bytes(bits, 'little') & ((1 << count) - 1)
+            chunk = (value << offset).to_bytes((offset + count + 7) // 8, 'little')
+            validity[start] |= chunk[0]
+            validity[start + 1:start + len(chunk)] = chunk[1:]
+        shift += count
+    return validity
+
+
+class _Run:
+    """
+    The partitions of a query being run: once one fails, the statements
+    of the others are cancelled on their connections, and the partitions
+    that have not started do not execute.
+    """
+
+    def __init__(self):
+        self._lock = threading.Lock()
+        self._running = set()
+        self.cancelled = threading.Event()
+
+    def start(self, conn):
+        """Register conn as running a partition, False once cancelled."""
+        with self._lock:
+            if self.cancelled.is_set():
+                return False
+            self._running.add(conn)
+            return True
+
+    def stop(self, conn):
+        """Unregister conn, before it is given back to the pool."""
+        with self._lock:
+            self._running.discard(conn)
+
+    def cancel(self):
+        """Stop the partitions, cancelling the running statements."""
+        with self._lock:
+            self.cancelled.set()
+            for conn in self._running:
+                try:
+                    conn.cancel()
+                except Error:
+                    pass
+
+
+def concat_columns(chunks):
+    """
+    Concatenate the results of several fetch_columns() calls on the same
+    columns into one (format, data, validity, offsets) tuple per column.
+    """
+    chunks = [chunk for chunk in chunks if chunk]
+    if not chunks:
+        return []
+    if len(chunks) == 1:
+        return chunks[0]
+
+    merged = []
+    for parts in zip(*chunks):
+        fmt = parts[0][0]
+        if any(part[0] != fmt for part in parts):
+            raise InterfaceError("The column formats of the partitions differ")
+        counts = [_column_rows(part) for part in parts]
+
+        data = bytearray().join(part[1] for part in parts)
+
+        validity = None
+        if any(part[2] is not None for part in parts):
+            validity = _concat_validity(parts, counts)
+
+        offsets = None
+        if parts[0][3] is not None:
+            offsets = array('q', [0])
+            for part in parts:
+                values = array('q')
+                values.frombytes(part[3])
+                base = offsets[-1] - values[0]
+                offsets.extend(value + base for value in values[1:])
+            offsets = bytearray(offsets.tobytes())
+
+        merged.append((fmt, data, validity, offsets))
+    return merged
+
+
+def _run_partition(pool, sql, params, columns, run):
+    """Execute one partition and fetch its result block by block."""
+    with pool.connection() as conn:
+        if not run.start(conn):
+            return None
+        cur = conn.cursor()
+        try:
+            cur.arraysize = BLOCK_ROWS
+            cur.execute(sql, params or None)
+            blocks = []
+            while not run.cancelled.is_set():
+                block = cur.fetch_columns(BLOCK_ROWS) if columns else cur.fetchmany()
+                if not block or (columns and not _column_rows(block[0])):
+                    break
+                blocks.append(block)
+            else:
+                return None
+        finally:
+            run.stop(conn)
+            cur.close()
+    if columns:
+        return concat_columns(blocks)
+    return [row for block in blocks for row in block]
+
+
+def query(pool, template, partitions, params=(), *, max_workers=None, columns=False):
+    """
+    Run template once per partition on connections of pool, with at most
+    max_workers (default: pool.maxsize) partitions at a time, and return
+    the merged results in partition order.
+
+    template -- SELECT statement with a {partition} placeholder where the
+        predicate of each partition goes
+    partitions -- (predicate, params) pairs, see ranges() and modulo()
+    params -- parameters of the template itself
+    columns -- fetch with fetch_columns() and return one concatenated
+        (format, data, validity, offsets) tuple per column, instead of a
+        list of rows
+
+    On the first error, partitions not started yet are cancelled, the
+    statements of running ones are cancelled on their connections (see
+    Connection.cancel()), and the error is raised.
+    """
+    # pylint: disable=too-many-arguments
+    statements = [_partition_sql(template, predicate, params, partition_params)
+                  for predicate, partition_params in partitions]
+    if not statements:
+        return []
+    if max_workers is None:
+        max_workers = pool.maxsize
+    run = _Run()
+
+    with ThreadPoolExecutor(max_workers=max(1, min(max_workers, len(statements))),
+                            thread_name_prefix='cubrid_db.parallel') as executor:
+        futures = [executor.submit(_run_partition, pool, sql, args, columns, run)
+                   for sql, args in statements]
+        done, _ = wait(futures, return_when=FIRST_EXCEPTION)
+        failed = next((f for f in futures if f in done and f.exception()), None)
+        if failed is not None:
+            run.cancel()
+            for future in futures:
+                future.cancel()
+            raise failed.exception()
+
+    results = [future.result() for future in futures]
+    if columns:
+        return concat_columns(results)
+    return [row for rows in results for row in rows]
@@ -0,0 +1,322 @@
+"""
+Module: pool.py
+
+This module implements a thread-safe pool of cubrid_db connections. Opening a
+connection to the CUBRID broker costs a network handshake and a CAS slot, so
+services that use a connection per request should borrow one from a pool.
+
+Key Features:
+- Minimum and maximum pool sizes, with idle connections above the minimum
+  closed after idle_timeout seconds.
+- Ping on borrow: idle connections are checked with Connection.ping() and
+  replaced when the server does not answer.
+- Reset on return: pending work is rolled back, and the autocommit and
+  isolation level settings the connection was opened with are restored.
+- Wait queue: when all maxsize connections are in use, acquire() waits for
+  one to be returned, up to a timeout. stats() reports the wait metrics.
+- Read pools: the connect arguments are passed to cubrid_db.connect(), so
+  a pool opened with read_only=True and replicas=[...] spreads its
+  connections over the read replicas, and fails over to the other brokers.
+
+Example:
+    pool = cubrid_db.pool.ConnectionPool(
+        minsize=2, maxsize=10, dsn='CUBRID:localhost:33000:demodb:::')
+    with pool.connection() as conn:
+        cur = conn.cursor()
+        cur.execute('select 1 from db_root')
+    pool.close()
+"""
+import threading
+import time
+from collections import deque
+
+import _cubrid
+
+from .connections import Connection
+from .exceptions import InterfaceError, OperationalError
+
+
+# Default of acquire(): None already means no timeout
+_POOL_TIMEOUT = object()
+
+
+class PoolTimeoutError(OperationalError):
+    """Raised when no connection was returned to the pool in time."""
+
+
+class _PoolEntry:
+    """A connection owned by the pool, with the settings to restore."""
+    # pylint: disable=too-few-public-methods
+
+    def __init__(self, conn):
+        self.conn = conn
+        self.autocommit = conn.autocommit
+        self.isolation_level = conn.connection.isolation_level
+        self.last_used = time.monotonic()
+
+
+class PooledConnection:
+    """
+    A connection borrowed from a ConnectionPool. It behaves like the
+    underlying cubrid_db Connection, except that close() gives it back
+    to the pool. It can be used as a context manager.
+    """
+    _pool = None
+    _entry = None
+
+    def __init__(self, pool, entry):
+        self._pool = pool
+        self._entry = entry
+
+    def __getattr__(self, name):
+        if self._entry is None:
+            raise InterfaceError("The connection has been returned to the pool.")
+        return getattr(self._entry.conn, name)
+
+    def close(self):
+        """Return the connection to the pool. Further use is an error."""
+        entry, self._entry = self._entry, None
+        if entry is not None:
+            self._pool.release(entry)
+
+    def __enter__(self):
+        return self
+
+    def __exit__(self, exc_type, exc_value, traceback):
+        self.close()
+
+    def __del__(self):
+        try:
+            self.close()
+        except Exception:  # pylint: disable=broad-except
+            pass
+
+
+class ConnectionPool:
+    """
+    A thread-safe pool of cubrid_db connections.
+
+    minsize -- connections opened up front and kept open when idle
+    maxsize -- maximum number of open connections
+    idle_timeout -- seconds after which idle connections above minsize
+        are closed; None keeps them open
+    ping_on_borrow -- check idle connections with ping() before lending them
+    timeout -- default number of seconds acquire() waits for a connection
+        when maxsize connections are in use; None waits forever
+
+    The other keyword arguments are passed to cubrid_db.connect().
+    """
+
+    def __init__(self, *, minsize=0, maxsize=10, idle_timeout=600.0,
+                 ping_on_borrow=True, timeout=None, **connect_kwargs):
+        if maxsize < 1 or not 0 <= minsize <= maxsize:
+            raise ValueError("Pool sizes must satisfy 0 <= minsize <= maxsize, maxsize >= 1")
+
+        self.minsize = minsize
+        self.maxsize = maxsize
+        self.idle_timeout = idle_timeout
+        self.ping_on_borrow = ping_on_borrow
+        self.timeout = timeout
+        self._connect_kwargs = connect_kwargs
+
+        self._cond = threading.Condition()
+        self._idle = deque()
+        self._size = 0
+        self._closed = False
+
+        self._waiting = 0
+        self._stats = {
+            'created': 0,
+            'discarded': 0,
+            'acquired': 0,
+            'waits': 0,
+            'wait_time': 0.0,
+            'max_wait_time': 0.0,
+            'timeouts': 0,
+            'ping_failures': 0,
+        }
+
+        for _ in range(minsize):
+            self._size += 1
+            self._idle.append(self._open())
+
+    def _open(self):
+        """Open a new connection. The caller has already reserved its slot."""
+        try:
+            entry = _PoolEntry(Connection(**self._connect_kwargs))
+        except Exception:
+            with self._cond:
+                self._size -= 1
+                self._cond.notify()
+            raise
+        with self._cond:
+            self._stats['created'] += 1
+        return entry
+
+    def _discard(self, entry):
+        """Close a connection and free its slot."""
+        try:
+            entry.conn.close()
+        except _cubrid.Error:
+            pass
+        with self._cond:
+            self._size -= 1
+            self._stats['discarded'] += 1
+            self._cond.notify()
+
+    def _expire_locked(self):
+        """
+        Detach the idle connections above minsize that timed out, and free
+        their slots. The caller closes them once the lock is released.
+        """
+        expired = []
+        if self.idle_timeout is None:
+            return expired
+        limit = time.monotonic() - self.idle_timeout
+        # The oldest connections are on the left
+        while self._idle and self._size > self.minsize and self._idle[0].last_used < limit:
+            expired.append(self._idle.popleft())
+            self._size -= 1
+            self._stats['discarded'] += 1
+        return expired
+
+    def _checkout(self, timeout):
+        """
+        Take an idle connection, or reserve a slot for a new one (None),
+        waiting up to timeout seconds when the pool is exhausted.
+        """
+        start = time.monotonic()
+        expired = []
+        try:
+            with self._cond:
+                waited = False
+                while True:
+                    if self._closed:
+                        raise InterfaceError("The connection pool is closed.")
+                    expired.extend(self._expire_locked())
+                    if self._idle:
+                        # Most recently used first: its session is the warmest
+                        entry = self._idle.pop()
+                        break
+                    if self._size < self.maxsize:
+                        self._size += 1
+                        entry = None
+                        break
+
+                    remaining = None
+                    if timeout is not None:
+                        remaining = timeout - (time.monotonic() - start)
+                        if remaining <= 0:
+                            self._stats['timeouts'] += 1
+                            raise PoolTimeoutError(
+                                f"No connection available within {timeout} seconds")
+                    waited = True
+                    self._waiting += 1
+                    try:
+                        self._cond.wait(remaining)
+                    finally:
+                        self._waiting -= 1
+
+                if waited:
+                    elapsed = time.monotonic() - start
+                    self._stats['waits'] += 1
+                    self._stats['wait_time'] += elapsed
+                    self._stats['max_wait_time'] = max(self._stats['max_wait_time'], elapsed)
+        finally:
+            for old in expired:
+                try:
+                    old.conn.close()
+                except _cubrid.Error:
+                    pass
+
+        return entry
+
+    def _alive(self, entry):
+        try:
+            return entry.conn.ping() == 1
+        except _cubrid.Error:
+            return False
+
+    def acquire(self, timeout=_POOL_TIMEOUT):
+        """
+        Borrow a connection from the pool. Returns a PooledConnection,
+        whose close() gives it back.
+
+        timeout -- seconds to wait when maxsize connections are in use,
+            None to wait forever; defaults to the pool timeout. Raises
+            PoolTimeoutError.
+        """
+        if timeout is _POOL_TIMEOUT:
+            timeout = self.timeout
+        while True:
+            entry = self._checkout(timeout)
+            if entry is None:
+                entry = self._open()
+            elif self.ping_on_borrow and not self._alive(entry):
+                with self._cond:
+                    self._stats['ping_failures'] += 1
+                self._discard(entry)
+                continue
+            break
+
+        with self._cond:
+            self._stats['acquired'] += 1
+        return PooledConnection(self, entry)
+
+    connection = acquire
+
+    def release(self, entry):
+        """Reset a connection and give it back to the pool."""
+        conn = entry.conn
+        try:
+            if not conn.autocommit:
+                conn.rollback()
+            if conn.autocommit != entry.autocommit:
+                conn.set_autocommit(entry.autocommit)
+            if conn.connection.isolation_level != entry.isolation_level:
+                conn.connection.set_isolation_level(
+                    getattr(_cubrid, entry.isolation_level))
+        except (_cubrid.Error, AttributeError):
+            self._discard(entry)
+            return
+
+        with self._cond:
+            if not self._closed:
+                entry.last_used = time.monotonic()
+                self._idle.append(entry)
+                self._cond.notify()
+                return
+        self._discard(entry)
+
+    def stats(self):
+        """
+        Return a dict with the pool size (open connections), the idle,
+        in_use and waiting counts, and the created, discarded, acquired,
+        waits, wait_time, max_wait_time, timeouts and ping_failures
+        counters. Times are in seconds.
+        """
+        with self._cond:
+            stats = dict(self._stats)
+            stats['size'] = self._size
+            stats['idle'] = len(self._idle)
+            stats['in_use'] = self._size - len(self._idle)
+            stats['waiting'] = self._waiting
+        return stats
+
+    def close(self):
+        """
+        Close the idle connections and refuse new borrows. Connections
+        in use are closed when they are returned.
+        """
+        with self._cond:
+            self._closed = True
+            idle, self._idle = self._idle, deque()
+            self._cond.notify_all()
+        for entry in idle:
+            self._discard(entry)
+
+    def __enter__(self):
+        return self
+
+    def __exit__(self, exc_type, exc_value, traceback):
+        self.close()
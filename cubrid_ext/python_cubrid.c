@@ -1,12 +1,14 @@
 #include "python_cubrid.h"
 #include "version.h"
 #include <fcntl.h>
+#include <float.h>
 
 /* Loading dynamic library need this header. */
 #ifdef MS_WINDOWS
 #include <windows.h>
 #else
 #include <dlfcn.h>
+#include <time.h>
 #endif
 
 #ifndef Py_TYPE
@@ -22,9 +24,30 @@
 
 #define CUBRID_CLOB 'C'
 #define CUBRID_BLOB 'B'
-#define CUBRID_LOB_BUF_SIZE 4096
+#define CUBRID_LOB_CHUNK_SIZE (1024 * 1024)
 #define CUBRID_ER_MSG_LEN 1024
 #define CUBRID_ER_MSG_LEN2 1152
+#define CUBRID_INTERN_MAX_LEN 64
+#define CUBRID_ARENA_CAP (4 * 1024 * 1024)
+#define CUBRID_ARENA_MIN_BLOCK 4096
+#define CUBRID_ARENA_ALIGN 16
+#define CUBRID_ARENA_HEADER \
+  ((sizeof (_cubrid_ArenaBlock) + CUBRID_ARENA_ALIGN - 1) \
+   & ~(size_t) (CUBRID_ARENA_ALIGN - 1))
+
+#if defined(_MSC_VER)
+#define CUBRID_THREAD_LOCAL __declspec(thread)
+#else
+#define CUBRID_THREAD_LOCAL __thread
+#endif
+#define CUBRID_COUNT_ALLOC() (_cubrid_heap_allocs++)
+
+/*
+ * Heap allocations the driver made in this thread, and their number when
+ * the cursor method it runs started, see CUBRID_CURSOR_METHOD.
+ */
+static CUBRID_THREAD_LOCAL long _cubrid_heap_allocs;
+static CUBRID_THREAD_LOCAL long _cubrid_heap_allocs_mark;
 
 static PyObject *_cubrid_error;
 static PyObject *_cubrid_interface_error;
@@ -35,9 +58,17 @@ static PyObject *_cubrid_integrity_error;
 static PyObject *_cubrid_internal_error;
 static PyObject *_cubrid_programming_error;
 static PyObject *_cubrid_not_supported_error;
+static PyObject *_cubrid_query_canceled_error;
 
 static PyObject *DecimalType = NULL;
 
+/* Row types by column names tuple, shared by all the cursors */
+#define CUBRID_ROW_TYPES_MAX 1024
+static PyObject *_cubrid_row_types = NULL;
+static PyObject *_cubrid_row_index_key = NULL;
+static PyObject *_cubrid_tzinfo_cache = NULL;
+static PyObject *_cubrid_zoneinfo = NULL;
+
 // Function to import the Decimal type from the decimal module
 static int import_decimal_type()
 {
@@ -118,6 +149,8 @@ static struct _error_message
   CUBRID_ER_INVALID_CURSOR,
       "The cursor has been closed. No operation is allowed any more."},
   {
+  CUBRID_ER_QUERY_CANCELED, "Query canceled"},
+  {
   0, ""}
 };
 
@@ -144,8 +177,12 @@ get_error_msg (int err_code, char *err_msg)
   return -1;
 }
 
-PyObject *
-handle_error (int e, T_CCI_ERROR * error)
+/*
+ * Raise the error e, or CCI error, as the exception class mapped from its
+ * code. A non-NULL type overrides the mapping.
+ */
+static PyObject *
+handle_error_as (int e, T_CCI_ERROR * error, PyObject * type)
 {
   PyObject *t, *exception = NULL;
   int err_code;
@@ -167,6 +204,11 @@ handle_error (int e, T_CCI_ERROR * error)
               exception = _cubrid_programming_error;
               break;
 
+              /* query interrupted: cancelled or timed out */
+            case -111:
+              exception = _cubrid_query_canceled_error;
+              break;
+
               /* operational error list */
             case -669:
             case -673:
@@ -209,7 +251,8 @@ handle_error (int e, T_CCI_ERROR * error)
     }
   else
     {
-      exception = _cubrid_interface_error;
+      exception = e == CCI_ER_QUERY_TIMEOUT ? _cubrid_query_canceled_error
+        : _cubrid_interface_error;
 
       if (get_error_msg (e, err_msg) < 0)
         {
@@ -244,12 +287,172 @@ handle_error (int e, T_CCI_ERROR * error)
   PyTuple_SetItem (t, 0, PyLong_FromLong ((long) err_code));
   PyTuple_SetItem (t, 1, PyUnicode_FromString (msg));
 
-  PyErr_SetObject (exception, t);
+  PyErr_SetObject (type ? type : exception, t);
   Py_DECREF (t);
 
   return NULL;
 }
 
+PyObject *
+handle_error (int e, T_CCI_ERROR * error)
+{
+  return handle_error_as (e, error, NULL);
+}
+
+/*
+ * Raise the error of a statement, as QueryCanceledError if cancel() was
+ * called while it ran, whatever the server reported.
+ */
+static PyObject *
+handle_execute_error (int e, T_CCI_ERROR * error, int canceled)
+{
+  return handle_error_as (e, error,
+                          canceled ? _cubrid_query_canceled_error : NULL);
+}
+
+/*
+ * Each statement executed on a connection gets a new generation, and
+ * cancel() records the generation of the statement running, so that it
+ * never applies to a later one. cancel() runs while the statement holds
+ * the connection lock: these fields have a lock of their own.
+ */
+static long
+_cubrid_exec_begin (_cubrid_ConnectionObject * conn)
+{
+  long gen;
+
+  PyThread_acquire_lock (conn->cancel_lock, WAIT_LOCK);
+  gen = ++conn->exec_gen;
+  conn->running_gen = gen;
+  PyThread_release_lock (conn->cancel_lock);
+  return gen;
+}
+
+/*
+ * Tell if the statement gen was canceled. Called just before the CCI
+ * call too: a cancel made before the request reached the server would
+ * be lost otherwise.
+ */
+static int
+_cubrid_exec_canceled (_cubrid_ConnectionObject * conn, long gen)
+{
+  int canceled;
+
+  PyThread_acquire_lock (conn->cancel_lock, WAIT_LOCK);
+  canceled = (conn->cancel_gen == gen);
+  PyThread_release_lock (conn->cancel_lock);
+  return canceled;
+}
+
+static int
+_cubrid_exec_end (_cubrid_ConnectionObject * conn, long gen)
+{
+  int canceled;
+
+  PyThread_acquire_lock (conn->cancel_lock, WAIT_LOCK);
+  canceled = (conn->cancel_gen == gen);
+  conn->running_gen = 0;
+  PyThread_release_lock (conn->cancel_lock);
+  return canceled;
+}
+
+/*
+ * Allocate size bytes from the arena, with an exception set on failure.
+ * The memory stays valid until the next reset of the arena. A heap block
+ * is only allocated when the current one is full, twice as large as it.
+ */
+static void *
+_cubrid_arena_alloc (_cubrid_Arena * arena, size_t size)
+{
+  _cubrid_ArenaBlock *block = arena->blocks;
+  size_t block_size;
+  char *mem;
+
+  size = (size + CUBRID_ARENA_ALIGN - 1) & ~(size_t) (CUBRID_ARENA_ALIGN - 1);
+  if (size == 0)
+    {
+      size = CUBRID_ARENA_ALIGN;
+    }
+
+  if (!block || block->size - block->used < size)
+    {
+      block_size = block ? block->size * 2 : CUBRID_ARENA_MIN_BLOCK;
+      if (block_size < size)
+        {
+          block_size = size;
+        }
+      block = PyMem_Malloc (CUBRID_ARENA_HEADER + block_size);
+      if (!block)
+        {
+          PyErr_NoMemory ();
+          return NULL;
+        }
+      CUBRID_COUNT_ALLOC ();
+      block->next = arena->blocks;
+      block->size = block_size;
+      block->used = 0;
+      arena->blocks = block;
+    }
+
+  mem = (char *) block + CUBRID_ARENA_HEADER + block->used;
+  block->used += size;
+  return mem;
+}
+
+static void
+_cubrid_arena_free (_cubrid_Arena * arena)
+{
+  _cubrid_ArenaBlock *block, *next;
+
+  for (block = arena->blocks; block; block = next)
+    {
+      next = block->next;
+      PyMem_Free (block);
+    }
+  arena->blocks = NULL;
+}
+
+/*
+ * Release all the memory allocated from the arena. When it took several
+ * blocks, they are replaced by a single block as large as all of them, so
+ * that the same work fits in it next time without allocating. No more
+ * than cap bytes are kept: cap bounds the memory held between executes,
+ * a single execute still gets as much as its binds need.
+ */
+static void
+_cubrid_arena_reset (_cubrid_Arena * arena)
+{
+  _cubrid_ArenaBlock *block;
+  size_t total = 0;
+
+  if (!arena->blocks)
+    {
+      return;
+    }
+  if (!arena->blocks->next
+      && arena->cap > 0 && arena->blocks->size <= (size_t) arena->cap)
+    {
+      arena->blocks->used = 0;
+      return;
+    }
+
+  for (block = arena->blocks; block; block = block->next)
+    {
+      total += block->size;
+    }
+  _cubrid_arena_free (arena);
+
+  if (arena->cap > 0 && total <= (size_t) arena->cap
+      && (block = PyMem_Malloc (CUBRID_ARENA_HEADER + total)))
+    {
+      CUBRID_COUNT_ALLOC ();
+      block->next = NULL;
+      block->size = total;
+      block->used = 0;
+      arena->blocks = block;
+    }
+}
+
 static char _cubrid_connect__doc__[] = "connect(url[,user[,password]])\n\
 Establish the environment for connecting to your server by using\n\
 connection information passed with a url string argument. If the\n\
@@ -336,6 +539,7 @@ _cubrid_escape_string (PyObject * self, PyObject * args, PyObject * kwargs)
     {
       return handle_error (CUBRID_ER_NO_MORE_MEMORY, NULL);
     }
+  CUBRID_COUNT_ALLOC ();
 
   memset (escape_string, 0, len * 2 + 16);
 
@@ -390,10 +594,51 @@ _cubrid_ConnectionObject_init (_cubrid_ConnectionObject * self,
   self->url = NULL;
   self->user = NULL;
   self->passwd = NULL;
+  self->fetch_size = 0;
+  self->stmt_cache = NULL;
+  self->stmt_cache_size = 0;
+  self->stmt_cache_gen = 0;
+  self->stmt_cache_hits = 0;
+  self->stmt_cache_misses = 0;
+  self->stats_enabled = 0;
+  self->native_collections = 0;
+  self->running_gen = 0;
+  self->cancel_gen = 0;
+  self->query_timeout_default = -1;
+  _cubrid_arena_free (&self->arena);
+  self->arena.cap = CUBRID_ARENA_CAP;
+  self->arena_busy = 0;
+  self->meta_cache_ttl = 0;
+  self->meta_cache_hits = 0;
+  self->meta_cache_misses = 0;
+  Py_CLEAR (self->meta_cache);
+  memset (&self->stats, 0, sizeof (self->stats));
+  Py_CLEAR (self->trace_callback);
+
+  if (!self->lock)
+    {
+      self->lock = PyThread_allocate_lock ();
+      if (!self->lock)
+        {
+          PyErr_NoMemory ();
+          return -1;
+        }
+    }
+  if (!self->cancel_lock)
+    {
+      self->cancel_lock = PyThread_allocate_lock ();
+      if (!self->cancel_lock)
+        {
+          PyErr_NoMemory ();
+          return -1;
+        }
+    }
 
   snprintf (buf, 1024, "cci:%s", url);
 
+  CUBRID_BEGIN_ALLOW_THREADS (self);
   con = cci_connect_with_url_ex (buf, user, passwd, &error);
+  CUBRID_END_ALLOW_THREADS (self);
   if (con < 0)
     {
       handle_error (con, &error);
@@ -410,9 +655,11 @@ _cubrid_ConnectionObject_init (_cubrid_ConnectionObject * self,
   self->url = strdup (url);
   self->user = strdup (user);
 
+  CUBRID_BEGIN_ALLOW_THREADS (self);
   res =
     cci_get_db_parameter (con, CCI_PARAM_LOCK_TIMEOUT, (void *) &lock_timeout,
                           &error);
+  CUBRID_END_ALLOW_THREADS (self);
   if (res < 0)
     {
       handle_error (res, &error);
@@ -421,9 +668,11 @@ _cubrid_ConnectionObject_init (_cubrid_ConnectionObject * self,
 
   self->lock_timeout = PyLong_FromLong (lock_timeout);
 
+  CUBRID_BEGIN_ALLOW_THREADS (self);
   res =
     cci_get_db_parameter (con, CCI_PARAM_MAX_STRING_LENGTH,
                           (void *) &max_string_len, &error);
+  CUBRID_END_ALLOW_THREADS (self);
   if (res < 0)
     {
       //handle_error (res, &error);
@@ -433,18 +682,22 @@ _cubrid_ConnectionObject_init (_cubrid_ConnectionObject * self,
 
   self->max_string_len = PyLong_FromLong (max_string_len);
 
+  CUBRID_BEGIN_ALLOW_THREADS (self);
   res =
     cci_get_db_parameter (con, CCI_PARAM_ISOLATION_LEVEL, (void *) &level,
                           &error);
+  CUBRID_END_ALLOW_THREADS (self);
   if (res < 0)
     {
       handle_error (res, &error);
       return -1;
     }
 
+  CUBRID_BEGIN_ALLOW_THREADS (self);
   res =
     cci_get_db_parameter (con, CCI_PARAM_AUTO_COMMIT, (void *) &autocommit,
                           &error);
+  CUBRID_END_ALLOW_THREADS (self);
   if (res < 0)
     {
       handle_error (res, &error);
@@ -467,7 +720,9 @@ _cubrid_ConnectionObject_init (_cubrid_ConnectionObject * self,
     {
       self->autocommit = PyBool_FromLong (0);
     }
+  CUBRID_BEGIN_ALLOW_THREADS (self);
   res = cci_end_tran (con, CCI_TRAN_COMMIT, &error);
+  CUBRID_END_ALLOW_THREADS (self);
   if (res < 0)
     {
       handle_error (res, &error);
@@ -607,2174 +862,6851 @@ _cubrid_ConnectionObject_set (_cubrid_ConnectionObject * self,
   return set;
 }
 
-static PyObject *
-_cubrid_ConnectionObject_end_tran (_cubrid_ConnectionObject * self, int type)
+/*
+ * Client-side metrics.
+ *
+ * Nothing is measured until stats_enabled is set on the connection, or a
+ * trace callback is installed: _cubrid_stats_start() then returns 0 and
+ * the counters are left alone, so the cost is one test per call. Times
+ * are read from a monotonic clock, in nanoseconds.
+ */
+static CUBRID_LONG_LONG
+_cubrid_monotonic_ns (void)
 {
-  int res;
-  T_CCI_ERROR error;
+#ifdef MS_WINDOWS
+  static LARGE_INTEGER freq;
+  LARGE_INTEGER now;
 
-  res = cci_end_tran (self->handle, type, &error);
-  if (res < 0)
+  if (!freq.QuadPart)
     {
-      return handle_error (res, &error);
+      QueryPerformanceFrequency (&freq);
     }
+  QueryPerformanceCounter (&now);
+  return (CUBRID_LONG_LONG) ((double) now.QuadPart * 1e9 / freq.QuadPart);
+#else
+  struct timespec ts;
 
-  Py_INCREF (Py_None);
-  return Py_None;
+  clock_gettime (CLOCK_MONOTONIC, &ts);
+  return (CUBRID_LONG_LONG) ts.tv_sec * 1000000000 + ts.tv_nsec;
+#endif
 }
 
-static char _cubrid_ConnectionObject_commit__doc__[] = "commit()\n\
-Commit any pending transaction to the database.\n\
-CUBRID can be set to perform automatic commits at each operation,\n\
-set_autocommit() and set_isolation_level().\n";
-
-static PyObject *
-_cubrid_ConnectionObject_commit (_cubrid_ConnectionObject * self,
-                                 PyObject * args)
+static CUBRID_LONG_LONG
+_cubrid_stats_start (_cubrid_ConnectionObject * conn)
 {
-  if (!PyArg_ParseTuple (args, ""))
+  if (!conn->stats_enabled && !conn->trace_callback)
     {
-      return NULL;
+      return 0;
     }
 
-  return _cubrid_ConnectionObject_end_tran (self, CCI_TRAN_COMMIT);
+  return _cubrid_monotonic_ns ();
 }
 
-static char _cubrid_ConnectionObject_rollback__doc__[] = "rollback()\n\
-Roll back the start of any pending transaction to database. Closing\n\
-a connection without committing the changes first will cause an\n\
-implicit rollback to be performed.";
-
-static PyObject *
-_cubrid_ConnectionObject_rollback (_cubrid_ConnectionObject * self,
-                                   PyObject * args)
+/* Nanoseconds since start, 0 when nothing is measured */
+static CUBRID_LONG_LONG
+_cubrid_stats_elapsed (CUBRID_LONG_LONG start)
 {
-  if (!PyArg_ParseTuple (args, ""))
-    {
-      return NULL;
-    }
-
-  return _cubrid_ConnectionObject_end_tran (self, CCI_TRAN_ROLLBACK);
+  return start ? _cubrid_monotonic_ns () - start : 0;
 }
 
-static char _cubrid_ConnectionObject_server_version__doc__[] =
-  "server_version()\n\
-This function returns a string that represents the CUBRID server version.\n\
-Returns a string that represents the server version number.\n\
-\n\
-Example::\n\
-  import _cubrid\n\
-  con = _cubrid.connect(\"CUBRID:localhost:33000:demodb:::\", \"public\")\n\
-  print con.server_version()\n\
-  con.close()";
-
-static PyObject *
-_cubrid_ConnectionObject_server_version (_cubrid_ConnectionObject * self,
-                                         PyObject * args)
+/*
+ * Report an executed statement to the trace callback of the connection,
+ * as callback(sql, elapsed_seconds, rowcount). rowcount is -1 when the
+ * statement failed. Errors raised by the callback are reported with
+ * sys.unraisablehook and do not affect the statement.
+ */
+static void
+_cubrid_CursorObject_trace (_cubrid_CursorObject * self,
+                            CUBRID_LONG_LONG elapsed, int rowcount)
 {
-  int res;
-  char db_ver[16];
+  PyObject *callback = self->conn->trace_callback, *ret;
 
-  if (!PyArg_ParseTuple (args, ""))
+  if (!callback)
     {
-      return NULL;
+      return;
     }
 
-  res = cci_get_db_version (self->handle, db_ver, sizeof (db_ver));
-  if (res < 0)
+  Py_INCREF (callback);
+  ret = PyObject_CallFunction (callback, "Odi",
+                               self->query ? self->query : Py_None,
+                               elapsed / 1e9, rowcount);
+  if (ret)
     {
-      return handle_error (res, NULL);
+      Py_DECREF (ret);
     }
-
-  return PyUnicode_FromString (db_ver);
+  else
+    {
+      PyErr_WriteUnraisable (callback);
+    }
+  Py_DECREF (callback);
 }
 
-static char _cubrid_ConnectionObject_client_version__doc__[] =
-  "client_version()\n\
-This function returns a string that represents the client library version.\n\
-\n\
-Return a string that represents the CUBRID client library\n\
-\n\
-Example::\n\
-  import _cubrid\n\
-  con = _cubrid.connect(\"CUBRID:localhost:33000:demodb:::\", \"public\")\n\
-  print con.client_version()\n\
-  con.close()";
+/*
+ * Prepared statement cache.
+ *
+ * stmt_cache maps the SQL text to an idle request handle, in LRU order
+ * (dicts keep insertion order, so the first entry is the oldest one).
+ * A cursor takes the handle out of the cache when it prepares the same
+ * SQL text, and gives it back when it is reset, so a handle is never
+ * shared by two cursors. Flushing bumps stmt_cache_gen: handles taken
+ * out before the flush are closed when given back.
+ */
+static void
+_cubrid_stmt_cache_close_handle (_cubrid_ConnectionObject * conn, int handle)
+{
+  CUBRID_BEGIN_ALLOW_THREADS (conn);
+  cci_close_req_handle (handle);
+  CUBRID_END_ALLOW_THREADS (conn);
+}
 
-static PyObject *
-_cubrid_ConnectionObject_client_version (_cubrid_ConnectionObject * self,
-                                         PyObject * args)
+static int
+_cubrid_stmt_cache_take (_cubrid_ConnectionObject * conn, PyObject * sql)
 {
-  char info[256];
+  PyObject *item = NULL;
+  int handle;
 
-  if (!PyArg_ParseTuple (args, ""))
+  if (conn->stmt_cache)
     {
-      return NULL;
+      item = PyDict_GetItemWithError (conn->stmt_cache, sql);
+    }
+  if (!item)
+    {
+      PyErr_Clear ();
+      conn->stmt_cache_misses++;
+      return 0;
     }
 
-  cci_get_version_string (info, sizeof (info));
-  // Remove the prefix "VERSION="
-  return PyUnicode_FromString (info + 8);
-}
+  handle = (int) PyLong_AsLong (item);
+  if (PyDict_DelItem (conn->stmt_cache, sql) < 0)
+    {
+      PyErr_Clear ();
+    }
+  conn->stmt_cache_hits++;
 
-static char _cubrid_ConnectionObject_set_autocommit__doc__[] =
-  "set_autocommit(mode)\n\
-This function set the autocommit mode.\n\
-It can enable/disable the transaction management.\n\
-\n\
-mode: bool. It will be True/False\n\
-\n\
-Example::\n\
-  import _cubrid\n\
-  con = _cubrid.connect(\"CUBRID:localhost:33000:demodb:::\", \"public\")\n\
-  con.set_autocommit(True)\n\
-  print con.autocommit\n\
-  con.close()";
+  return handle;
+}
 
-static PyObject *
-_cubrid_ConnectionObject_set_autocommit (_cubrid_ConnectionObject * self,
-                                         PyObject * args)
+static void
+_cubrid_stmt_cache_put (_cubrid_ConnectionObject * conn, PyObject * sql,
+                        int handle)
 {
-  PyObject *autocommit_obj;
-  int mode;
-  int res;
+  PyObject *exc_type, *exc_value, *exc_tb, *key, *value;
+  Py_ssize_t pos;
+  int evicted, res = -1;
 
-  if (!PyArg_ParseTuple (args, "O!", &PyBool_Type, &autocommit_obj))
-    {
-      return handle_error (CUBRID_ER_INVALID_PARAM, NULL);
-    }
-  mode = PyObject_IsTrue (autocommit_obj);
-  if (mode != 0)
+  /* Called from reset(), possibly while an exception is propagating */
+  PyErr_Fetch (&exc_type, &exc_value, &exc_tb);
+
+  if (conn->stmt_cache_size > 0 && conn->handle
+      && (conn->stmt_cache || (conn->stmt_cache = PyDict_New ()))
+      && PyDict_Contains (conn->stmt_cache, sql) == 0)
     {
-      res = cci_set_autocommit (self->handle, CCI_AUTOCOMMIT_TRUE);
-      if (res < 0)
+      value = PyLong_FromLong (handle);
+      if (value)
         {
-          return handle_error (res, NULL);
+          res = PyDict_SetItem (conn->stmt_cache, sql, value);
+          Py_DECREF (value);
         }
-
-      self->autocommit = PyBool_FromLong (1);
     }
-  else
+  PyErr_Clear ();
+  if (res < 0)
     {
-      res = cci_set_autocommit (self->handle, CCI_AUTOCOMMIT_FALSE);
+      _cubrid_stmt_cache_close_handle (conn, handle);
+    }
+
+  while (conn->stmt_cache
+         && PyDict_Size (conn->stmt_cache) > conn->stmt_cache_size)
+    {
+      pos = 0;
+      if (!PyDict_Next (conn->stmt_cache, &pos, &key, &value))
+        {
+          break;
+        }
+      evicted = (int) PyLong_AsLong (value);
+      Py_INCREF (key);
+      res = PyDict_DelItem (conn->stmt_cache, key);
+      Py_DECREF (key);
       if (res < 0)
         {
-          return handle_error (res, NULL);
+          PyErr_Clear ();
+          break;
         }
-
-      self->autocommit = PyBool_FromLong (0);
+      _cubrid_stmt_cache_close_handle (conn, evicted);
     }
 
-  Py_INCREF (Py_None);
-  return Py_None;
+  PyErr_Restore (exc_type, exc_value, exc_tb);
 }
 
-static char _cubrid_ConnectionObject_set_isolation_level__doc__[] =
-  "set_isolation(isolation_level)\n\
-Set the transaction isolation level for the current session.\n\
-The level defines the different phenomena can happen in the\n\
-database between concurrent transactions.\n\
-\n\
-isolation_level maybe::\n\
-  CUBRID_REP_CLASS_COMMIT_INSTANCE\n\
-  CUBRID_REP_CLASS_REP_INSTANCE\n\
-  CUBRID_SERIALIZABLE\n\
-\n\
-Example::\n\
-  import _cubrid\n\
-  form _cubrid import *\n\
-  con = _cubrid.connect(\"CUBRID:localhost:33000:demodb:::\", \"public\")\n\
-  con.set_isolation_level(CUBRID_REP_CLASS_REP_INSTANCE)\n\
-  print con.isolation_level\n\
-  con.close()";
-
-static PyObject *
-_cubrid_ConnectionObject_set_isolation_level (_cubrid_ConnectionObject * self,
-                                              PyObject * args)
+/*
+ * Drop all the cached handles, closing them on the server unless the
+ * connection is already gone.
+ */
+static void
+_cubrid_stmt_cache_clear (_cubrid_ConnectionObject * conn, int close_handles)
 {
-  int level, res;
-  T_CCI_ERROR error;
+  PyObject *cache = conn->stmt_cache, *key, *value;
+  Py_ssize_t pos = 0;
 
-  if (!PyArg_ParseTuple (args, "i", &level))
+  /* The lock is released while closing, so detach the dict first */
+  conn->stmt_cache = NULL;
+  conn->stmt_cache_gen++;
+
+  if (!cache)
     {
-      return NULL;
+      return;
     }
-
-  res = cci_set_isolation_level (self->handle, level, &error);
-  if (res < 0)
+  while (close_handles && PyDict_Next (cache, &pos, &key, &value))
     {
-      return handle_error (res, &error);
+      _cubrid_stmt_cache_close_handle (conn, (int) PyLong_AsLong (value));
     }
-
-  self->isolation_level =
-    PyUnicode_FromString (cubrid_isolation[level - 4].isolation);
-
-  Py_INCREF (Py_None);
-  return Py_None;
+  Py_DECREF (cache);
 }
 
-static char _cubrid_ConnectionObject_ping__doc__[] = "ping()\n\
-Checks whether or not the connection to the server is working. This \n\
-function can be used by clients that remain idle for a long while,\n\
-to check whether or not the server has closed the connection and reconnect\n\
-if necessary.\n\
-\n\
-Return values::\n\
-  1 when connected\n\
-  0 when not connect\n\
-\n\
-Example::\n\
-  import _cubrid\n\
-  con = _cubrid.connect(\"CUBRID:localhost:33000:demodb:::\", \"public\")\n\
-  print con.ping()\n\
-  con.close()";
+/* Statements after which cached plans may refer to a stale schema */
+static int
+_cubrid_stmt_changes_schema (T_CCI_CUBRID_STMT type)
+{
+  switch (type)
+    {
+    case SQLX_CMD_ALTER_CLASS:
+    case SQLX_CMD_CREATE_CLASS:
+    case SQLX_CMD_CREATE_INDEX:
+    case SQLX_CMD_DROP_CLASS:
+    case SQLX_CMD_DROP_INDEX:
+    case SQLX_CMD_RENAME_CLASS:
+    case SQLX_CMD_ALTER_INDEX:
+    case SQLX_CMD_CREATE_TRIGGER:
+    case SQLX_CMD_DROP_TRIGGER:
+    case SQLX_CMD_CREATE_SERIAL:
+    case SQLX_CMD_ALTER_SERIAL:
+    case SQLX_CMD_DROP_SERIAL:
+    case SQLX_CMD_CREATE_STORED_PROCEDURE:
+    case SQLX_CMD_ALTER_STORED_PROCEDURE:
+    case SQLX_CMD_DROP_STORED_PROCEDURE:
+    case SQLX_CMD_GRANT:
+    case SQLX_CMD_REVOKE:
+    case SQLX_CMD_ROLLBACK_WORK:
+      return 1;
+    default:
+      return 0;
+    }
+}
 
+/*
+ * Metadata cache.
+ *
+ * meta_cache maps a schema_info() request, as a (type, class, attr)
+ * tuple, or the SQL text of a statement, to an (expires, value) tuple:
+ * the schema_info() result, or the description of the statement, kept for
+ * meta_cache_ttl seconds. The dict may be shared by all the connections
+ * to a database, see set_meta_cache(), and is cleared when one of them
+ * changes the schema. The connections of a shared dict do not lock each
+ * other out, so lookups lock the dict itself: PyDict_SetItem() and
+ * PyDict_Clear() already do.
+ */
 static PyObject *
-_cubrid_ConnectionObject_ping (_cubrid_ConnectionObject * self,
-                               PyObject * args)
+_cubrid_meta_cache_get (_cubrid_ConnectionObject * conn, PyObject * key)
 {
-  int res;
-  T_CCI_ERROR error;
-  char *query = "select 1+1 from db_root";
-  int req_handle = 0, result = 0, ind = 0;
-  int connected = 0;
+  PyObject *cache = conn->meta_cache, *entry, *value = NULL;
 
-  if (!PyArg_ParseTuple (args, ""))
+  if (conn->meta_cache_ttl <= 0 || !cache)
     {
       return NULL;
     }
 
-  res = cci_prepare (self->handle, query, 0, &error);
-  if (res < 0)
+  /* The borrowed entry cannot go away while the dict is locked */
+  Py_BEGIN_CRITICAL_SECTION (cache);
+  entry = PyDict_GetItemWithError (cache, key);
+  if (entry && PyTuple_Check (entry) && PyTuple_GET_SIZE (entry) == 2
+      && PyLong_AsLongLong (PyTuple_GET_ITEM (entry, 0))
+      > _cubrid_monotonic_ns ())
     {
-      return handle_error (res, &error);
+      value = PyTuple_GET_ITEM (entry, 1);
+      Py_INCREF (value);
     }
+  Py_END_CRITICAL_SECTION ();
+  PyErr_Clear ();
 
-  req_handle = res;
-
-  res = cci_execute (req_handle, 0, 0, &error);
-  if (res < 0)
+  if (value)
     {
-      return handle_error (res, &error);
+      conn->meta_cache_hits++;
     }
-
-  while (1)
+  else
     {
-      res = cci_cursor (req_handle, 1, CCI_CURSOR_CURRENT, &error);
-      if (res == CCI_ER_NO_MORE_DATA)
-        {
-          break;
-        }
-      if (res < 0)
-        {
-          return handle_error (res, &error);
-        }
-
-      res = cci_fetch (req_handle, &error);
-      if (res < 0)
-        {
-          return handle_error (res, &error);
-        }
-
-      res = cci_get_data (req_handle, 1, CCI_A_TYPE_INT, &result, &ind);
-      if (res < 0)
-        {
-          return handle_error (res, &error);
-        }
-
-      if (result == 2)
-        {
-          connected = 1;
-        }
+      conn->meta_cache_misses++;
     }
-
-  cci_close_req_handle (req_handle);
-  return PyLong_FromLong (connected);
+  return value;
 }
 
-static char *
-_cubrid_dup_buf (char *src_buf, int size)
+static void
+_cubrid_meta_cache_put (_cubrid_ConnectionObject * conn, PyObject * key,
+                        PyObject * value)
 {
-  int len = 0;
-  char *temp_buf = NULL;
+  PyObject *entry;
+  PY_LONG_LONG expires;
 
-  if (src_buf != NULL)
+  if (conn->meta_cache_ttl <= 0
+      || (!conn->meta_cache && !(conn->meta_cache = PyDict_New ())))
     {
-      len = strlen (src_buf);
+      PyErr_Clear ();
+      return;
     }
-  else
+
+  expires = _cubrid_monotonic_ns ()
+    + (PY_LONG_LONG) (conn->meta_cache_ttl * 1e9);
+  entry = Py_BuildValue ("(LO)", expires, value);
+  if (!entry || PyDict_SetItem (conn->meta_cache, key, entry) < 0)
     {
-      len = size;
+      PyErr_Clear ();
     }
-  if (len <= 0)
+  Py_XDECREF (entry);
+}
+
+/*
+ * Called after a statement that changes the schema, or a rollback that
+ * may undo one: drop the cached plans, schema_info() results and
+ * descriptions.
+ */
+static void
+_cubrid_schema_changed (_cubrid_ConnectionObject * conn)
+{
+  _cubrid_stmt_cache_clear (conn, 1);
+  if (conn->meta_cache)
     {
-      return NULL;
+      PyDict_Clear (conn->meta_cache);
     }
-  temp_buf = (char *) malloc (len + 1);
-  if (NULL == temp_buf)
+}
+
+static char _cubrid_ConnectionObject_stmt_cache_clear__doc__[] =
+  "stmt_cache_clear()\n\
+Close all the prepared statements kept in the statement cache of the\n\
+connection. The cache is also cleared on rollback and after a statement\n\
+that changes the schema is executed through this connection.";
+
+static PyObject *
+_cubrid_ConnectionObject_stmt_cache_clear (_cubrid_ConnectionObject * self,
+                                           PyObject * args)
+{
+  if (!PyArg_ParseTuple (args, ""))
     {
       return NULL;
     }
-  memset (temp_buf, 0, len + 1);
-  if (NULL != src_buf)
-    memcpy (temp_buf, src_buf, len);
 
-  return temp_buf;
+  _cubrid_stmt_cache_clear (self, self->handle > 0);
+
+  Py_INCREF (Py_None);
+  return Py_None;
 }
 
-static char *
-_cubrid_get_data_buf (int type, int num)
+static char _cubrid_ConnectionObject_stats__doc__[] = "stats()\n\
+Return a dict with the client-side metrics of the connection, counted\n\
+while stats_enabled is set:\n\
+  prepare_count, prepare_time: prepare() calls and the time spent in them\n\
+  execute_count, execute_time: execute() and execute_array() calls\n\
+  fetch_calls, fetch_time: fetch_row(), fetch_many(), fetch_all() and\n\
+    fetch_columns() calls, and the time spent in them, which includes\n\
+    the fetch round trips to the server (CCI does not report them)\n\
+  convert_time: part of fetch_time spent building the Python rows\n\
+  rows_fetched: rows returned by the fetch calls\n\
+  bytes_converted: bytes of column data converted to Python values\n\
+  bind_count: parameters bound\n\
+Times are in seconds, from a monotonic clock.";
+
+static PyObject *
+_cubrid_ConnectionObject_stats (_cubrid_ConnectionObject * self,
+                                PyObject * args)
 {
-  switch (type)
+  _cubrid_Stats *s = &self->stats;
+
+  if (!PyArg_ParseTuple (args, ""))
     {
-    case CCI_U_TYPE_BIT:
-    case CCI_U_TYPE_VARBIT:
-      return _cubrid_dup_buf (NULL, sizeof (T_CCI_BIT) * (num + 1));
-    default:
-      return _cubrid_dup_buf (NULL, sizeof (void *) * (num + 1));
+      return NULL;
     }
+
+  return Py_BuildValue ("{sLsdsLsdsLsdsdsLsLsL}",
+                        "prepare_count", s->prepare_count,
+                        "prepare_time", s->prepare_ns / 1e9,
+                        "execute_count", s->execute_count,
+                        "execute_time", s->execute_ns / 1e9,
+                        "fetch_calls", s->fetch_calls,
+                        "fetch_time", s->fetch_ns / 1e9,
+                        "convert_time", s->convert_ns / 1e9,
+                        "rows_fetched", s->rows_fetched,
+                        "bytes_converted", s->bytes_converted,
+                        "bind_count", s->bind_count);
 }
 
-static char _cubrid_ConnectionObject_batch_execute__doc__[] = "batch_execute()\n\
- The api can execute more than one sql statement in the same time\n\
-\n\
-Return values::\n\
-  Tuple: ({'err_no': 0, 'err_msg': 'success'},)\n\
-\n\
-Example::\n\
-  import _cubrid\n\
-  con = _cubrid.connect(\"CUBRID:localhost:33000:demodb:::\", \"public\")\n\
-  sql = (\"insert into test value('1');\", \"insert into test value('2');\")\n\
-  err = con.batch_execute(sql)\n\
-  con.close()";
+static char _cubrid_ConnectionObject_reset_stats__doc__[] =
+  "reset_stats()\n\
+Set all the counters returned by stats() back to zero.";
+
+static PyObject *
+_cubrid_ConnectionObject_reset_stats (_cubrid_ConnectionObject * self,
+                                      PyObject * args)
+{
+  if (!PyArg_ParseTuple (args, ""))
+    {
+      return NULL;
+    }
+
+  memset (&self->stats, 0, sizeof (self->stats));
+
+  Py_INCREF (Py_None);
+  return Py_None;
+}
 
+static char _cubrid_ConnectionObject_cancel__doc__[] = "cancel()\n\
+Cancel the statement the connection is executing, from another thread.\n\
+The statement fails with QueryCanceledError. Does nothing when the\n\
+connection is idle or closed.";
 
+/*
+ * Not serialized with the other methods: it must run while another
+ * thread holds the connection lock in cci_execute. CCI sends the cancel
+ * request to the broker over a connection of its own.
+ */
 static PyObject *
-_cubrid_ConnectionObject_batch_execute (_cubrid_ConnectionObject * self,
-                               PyObject * args)
+_cubrid_ConnectionObject_cancel (_cubrid_ConnectionObject * self,
+                                 PyObject * args)
 {
-  int count, err_code, i, n_executed;
-  const char **sql;
-  T_CCI_QUERY_RESULT *result;
-  T_CCI_ERROR cci_error;
-  PyObject *p_tube;
-  PyObject *p_value;
-  PyObject *p_result;
-  PyObject *p_batch_result;
+  int res, handle = self->handle;
+  long gen;
 
-  if (!PyArg_ParseTuple (args, "O", &p_tube))
+  if (!PyArg_ParseTuple (args, ""))
     {
-      return handle_error (CUBRID_ER_INVALID_PARAM, NULL);
+      return NULL;
     }
-  if (!PyTuple_Check (p_tube))
+  if (handle <= 0 || !self->cancel_lock)
     {
-      return handle_error (CUBRID_ER_INVALID_PARAM, NULL);
+      Py_INCREF (Py_None);
+      return Py_None;
     }
-  count = PyTuple_GET_SIZE (p_tube);
-  if (count <= 0)
+
+  PyThread_acquire_lock (self->cancel_lock, WAIT_LOCK);
+  gen = self->running_gen;
+  if (gen)
     {
-      return handle_error (CUBRID_ER_INVALID_PARAM, NULL);
+      self->cancel_gen = gen;
     }
-  sql = (const char **) _cubrid_get_data_buf (CCI_U_TYPE_CHAR, count + 1);
-  if (NULL == sql)
+  PyThread_release_lock (self->cancel_lock);
+  if (!gen)
     {
-      return handle_error (CUBRID_ER_NO_MORE_MEMORY, NULL);
+      Py_INCREF (Py_None);
+      return Py_None;
     }
-  for (i = 0; i < count; ++i)
+
+  Py_BEGIN_ALLOW_THREADS
+  res = cci_cancel (handle);
+  Py_END_ALLOW_THREADS
+  if (res < 0)
     {
-      p_value = PyTuple_GET_ITEM (p_tube, i);
-      sql[i] = PyUnicode_AsUTF8 (p_value);
+      return handle_error (res, NULL);
     }
-  n_executed = cci_execute_batch (self->handle, count, (char**) sql, &result, &cci_error);
-  if (n_executed < 0)
+
+  Py_INCREF (Py_None);
+  return Py_None;
+}
+
+static char _cubrid_ConnectionObject_set_trace_callback__doc__[] =
+  "set_trace_callback(callback)\n\
+Call callback(sql, elapsed, rowcount) after each statement executed\n\
+through the connection, e.g. to record OpenTelemetry spans. sql is the\n\
+statement text, elapsed the execution time in seconds, and rowcount the\n\
+number of rows affected or selected, or -1 when the statement failed.\n\
+Exceptions raised by the callback are reported with sys.unraisablehook.\n\
+Pass None to remove the callback.";
+
+static PyObject *
+_cubrid_ConnectionObject_set_trace_callback (_cubrid_ConnectionObject * self,
+                                             PyObject * args)
+{
+  PyObject *callback;
+
+  if (!PyArg_ParseTuple (args, "O", &callback))
     {
-      free(sql);
-      return handle_error (n_executed, &cci_error);
+      return NULL;
     }
-  free(sql);
-  p_batch_result = PyTuple_New(n_executed);
-  for (i = 0; i < n_executed; ++i)
+
+  if (callback != Py_None && !PyCallable_Check (callback))
     {
-      p_result = PyDict_New();
-      err_code = PyDict_SetItemString(
-        p_result, "err_no", PyLong_FromLong(result[i].err_no));
-      if (result[i].err_no >= 0)
-        {
-          PyDict_SetItemString(
-            p_result, "err_msg", PyUnicode_FromString("success"));
-        }
-      else
-        {
-          PyDict_SetItemString(
-            p_result, "err_msg", PyUnicode_FromString(result[i].err_msg));
-        }
+      PyErr_SetString (PyExc_TypeError, "callback must be callable or None");
+      return NULL;
+    }
 
-      PyTuple_SetItem(p_batch_result, i, p_result);
+  Py_CLEAR (self->trace_callback);
+  if (callback != Py_None)
+    {
+      Py_INCREF (callback);
+      self->trace_callback = callback;
     }
 
-  err_code = cci_query_result_free (result, n_executed);
-  if (err_code < 0)
+  Py_INCREF (Py_None);
+  return Py_None;
+}
+
+static PyObject *
+_cubrid_ConnectionObject_end_tran (_cubrid_ConnectionObject * self, int type)
+{
+  int res;
+  T_CCI_ERROR error;
+
+  CUBRID_BEGIN_ALLOW_THREADS (self);
+  res = cci_end_tran (self->handle, type, &error);
+  CUBRID_END_ALLOW_THREADS (self);
+  if (res < 0)
     {
-      return handle_error (err_code, NULL);
+      return handle_error (res, &error);
     }
-  return p_batch_result;
+
+  Py_INCREF (Py_None);
+  return Py_None;
 }
 
+static char _cubrid_ConnectionObject_commit__doc__[] = "commit()\n\
+Commit any pending transaction to the database.\n\
+CUBRID can be set to perform automatic commits at each operation,\n\
+set_autocommit() and set_isolation_level().\n";
 
-static char _cubrid_ConnectionObject_last_insert_id__doc__[] = "insert_id()\n\
-This function returns the value with the IDs generated or the\n\
-AUTO_INCREMENT columns that were updated by the previous INSERT\n\
-query. It returns None if the previous query does not generate\n\
-new rows.\n\
-\n\
-Returns the value with the IDs generated for the AUTO_INCREMENT\n\
-columns that were updated by the previous INSERT query.\n\
+static PyObject *
+_cubrid_ConnectionObject_commit (_cubrid_ConnectionObject * self,
+                                 PyObject * args)
+{
+  if (!PyArg_ParseTuple (args, ""))
+    {
+      return NULL;
+    }
+
+  return _cubrid_ConnectionObject_end_tran (self, CCI_TRAN_COMMIT);
+}
+
+static char _cubrid_ConnectionObject_rollback__doc__[] = "rollback()\n\
+Roll back the start of any pending transaction to database. Closing\n\
+a connection without committing the changes first will cause an\n\
+implicit rollback to be performed.";
+
+static PyObject *
+_cubrid_ConnectionObject_rollback (_cubrid_ConnectionObject * self,
+                                   PyObject * args)
+{
+  if (!PyArg_ParseTuple (args, ""))
+    {
+      return NULL;
+    }
+
+  /* A rolled back DDL leaves the cached plans and metadata stale */
+  _cubrid_schema_changed (self);
+
+  return _cubrid_ConnectionObject_end_tran (self, CCI_TRAN_ROLLBACK);
+}
+
+static char _cubrid_ConnectionObject_server_version__doc__[] =
+  "server_version()\n\
+This function returns a string that represents the CUBRID server version.\n\
+Returns a string that represents the server version number.\n\
 \n\
 Example::\n\
   import _cubrid\n\
   con = _cubrid.connect(\"CUBRID:localhost:33000:demodb:::\", \"public\")\n\
-  cur = con.curosr()\n\
-  cur.prepare(\"create table test_cubrid(id NUMERIC\n\
-          AUTO_INCREMENT(10300, 1), name VARCHAR(50))\")\n\
-  cur.execute()\n\
-  cur.prepare(\"insert into test_cubrid(name) values ('Lily')\")\n\
-  cur.execute()\n\
-  print con.insert_id()\n\
-  cur.close()\n\
+  print con.server_version()\n\
   con.close()";
 
 static PyObject *
-_cubrid_ConnectionObject_last_insert_id (_cubrid_ConnectionObject * self,
+_cubrid_ConnectionObject_server_version (_cubrid_ConnectionObject * self,
                                          PyObject * args)
 {
-  char *name = NULL;
-  char ret[1024] = { '\0' };
   int res;
-  T_CCI_ERROR error;
-
-  /* cci_last_id set last_id as allocated string */
-  res = cci_get_last_insert_id (self->handle, &name, &error);
+  char db_ver[16];
 
-  if (res < 0)
+  if (!PyArg_ParseTuple (args, ""))
     {
-      return handle_error (res, &error);
+      return NULL;
     }
 
-  if (!name)
+  CUBRID_BEGIN_ALLOW_THREADS (self);
+  res = cci_get_db_version (self->handle, db_ver, sizeof (db_ver));
+  CUBRID_END_ALLOW_THREADS (self);
+  if (res < 0)
     {
-      Py_INCREF (Py_None);
-      return Py_None;
+      return handle_error (res, NULL);
     }
-  else
+
+  return PyUnicode_FromString (db_ver);
+}
+
+static char _cubrid_ConnectionObject_client_version__doc__[] =
+  "client_version()\n\
+This function returns a string that represents the client library version.\n\
+\n\
+Return a string that represents the CUBRID client library\n\
+\n\
+Example::\n\
+  import _cubrid\n\
+  con = _cubrid.connect(\"CUBRID:localhost:33000:demodb:::\", \"public\")\n\
+  print con.client_version()\n\
+  con.close()";
+
+static PyObject *
+_cubrid_ConnectionObject_client_version (_cubrid_ConnectionObject * self,
+                                         PyObject * args)
+{
+  char info[256];
+
+  if (!PyArg_ParseTuple (args, ""))
     {
-      strncpy (ret, name, sizeof (ret) - 1);
+      return NULL;
     }
 
-  return PyLong_FromString (ret, NULL, 10);
+  cci_get_version_string (info, sizeof (info));
+  // Remove the prefix "VERSION="
+  return PyUnicode_FromString (info + 8);
 }
 
+static char _cubrid_ConnectionObject_set_autocommit__doc__[] =
+  "set_autocommit(mode)\n\
+This function set the autocommit mode.\n\
+It can enable/disable the transaction management.\n\
+\n\
+mode: bool. It will be True/False\n\
+\n\
+Example::\n\
+  import _cubrid\n\
+  con = _cubrid.connect(\"CUBRID:localhost:33000:demodb:::\", \"public\")\n\
+  con.set_autocommit(True)\n\
+  print con.autocommit\n\
+  con.close()";
+
 static PyObject *
-_cubrid_ConnectionObject_schema_to_pyvalue (_cubrid_ConnectionObject * self,
-                                            int request, int type, int index)
+_cubrid_ConnectionObject_set_autocommit (_cubrid_ConnectionObject * self,
+                                         PyObject * args)
 {
-  int res, ind;
-  PyObject *val;
-  char *buffer;
-  int num;
+  PyObject *autocommit_obj;
+  int mode;
+  int res;
 
-  switch (type)
+  if (!PyArg_ParseTuple (args, "O!", &PyBool_Type, &autocommit_obj))
     {
-    case CCI_U_TYPE_INT:
-    case CCI_U_TYPE_SHORT:
-      res = cci_get_data (request, index, CCI_A_TYPE_INT, &num, &ind);
+      return handle_error (CUBRID_ER_INVALID_PARAM, NULL);
+    }
+  mode = PyObject_IsTrue (autocommit_obj);
+  if (mode != 0)
+    {
+      CUBRID_BEGIN_ALLOW_THREADS (self);
+      res = cci_set_autocommit (self->handle, CCI_AUTOCOMMIT_TRUE);
+      CUBRID_END_ALLOW_THREADS (self);
       if (res < 0)
         {
           return handle_error (res, NULL);
         }
-      if (ind < 0)
-        {
-          Py_INCREF (Py_None);
-          return Py_None;
-        }
-      else
-        {
-          val = PyLong_FromLong (num);
-        }
-      break;
-    default:
-      res = cci_get_data (request, index, CCI_A_TYPE_STR, &buffer, &ind);
+
+      self->autocommit = PyBool_FromLong (1);
+    }
+  else
+    {
+      CUBRID_BEGIN_ALLOW_THREADS (self);
+      res = cci_set_autocommit (self->handle, CCI_AUTOCOMMIT_FALSE);
+      CUBRID_END_ALLOW_THREADS (self);
       if (res < 0)
         {
           return handle_error (res, NULL);
         }
-      if (ind < 0)
-        {
-          Py_INCREF (Py_None);
-          return Py_None;
-        }
-      else
-        {
-          val = PyUnicode_FromString (buffer);
-        }
-      break;
+
+      self->autocommit = PyBool_FromLong (0);
     }
 
-  return val;
+  Py_INCREF (Py_None);
+  return Py_None;
 }
 
+static char _cubrid_ConnectionObject_set_isolation_level__doc__[] =
+  "set_isolation(isolation_level)\n\
+Set the transaction isolation level for the current session.\n\
+The level defines the different phenomena can happen in the\n\
+database between concurrent transactions.\n\
+\n\
+isolation_level maybe::\n\
+  CUBRID_REP_CLASS_COMMIT_INSTANCE\n\
+  CUBRID_REP_CLASS_REP_INSTANCE\n\
+  CUBRID_SERIALIZABLE\n\
+\n\
+Example::\n\
+  import _cubrid\n\
+  form _cubrid import *\n\
+  con = _cubrid.connect(\"CUBRID:localhost:33000:demodb:::\", \"public\")\n\
+  con.set_isolation_level(CUBRID_REP_CLASS_REP_INSTANCE)\n\
+  print con.isolation_level\n\
+  con.close()";
+
 static PyObject *
-_cubrid_ConnectionObject_fetch_schema (_cubrid_ConnectionObject * self,
-                                       int request, T_CCI_COL_INFO * col_info,
-                                       int col_count)
+_cubrid_ConnectionObject_set_isolation_level (_cubrid_ConnectionObject * self,
+                                              PyObject * args)
 {
-  int type;
-  PyObject *val, *row;
-  int i;
-
-  row = PyList_New (col_count);
+  int level, res;
+  T_CCI_ERROR error;
 
-  for (i = 0; i < col_count; i++)
+  if (!PyArg_ParseTuple (args, "i", &level))
     {
-      type = CCI_GET_RESULT_INFO_TYPE (col_info, i + 1);
-      val =
-        _cubrid_ConnectionObject_schema_to_pyvalue (self, request, type,
-                                                    i + 1);
+      return NULL;
+    }
 
-      PyList_SetItem (row, i, val);
+  CUBRID_BEGIN_ALLOW_THREADS (self);
+  res = cci_set_isolation_level (self->handle, level, &error);
+  CUBRID_END_ALLOW_THREADS (self);
+  if (res < 0)
+    {
+      return handle_error (res, &error);
     }
 
-  return row;
+  self->isolation_level =
+    PyUnicode_FromString (cubrid_isolation[level - 4].isolation);
+
+  Py_INCREF (Py_None);
+  return Py_None;
 }
 
-static char _cubrid_ConnectionObject_schema_info__doc__[] =
-  "schema_info(schema_type[,class_name[,attr_name]])\n\
-This function is used to get the requested schema information from\n\
-database. You have to designate class_name, if you want to get\n\
-information on certain class, attr_name, if you want to get\n\
-information on certain attribute (can be used only with\n\
-CUBRID_SCH_COLUMN_PRIVILEGE).\n\
-The following tables shows types of schema and the column structure\n\
-of the result::\n\
- ----------------------------------------------------------------------\n\
- Schema                      Col Number  Col Name        Value\n\
- ----------------------------------------------------------------------\n\
- CUBRID_SCH_TABLE                1       NAME\n\
-                                 2       TYPE            0:system table\n\
-                                                         1:viem\n\
-                                                         2:table\n\
- ----------------------------------------------------------------------\n\
- CUBRID_SCH_VIEW                 1       NAME\n\
-                                 2       TYPE            1:view\n\
- ----------------------------------------------------------------------\n\
- CUBRID_SCH_QUERY_SPEC           1       QUERY_SPEC\n\
- ----------------------------------------------------------------------\n\
- CUBRID_SCH_ATTRIBUTE            1       ATTR_NAME\n\
- CUBRID_SCH_TABLE_ATTRIBUTE      2       DOMAIN\n\
-                                 3       SCALE\n\
-                                 4       PRECISION\n\
-                                 5       INDEXED         1:indexed\n\
-                                 6       NOT NULL        1:not null\n\
-                                 7       SHARED          1:shared\n\
-                                 8       UNIQUE          1:uniqe\n\
-                                 9       DEFAULT\n\
-                                 10      ATTR_ORDER      1:base\n\
-                                 11      TABLE_NAME\n\
-                                 12      SOURCE_CLASS\n\
-                                 13      IS_KEY          1:key\n\
- ----------------------------------------------------------------------\n\
- CUBRID_SCH_METHOD               1       NAME\n\
- CUBRID_SCH_TABLE_METHOD         2       RET_DOMAIN\n\
-                                 3       ARG_DOMAIN\n\
- ----------------------------------------------------------------------\n\
- CUBRID_SCH_METHOD_FILE          1       METHOD_FILE\n\
- ----------------------------------------------------------------------\n\
- CUBRID_SCH_SUPERTABLE           1       TABLE_NAME\n\
- CUBRID_SCH_SUBTABLE             2       TYPE            0:system table\n\
- CUBRID_SCH_DIRECT_SUPER_TABLE                           1:view\n\
-                                                         2:table\n\
- ----------------------------------------------------------------------\n\
- CUBRID_SCH_CONSTRAINT           1       TYPE            0:unique\n\
-                                                         1:index\n\
-                                                         2:reverse unique\n\
-                                                         3:reverse index\n\
-                                 2       NAME\n\
-                                 3       ATTR_NAME\n\
-                                 4       NUM_PAGES\n\
-                                 5       NUM_KEYS\n\
-                                 6       PRIMARY_KEY     1:primary key\n\
-                                 7       KEY_ORDER       1:base\n\
- ----------------------------------------------------------------------\n\
- CUBRID_SCH_TRIGGER              1       NAME\n\
-                                 2       STATUS\n\
-                                 3       EVENT\n\
-                                 4       TARGET_TABLE\n\
-                                 5       TARGET_ATTR\n\
-                                 6       ACTION_TIME\n\
-                                 7       ACTION\n\
-                                 8       PRIORITY\n\
-                                 9       CONDITION_TIME\n\
-                                 10      CONDITION\n\
- ----------------------------------------------------------------------\n\
- CUBRID_SCH_TABLE_PRIVILEGE      1       TABLE_NAME\n\
-                                 2       PRIVILEGE\n\
-                                 3       GRANTABLE\n\
- ----------------------------------------------------------------------\n\
- CCI_SCH_ATTR_PRIVILEGE          1       ATTR_NAME\n\
-                                 2       PRIVILEGE\n\
-                                 3       GRANTABLE\n\
- ----------------------------------------------------------------------\n\
- CUBRID_SCH_PRIMARY_KEY          1       TABLE_NAME\n\
-                                 2       ATTR_NAME\n\
-                                 3       KEY_SEQ         1:base\n\
-                                 4       KEY_NAME\n\
- ----------------------------------------------------------------------\n\
- CUBRID_SCH_IMPORTED_KEYS        1       PKTABLE_NAME\n\
- CUBRID_SCH_EXPORTED_KEYS        2       PKCOLUMN_NAME\n\
- CUBRID_SCH_CROSS_REFERENCE      3       FKTABLE_NAME    1:base\n\
-                                 4       FKCOLUMN_NAME\n\
-                                 5       KEY_SEQ\n\
-                                 6       UPDATE_ACTION   0:cascade\n\
-                                                         1:restrict\n\
-                                                         2:no action\n\
-                                                         3:set null\n\
-                                 7       DELETE_ACTION   0:cascade\n\
-                                                         1:restrict\n\
-                                                         2:no action\n\
-                                                         3:set null\n\
-                                 8       FK_NAME\n\
-                                 9       PK_NAME\n\
- ----------------------------------------------------------------------\n\
-\n\
-Parameters::\n\
-  schema_type: schema type in the table\n\
-  table_name: string, table you want to know the schema of\n\
-  attr_name: string, attribute you want to know the schema of\n\
+static char _cubrid_ConnectionObject_ping__doc__[] = "ping()\n\
+Checks whether or not the connection to the server is working. This \n\
+function can be used by clients that remain idle for a long while,\n\
+to check whether or not the server has closed the connection and reconnect\n\
+if necessary.\n\
 \n\
 Return values::\n\
-  A tuple that contains the schema information when success\n\
-  None when fail\n\
+  1 when connected\n\
+  0 when not connect\n\
 \n\
 Example::\n\
   import _cubrid\n\
-  con = _cubrid.connect('CUBRID:localhost:33000:demodb:::', 'public')\n\
-  print con.schema_info(_cubrid.CUBRID_SCH_TABLE, 'test_cubrid')\n\
+  con = _cubrid.connect(\"CUBRID:localhost:33000:demodb:::\", \"public\")\n\
+  print con.ping()\n\
   con.close()";
 
 static PyObject *
-_cubrid_ConnectionObject_schema_info (_cubrid_ConnectionObject * self,
-                                      PyObject * args)
+_cubrid_ConnectionObject_ping (_cubrid_ConnectionObject * self,
+                               PyObject * args)
 {
-  int flag = 0, request, res, type;
+  int res;
   T_CCI_ERROR error;
-  char *class_name = NULL;
-  char *attr_name = NULL;
-  PyObject *result;
-  T_CCI_COL_INFO *col_info;
-  T_CCI_CUBRID_STMT sql_type;
-  int col_count;
+  char *query = "select 1+1 from db_root";
+  int req_handle = 0, result = 0, ind = 0;
+  int connected = 0;
 
-  if (!PyArg_ParseTuple (args, "is|s", &type, &class_name, &attr_name))
+  if (!PyArg_ParseTuple (args, ""))
     {
       return NULL;
     }
 
-  if (type > CCI_SCH_LAST || type < CCI_SCH_FIRST)
+  CUBRID_BEGIN_ALLOW_THREADS (self);
+  res = cci_prepare (self->handle, query, 0, &error);
+  CUBRID_END_ALLOW_THREADS (self);
+  if (res < 0)
     {
-      return handle_error (CUBRID_ER_SCHEMA_TYPE, NULL);
+      return handle_error (res, &error);
     }
 
-  switch (type)
-    {
-    case CCI_SCH_CLASS:
-    case CCI_SCH_VCLASS:
-      flag = CCI_CLASS_NAME_PATTERN_MATCH;
-      break;
-    case CCI_SCH_ATTRIBUTE:
-    case CCI_SCH_CLASS_ATTRIBUTE:
-      flag = CCI_ATTR_NAME_PATTERN_MATCH;
-      break;
-    default:
-      flag = 0;
-      break;
-    }
+  req_handle = res;
 
-  res =
-    cci_schema_info (self->handle, type, class_name, attr_name, (char) flag,
-                     &error);
+  CUBRID_BEGIN_ALLOW_THREADS (self);
+  res = cci_execute (req_handle, 0, 0, &error);
+  CUBRID_END_ALLOW_THREADS (self);
   if (res < 0)
     {
       return handle_error (res, &error);
     }
 
-  request = res;
-
-  col_info = cci_get_result_info (request, &sql_type, &col_count);
-  if (!col_info)
+  while (1)
     {
-      return handle_error (CUBRID_ER_CANNOT_GET_COLUMN_INFO, NULL);
+      CUBRID_BEGIN_ALLOW_THREADS (self);
+      res = cci_cursor (req_handle, 1, CCI_CURSOR_CURRENT, &error);
+      CUBRID_END_ALLOW_THREADS (self);
+      if (res == CCI_ER_NO_MORE_DATA)
+        {
+          break;
+        }
+      if (res < 0)
+        {
+          return handle_error (res, &error);
+        }
+
+      CUBRID_BEGIN_ALLOW_THREADS (self);
+      res = cci_fetch (req_handle, &error);
+      CUBRID_END_ALLOW_THREADS (self);
+      if (res < 0)
+        {
+          return handle_error (res, &error);
+        }
+
+      res = cci_get_data (req_handle, 1, CCI_A_TYPE_INT, &result, &ind);
+      if (res < 0)
+        {
+          return handle_error (res, &error);
+        }
+
+      if (result == 2)
+        {
+          connected = 1;
+        }
     }
 
-  res = cci_cursor (request, 1, CCI_CURSOR_CURRENT, &error);
-  if (res == CCI_ER_NO_MORE_DATA)
+  CUBRID_BEGIN_ALLOW_THREADS (self);
+  cci_close_req_handle (req_handle);
+  CUBRID_END_ALLOW_THREADS (self);
+  return PyLong_FromLong (connected);
+}
+
+static char *
+_cubrid_dup_buf (char *src_buf, int size)
+{
+  int len = 0;
+  char *temp_buf = NULL;
+
+  if (src_buf != NULL)
     {
-      Py_INCREF (Py_None);
-      return Py_None;
+      len = strlen (src_buf);
     }
-  if (res < 0)
+  else
     {
-      return handle_error (res, &error);
+      len = size;
     }
-
-  res = cci_fetch (request, &error);
-  if (res < 0)
+  if (len <= 0)
     {
-      return handle_error (res, &error);
+      return NULL;
     }
-
-  result =
-    _cubrid_ConnectionObject_fetch_schema (self, request, col_info,
-                                           col_count);
-
-  res = cci_cursor (request, 1, CCI_CURSOR_CURRENT, &error);
-  if (res < 0 && res != CCI_ER_NO_MORE_DATA)
+  temp_buf = (char *) malloc (len + 1);
+  if (NULL == temp_buf)
     {
-      return handle_error (res, &error);
+      return NULL;
     }
+  CUBRID_COUNT_ALLOC ();
+  memset (temp_buf, 0, len + 1);
+  if (NULL != src_buf)
+    memcpy (temp_buf, src_buf, len);
 
-  cci_close_req_handle (request);
+  return temp_buf;
+}
 
-  return result;
+static char *
+_cubrid_get_data_buf (int type, int num)
+{
+  switch (type)
+    {
+    case CCI_U_TYPE_BIT:
+    case CCI_U_TYPE_VARBIT:
+      return _cubrid_dup_buf (NULL, sizeof (T_CCI_BIT) * (num + 1));
+    default:
+      return _cubrid_dup_buf (NULL, sizeof (void *) * (num + 1));
+    }
 }
 
-static char _cubrid_ConnectionObject_escape_string__doc__[] =
-  "escape_string()\n\
-Escape special characters in a string for use in an SQL statement";
+static char _cubrid_ConnectionObject_batch_execute__doc__[] =
+  "batch_execute(statements[, compact])\n\
+Execute a sequence of SQL statements, without parameters, in a single\n\
+request. A statement that fails does not stop the others.\n\
+\n\
+Parameters::\n\
+  statements: sequence of str\n\
+  compact: bool, return the results as a list of ints (default False)\n\
+\n\
+Return values::\n\
+  Tuple with a dict per statement: ({'err_no': 0, 'err_msg': 'success'},)\n\
+  With compact, a list with the number of rows affected by each\n\
+  statement, or its (negative) error code if it failed.\n\
+\n\
+Example::\n\
+  import _cubrid\n\
+  con = _cubrid.connect(\"CUBRID:localhost:33000:demodb:::\", \"public\")\n\
+  sql = (\"insert into test value('1');\", \"insert into test value('2');\")\n\
+  err = con.batch_execute(sql)\n\
+  con.close()";
 
-static PyObject *
-_cubrid_ConnectionObject_escape_string (_cubrid_ConnectionObject * self,
-                                        PyObject * args)
+/*
+ * The statement array of batch_execute() comes from the connection arena.
+ * The array is used with the connection released, so a batch run from
+ * another thread meanwhile finds the arena busy and takes its array from
+ * the heap.
+ */
+static const char **
+_cubrid_ConnectionObject_batch_array (_cubrid_ConnectionObject * self,
+                                      int count, int *from_arena)
 {
-  char *unescape_string = NULL, *escape_string = NULL;
-  Py_ssize_t len = -1;
-  int res;
-  PyObject *op;
-  T_CCI_ERROR error;
+  const char **sql;
 
-  if (!PyArg_ParseTuple (args, "s#", &unescape_string, &len))
+  *from_arena = !self->arena_busy;
+  if (*from_arena)
     {
-      return NULL;
+      sql = _cubrid_arena_alloc (&self->arena, sizeof (char *) * (count + 1));
+      self->arena_busy = (sql != NULL);
+      return sql;
     }
 
-  if (len < 0)
+  sql = PyMem_Malloc (sizeof (char *) * (count + 1));
+  if (!sql)
     {
-      return handle_error (CUBRID_ER_INVALID_PARAM, NULL);
+      PyErr_NoMemory ();
+      return NULL;
     }
+  CUBRID_COUNT_ALLOC ();
+  return sql;
+}
 
-  escape_string = (char *) malloc (len * 2 + 16);
-
-  if (!escape_string)
+static void
+_cubrid_ConnectionObject_batch_array_free (_cubrid_ConnectionObject * self,
+                                           const char **sql, int from_arena)
+{
+  if (from_arena)
     {
-      return handle_error (CUBRID_ER_NO_MORE_MEMORY, NULL);
+      _cubrid_arena_reset (&self->arena);
+      self->arena_busy = 0;
     }
-
-  memset (escape_string, 0, len * 2 + 16);
-
-  if ((res = cci_escape_string (self->handle,
-                                escape_string, unescape_string, len,
-                                &error)) < 0)
+  else
     {
-      free (escape_string);
-      return handle_error (res, &error);
+      PyMem_Free ((void *) sql);
     }
-
-  op = PyUnicode_FromStringAndSize (escape_string, res);
-
-  free (escape_string);
-
-  return op;
 }
 
-static char _cubrid_ConnectionObject_close__doc__[] = "close()\n\
-Close the connection now.";
-
 static PyObject *
-_cubrid_ConnectionObject_close (_cubrid_ConnectionObject * self,
-                                PyObject * args)
+_cubrid_ConnectionObject_batch_execute (_cubrid_ConnectionObject * self,
+                               PyObject * args)
 {
-  T_CCI_ERROR error;
-  int err_code;
-  if(self->handle <= 0)
-    {
-      Py_INCREF (Py_None);
-      return Py_None;
-    }
-  err_code = cci_disconnect (self->handle, &error);
-  if (err_code < 0)
-    {
-      return handle_error (err_code, &error);
-    }
-  self->handle = 0;
-  if (self->url)
-    {
-      free (self->url);
-      self->url = NULL;
-    }
-
-  if (self->user)
-    {
-      free (self->user);
-      self->user = NULL;
-    }
+  int count, err_code, i, n_executed, compact = 0, from_arena, canceled;
+  long gen;
+  const char **sql;
+  T_CCI_QUERY_RESULT *result;
+  T_CCI_ERROR cci_error;
+  PyObject *p_seq, *p_tube;
+  PyObject *p_value;
+  PyObject *p_result;
+  PyObject *p_batch_result;
 
-  if (self->isolation_level)
+  if (!PyArg_ParseTuple (args, "O|i", &p_seq, &compact))
     {
-      Py_DECREF (self->isolation_level);
-      self->isolation_level = NULL;
+      return handle_error (CUBRID_ER_INVALID_PARAM, NULL);
     }
-
-  if (self->autocommit)
+  if (!PySequence_Check (p_seq) || PyUnicode_Check (p_seq))
     {
-      Py_DECREF (self->autocommit);
-      self->autocommit = NULL;
+      return handle_error (CUBRID_ER_INVALID_PARAM, NULL);
     }
-
-  Py_INCREF (Py_None);
-  return Py_None;
-}
-
-static void
-_cubrid_ConnectionObject_dealloc (_cubrid_ConnectionObject * self)
-{
-  PyObject *o;
-
-  o = _cubrid_ConnectionObject_close (self, NULL);
-  Py_XDECREF (o);
-
-  Py_TYPE (self)->tp_free ((PyObject *) self);
-}
-
-static PyObject *
-_cubrid_CursorObject_new (PyTypeObject * type, PyObject * args,
-                          PyObject * kwargs)
-{
-  _cubrid_CursorObject *self;
-
-  self = (_cubrid_CursorObject *) type->tp_alloc (type, 0);
-  if (!self)
+  p_tube = PySequence_Fast (p_seq, "statements must be a sequence");
+  if (!p_tube)
     {
       return NULL;
     }
-
-  return (PyObject *) self;
-}
-
-static int
-_cubrid_CursorObject_init (_cubrid_CursorObject * self, PyObject * args,
-                           PyObject * kwargs)
-{
-  _cubrid_ConnectionObject *conn;
-
-  if (!PyArg_ParseTuple (args, "O!", &_cubrid_ConnectionObject_type, &conn))
+  if (PySequence_Fast_GET_SIZE (p_tube) > INT_MAX)
     {
-      return -1;
+      Py_DECREF (p_tube);
+      return handle_error (CUBRID_ER_INVALID_PARAM, NULL);
     }
-
-  Py_INCREF (conn);
-
-  self->state = CURSOR_STATE_OPENED;
-  self->handle = 0;
-  self->connection = conn->handle;
-  Py_INCREF (Py_None);
-  self->description = Py_None;
-  self->bind_num = -1;
-  self->col_count = -1;
-  self->sql_type = 0;
-  self->row_count = -1;
-  self->cursor_pos = 0;
-
-  memset (self->charset, 0, sizeof (self->charset));
-  strncpy(self->charset, "utf8", sizeof (self->charset) - 1);
-
-  return 0;
-}
-
-static char _cubrid_CursorObject_set_charset__doc__[] =
-  "Set the charset name used by the cursor object. Default value is utf8.";
-
-static PyObject *
-_cubrid_CursorObject_set_charset (_cubrid_CursorObject * self, PyObject * args)
-{
-  char *charset = NULL;
-
-  if (self->state == CURSOR_STATE_CLOSED)
+  count = (int) PySequence_Fast_GET_SIZE (p_tube);
+  if (count <= 0)
     {
-      return handle_error (CUBRID_ER_INVALID_CURSOR, NULL);
+      Py_DECREF (p_tube);
+      return handle_error (CUBRID_ER_INVALID_PARAM, NULL);
     }
-  if (!PyArg_ParseTuple (args, "s", &charset))
+  sql = _cubrid_ConnectionObject_batch_array (self, count, &from_arena);
+  if (NULL == sql)
     {
+      Py_DECREF (p_tube);
       return NULL;
     }
-
-  if (charset != NULL && *charset != '\0')
-    {
-      snprintf (self->charset, sizeof (self->charset), "%s", charset);
-    }
-
-  Py_INCREF (Py_None);
-  return Py_None;
-
-}
-
-
-static void
-_cubrid_CursorObject_reset (_cubrid_CursorObject * self)
-{
-  if (self->handle)
+  /* The UTF-8 buffers belong to the str items, which p_tube keeps alive */
+  for (i = 0; i < count; ++i)
     {
-      cci_close_req_handle (self->handle);
-      self->handle = 0;
-
-      if (self->description)
+      p_value = PySequence_Fast_GET_ITEM (p_tube, i);
+      if (!PyUnicode_Check (p_value))
         {
-          Py_DECREF (self->description);
-          self->description = NULL;
+          _cubrid_ConnectionObject_batch_array_free (self, sql, from_arena);
+          Py_DECREF (p_tube);
+          return handle_error (CUBRID_ER_INVALID_PARAM, NULL);
+        }
+      sql[i] = PyUnicode_AsUTF8 (p_value);
+      if (!sql[i])
+        {
+          _cubrid_ConnectionObject_batch_array_free (self, sql, from_arena);
+          Py_DECREF (p_tube);
+          return NULL;
         }
-      self->bind_num = -1;
-      self->col_count = -1;
-      self->sql_type = 0;
-      self->row_count = -1;
-      self->cursor_pos = 0;
     }
-}
-
-static char _cubrid_CursorObject_prepare__doc__[] = "prepare(sql)\n\
-This function creates a prepared statement. A prepared statement is a\n\
-server-side object that can be used to optimize performance. You can \n\
-use this statement effectively to execute repeatedly or to process \n\
-long data. Only a single statement can be used. The SQL statement can \n\
-contain zero or more question mark (?) parameter markers for which real \n\
-values will be substituted when the statement is executed. Add a \n\
-parameter when you bind a value in the VALUES clause of INSERT statement \n\
-or in the WHERE clause.\n\
-\n\
-sql: string, the sql statement you want to execute.";
-
-static PyObject *
-_cubrid_CursorObject_prepare (_cubrid_CursorObject * self, PyObject * args)
-{
-  int res;
-  T_CCI_ERROR error;
-  char *stmt = "";
-
-  if (self->state == CURSOR_STATE_CLOSED)
+  gen = _cubrid_exec_begin (self);
+  CUBRID_BEGIN_ALLOW_THREADS (self);
+  if (_cubrid_exec_canceled (self, gen))
     {
-      return handle_error (CUBRID_ER_INVALID_CURSOR, NULL);
+      n_executed = CUBRID_ER_QUERY_CANCELED;
     }
-  if (!PyArg_ParseTuple (args, "s", &stmt))
+  else
     {
-      return NULL;
+      n_executed = cci_execute_batch (self->handle, count, (char **) sql,
+                                      &result, &cci_error);
     }
-
-  _cubrid_CursorObject_reset (self);
-  res = cci_prepare (self->connection, stmt, 0, &error);
-  if (res < 0)
+  CUBRID_END_ALLOW_THREADS (self);
+  canceled = _cubrid_exec_end (self, gen);
+  _cubrid_ConnectionObject_batch_array_free (self, sql, from_arena);
+  Py_DECREF (p_tube);
+  if (n_executed < 0)
     {
-      return handle_error (res, &error);
+      return handle_execute_error (n_executed, &cci_error, canceled);
     }
-  self->handle = res;
-  self->bind_num = cci_get_bind_num (res);
-  Py_INCREF (Py_None);
-  return Py_None;
-}
-
-static char _cubrid_CursorObject_bind_param__doc__[] =
-  "bind_param(index, value, bind_type=None)\n\
-This function is used to bind a value to a prepared statement variable. It supports\n\
-binding of various Python data types, including int, float, str (encoded as bytes),\n\
-date, time, and datetime objects, in addition to handling BLOB/CLOB types.\n\
-\n\
-In a CUBRID shard environment, specifying the bind_type is recommended for\n\
-optimal performance and compatibility.\n\
-\n\
-Supported Python types for binding include:\n\
-  - int (mapped to CUBRID INT or BIGINT based on size)\n\
-  - float (mapped to CUBRID FLOAT or DOUBLE)\n\
-  - decimal.Decimal (mapped to CUBRID NUMERIC)\n\
-  - str (encoded as UTF-8 bytes, mapped to CUBRID CHAR or STRING types)\n\
-  - bytes (directly mapped to CUBRID BIT or BIT VARYING based on bind_type)\n\
-  - date (mapped to CUBRID DATE)\n\
-  - time (mapped to CUBRID TIME)\n\
-  - datetime (mapped to CUBRID TIMESTAMP)\n\
-\n\
-The function automatically determines the appropriate CUBRID data type based on\n\
-the Python type of the value argument, unless the bind_type is explicitly specified.\n\
-\n\
-Parameters:\n\
-  index (int): The index of the variable in the prepared statement to bind the value to.\n\
-  value: The Python object to bind to the variable. Supported types include int, float,\n\
-         decimal.Decimal, str, bytes, date, time, and datetime.\n\
-  bind_type (optional): The CUBRID column type to bind the value as. This parameter\n\
-                        is optional and is recommended for use in specific scenarios\n\
-                        where the automatic type resolution needs to be overridden.\n\
-\n\
-Returns:\n\
-  None: This function does not return a value.\n\
-\n\
-Raises:\n\
-  ValueError: If an unsupported type is passed or if the function encounters\n\
-              an error while binding the value.\n";
-
-static PyObject *
-_cubrid_CursorObject_bind_param (_cubrid_CursorObject * self, PyObject * args)
-{
-  int res, index = -1;
-  PyObject *temp_bytes = NULL; // Used when the second argument is str or decimal.Decimal
-  PyObject *temp_str = NULL;   // Used when the second argument is decimal.Decimal
-  PyObject *value_obj = NULL;  // Use PyObject* to accept any object type
-  Py_buffer value_view = {NULL, NULL}; // For obtaining a view on the object as bytes
-  int bind_type = 0;
-  void *bind_value;
-  int u_type = CCI_U_TYPE_CHAR;
-  int a_type = CCI_A_TYPE_STR;
-  long long_value;
-  int64_t int64_value;
-  double double_value;
-  char *str_value = NULL;
-  T_CCI_DATE date_value;
-  T_CCI_BIT bit_value;
 
-  if (self->state == CURSOR_STATE_CLOSED)
+  if (compact)
     {
-      return handle_error (CUBRID_ER_INVALID_CURSOR, NULL);
+      p_batch_result = PyList_New (n_executed);
     }
-  if (!self->handle)
+  else
     {
-      return handle_error (CUBRID_ER_SQL_UNPREPARE, NULL);
+      p_batch_result = PyTuple_New (n_executed);
     }
-
-  if (!PyArg_ParseTuple(args, "iO|i", &index, &value_obj, &bind_type))
+  if (!p_batch_result)
     {
+      cci_query_result_free (result, n_executed);
       return NULL;
     }
-
-  if (bind_type != 0)
-    {
-      u_type = bind_type;
-    }
-
-  // Handling for int type
-  if (PyLong_Check(value_obj))
+  for (i = 0; i < n_executed; ++i)
     {
-      if (u_type == CCI_U_TYPE_BIGINT)
+      if (_cubrid_stmt_changes_schema (result[i].stmt_type))
         {
-          int64_value = PyLong_AsLongLong(value_obj);
-          if (int64_value == -1 && PyErr_Occurred())
-            {
-              PyErr_SetString(PyExc_OverflowError, "Python int out of range of C int64_t");
-              return NULL;
-            }
-          bind_value = &int64_value;
-          a_type = CCI_A_TYPE_BIGINT;
+          _cubrid_schema_changed (self);
         }
-      else
+
+      if (compact)
         {
-          long_value = PyLong_AsLong(value_obj);
-          if (long_value == -1 && PyErr_Occurred())
+          p_result = PyLong_FromLong (result[i].err_no < 0 ?
+                                      result[i].err_no :
+                                      result[i].result_count);
+          if (!p_result)
             {
-              PyErr_SetString(PyExc_OverflowError, "Python int out of range of C long");
+              Py_DECREF (p_batch_result);
+              cci_query_result_free (result, n_executed);
               return NULL;
             }
-          bind_value = &long_value;
-          u_type = CCI_U_TYPE_INT;
-          a_type = CCI_A_TYPE_INT;
+          PyList_SET_ITEM (p_batch_result, i, p_result);
+          continue;
         }
-    }
-  // Handling for float type
-  else if (PyFloat_Check(value_obj))
-    {
-      double_value = PyFloat_AsDouble(value_obj);
-      bind_value = &double_value;
-      a_type = CCI_A_TYPE_DOUBLE;
-      u_type = CCI_U_TYPE_DOUBLE;
-    }
-  else if (PyObject_IsInstance(value_obj, DecimalType))
-    {
-      temp_str = PyObject_Str(value_obj); // Convert Decimal to str
-      if (!temp_str)
+
+      p_result = PyDict_New();
+      if (!p_result)
         {
+          Py_DECREF (p_batch_result);
+          cci_query_result_free (result, n_executed);
           return NULL;
         }
-      temp_bytes = PyUnicode_AsEncodedString(temp_str, "utf-8", "strict");
-      if (!temp_bytes)
+      p_value = PyLong_FromLong (result[i].err_no);
+      PyDict_SetItemString (p_result, "err_no", p_value);
+      Py_XDECREF (p_value);
+      if (result[i].err_no >= 0)
         {
-          Py_DECREF(temp_str);
-          return NULL;
+          p_value = PyUnicode_FromString ("success");
         }
-      str_value = PyBytes_AsString(temp_bytes);
-      if (!str_value)
+      else
         {
-          Py_DECREF(temp_str);
-          Py_DECREF(temp_bytes);
-          return NULL;
+          p_value = PyUnicode_FromString (result[i].err_msg ?
+                                          result[i].err_msg : "");
         }
-      bind_value = str_value;
-      u_type = CCI_U_TYPE_NUMERIC;
-      a_type = CCI_A_TYPE_STR;
+      PyDict_SetItemString (p_result, "err_msg", p_value);
+      Py_XDECREF (p_value);
+
+      PyTuple_SET_ITEM (p_batch_result, i, p_result);
     }
-  else if (PyDate_Check(value_obj) || PyTime_Check(value_obj) || PyDateTime_Check(value_obj))
-    {
-      if (PyDate_Check(value_obj) || PyDateTime_Check(value_obj))
-        {
-          date_value.yr = PyDateTime_GET_YEAR(value_obj);
-          date_value.mon = PyDateTime_GET_MONTH(value_obj);
-          date_value.day = PyDateTime_GET_DAY(value_obj);
-        }
 
-      if (PyDateTime_Check(value_obj))
-        {
-          date_value.hh = PyDateTime_DATE_GET_HOUR(value_obj);
-          date_value.mm = PyDateTime_DATE_GET_MINUTE(value_obj);
-          date_value.ss = PyDateTime_DATE_GET_SECOND(value_obj);
-          date_value.ms = PyDateTime_DATE_GET_MICROSECOND(value_obj) / 1000;
-        }
-      else if (PyTime_Check(value_obj))
-        {
-          date_value.hh = PyDateTime_TIME_GET_HOUR(value_obj);
-          date_value.mm = PyDateTime_TIME_GET_MINUTE(value_obj);
-          date_value.ss = PyDateTime_TIME_GET_SECOND(value_obj);
-          date_value.ms = PyDateTime_TIME_GET_MICROSECOND(value_obj) / 1000;
-        }
-
-      bind_value = &date_value;
-      a_type = CCI_A_TYPE_DATE;
-      if (PyDate_Check(value_obj))
-        {
-          u_type = CCI_U_TYPE_DATE;
-        }
-      if (PyTime_Check(value_obj))
-        {
-          u_type = CCI_U_TYPE_TIME;
-        }
-      if (PyDateTime_Check(value_obj))
-        {
-          u_type= CCI_U_TYPE_DATETIME;
-        }
-    }
-  // Check if the second argument is a string and encode it to bytes if necessary
-  else if (PyUnicode_Check(value_obj))
-    {
-      // value_obj is a Unicode object (str in Python 3), encode it to bytes
-      temp_bytes = PyUnicode_AsEncodedString(value_obj, "utf-8", "strict");
-      if (!temp_bytes)
-        {
-          // Encoding failed, return NULL
-          return NULL;
-        }
-      // Successfully encoded the string to bytes, now get the buffer
-      if (PyObject_GetBuffer(temp_bytes, &value_view, PyBUF_SIMPLE) != 0)
-        {
-          Py_DECREF(temp_bytes); // Don't forget to decrement the reference count
-          return NULL; // Unable to get buffer
-        }
-
-      bind_value = value_view.buf;
-    }
-  else if (PyBytes_Check(value_obj))
-    {
-      if (PyObject_GetBuffer(value_obj, &value_view, PyBUF_SIMPLE) != 0)
-        {
-          return NULL;
-        }
-
-      if (u_type == CCI_U_TYPE_BIT || u_type == CCI_U_TYPE_VARBIT)
-        {
-          bit_value.size = value_view.len; // Set the size of the data
-          bit_value.buf = value_view.buf; // Point to the actual data
-          bind_value = &bit_value; // Bind the structure instead of the buffer
-          a_type = CCI_A_TYPE_BIT;
-        }
-      else
-        {
-          bind_value = value_view.buf;
-        }
-    }
-  else
-    {
-      return NULL;
-    }
-
-  res = cci_bind_param(self->handle, index, a_type, bind_value, u_type, 0);
-
-  PyBuffer_Release(&value_view); // Always release the buffer after use
-
-  // If temp_bytes was used, decrement its reference count after the buffer is released
-  if (temp_bytes)
-    {
-      Py_DECREF (temp_bytes);
-    }
-
-  if (temp_str)
-    {
-      Py_DECREF (temp_str);
-    }
-
-  if (res < 0)
+  err_code = cci_query_result_free (result, n_executed);
+  if (err_code < 0)
     {
-      return handle_error (res, NULL);
+      Py_DECREF (p_batch_result);
+      return handle_error (err_code, NULL);
     }
-
-  Py_INCREF (Py_None);
-  return Py_None;
+  return p_batch_result;
 }
 
-static char _cubrid_CursorObject_bind_lob__doc__[] = "bind_lob(n, lob)\n\
-bind BLOB/CLOB type in prepare() variable.\n\
+
+static char _cubrid_ConnectionObject_last_insert_id__doc__[] = "insert_id()\n\
+This function returns the value with the IDs generated or the\n\
+AUTO_INCREMENT columns that were updated by the previous INSERT\n\
+query. It returns None if the previous query does not generate\n\
+new rows.\n\
 \n\
-Parameters::\n\
-  index: string, actual value for binding\n\
-  lob: LOB Object\n\
+Returns the value with the IDs generated for the AUTO_INCREMENT\n\
+columns that were updated by the previous INSERT query.\n\
 \n\
 Example::\n\
   import _cubrid\n\
-  con = _cubrid.connect('CUBRID:localhost:33000:demodb:::', 'public')\n\
-  cur = con.cursor()\n\
-  \n\
-  cur.prepare('create table test_blob(image BLOB)')\n\
-  cur.execute()\n\
-  cur.prepare('create table test_clob(image CLOB)')\n\
-  cur.execute()\n\
-  \n\
-  lob = con.lob()\n\
-  \n\
-  cur.prepare('insert into test_blob values (?)')\n\
-  lob.imports('123.jpg') # or lob.imports('123.jpg', 'B')\n\
-  cur.bind_lob(1, lob)\n\
+  con = _cubrid.connect(\"CUBRID:localhost:33000:demodb:::\", \"public\")\n\
+  cur = con.curosr()\n\
+  cur.prepare(\"create table test_cubrid(id NUMERIC\n\
+          AUTO_INCREMENT(10300, 1), name VARCHAR(50))\")\n\
   cur.execute()\n\
-  lob.close()\n\
-  \n\
-  cur.prepare('insert into test_clob values (?)')\n\
-  lob.imports('123.jpg', 'C')\n\
-  cur.bind_lob(1, lob)\n\
+  cur.prepare(\"insert into test_cubrid(name) values ('Lily')\")\n\
   cur.execute()\n\
-  lob.close()\n\
-  \n\
+  print con.insert_id()\n\
   cur.close()\n\
   con.close()";
 
 static PyObject *
-_cubrid_CursorObject_bind_lob (_cubrid_CursorObject * self, PyObject * args)
+_cubrid_ConnectionObject_last_insert_id (_cubrid_ConnectionObject * self,
+                                         PyObject * args)
 {
-  _cubrid_LobObject *lob;
-  int index, res;
+  char *name = NULL;
+  char ret[1024] = { '\0' };
+  int res;
+  T_CCI_ERROR error;
 
-  if (self->state == CURSOR_STATE_CLOSED)
-    {
-      return handle_error (CUBRID_ER_INVALID_CURSOR, NULL);
-    }
-  if (!PyArg_ParseTuple (args, "iO!", &index, &_cubrid_LobObject_type, &lob))
+  /* cci_last_id set last_id as allocated string */
+  CUBRID_BEGIN_ALLOW_THREADS (self);
+  res = cci_get_last_insert_id (self->handle, &name, &error);
+  CUBRID_END_ALLOW_THREADS (self);
+
+  if (res < 0)
     {
-      return NULL;
+      return handle_error (res, &error);
     }
 
-  if (lob->type == CUBRID_BLOB)
+  if (!name)
     {
-      res =
-        cci_bind_param (self->handle, index, CCI_A_TYPE_BLOB,
-                        (void *) lob->blob, CCI_U_TYPE_BLOB, CCI_BIND_PTR);
-      if (res < 0)
-        {
-          return handle_error (res, NULL);
-        }
+      Py_INCREF (Py_None);
+      return Py_None;
     }
   else
     {
-      res =
-        cci_bind_param (self->handle, index, CCI_A_TYPE_CLOB,
-                        (void *) lob->clob, CCI_U_TYPE_CLOB, CCI_BIND_PTR);
-      if (res < 0)
-        {
-          return handle_error (res, NULL);
-        }
+      strncpy (ret, name, sizeof (ret) - 1);
     }
 
-  Py_INCREF (Py_None);
-  return Py_None;
+  return PyLong_FromString (ret, NULL, 10);
 }
 
-static char _cubrid_CursorObject_bind_set__doc__[] = "bind_set(index,data)\n\
-bind_set LIST/SET/MULTISET data. To use this function.\n\
-index:actual value for binding\n\
-data:tuple object \n\
-\n\
-    Example::\n\
-    con = _cubrid.connect('CUBRID:localhost:30000:demodb:dba::')\n\
-    c = con.cursor()\n\
-    s = con.set()\n\
-    value = ('1','2')\n\
-    s.imports(value ,cubrid_db.CCI_U_TYPE_INT)\n\
-    c.prepare('''INSERT INTO set_tbl_int VALUES(?);''')\n\
-    c.bind_set(1,s)\n\
-    c.execute()\n\
-    con.commit()\n\
-    c.close()\n\
-    con.close()";
-
 static PyObject *
-_cubrid_CursorObject_bind_Set (_cubrid_CursorObject * self, PyObject * args)
+_cubrid_ConnectionObject_schema_to_pyvalue (_cubrid_ConnectionObject * self,
+                                            int request, int type, int index)
 {
-  _cubrid_SetObject *set;
-  int index, res;
-
-  if (self->state == CURSOR_STATE_CLOSED)
-    {
-      return handle_error (CUBRID_ER_INVALID_CURSOR, NULL);
-    }
-  if (!PyArg_ParseTuple (args, "iO!", &index, &_cubrid_SetObject_type, &set))
-    {
-      return handle_error (CUBRID_ER_INVALID_PARAM, NULL);
-    }
+  int res, ind;
+  PyObject *val;
+  char *buffer;
+  int num;
 
-  res =
-    cci_bind_param (self->handle, index, CCI_A_TYPE_SET,
-                    (void *) set->data, CCI_U_TYPE_SET, CCI_BIND_PTR);
-  if (res < 0)
+  switch (type)
     {
-      return handle_error (res, NULL);
+    case CCI_U_TYPE_INT:
+    case CCI_U_TYPE_SHORT:
+      res = cci_get_data (request, index, CCI_A_TYPE_INT, &num, &ind);
+      if (res < 0)
+        {
+          return handle_error (res, NULL);
+        }
+      if (ind < 0)
+        {
+          Py_INCREF (Py_None);
+          return Py_None;
+        }
+      else
+        {
+          val = PyLong_FromLong (num);
+        }
+      break;
+    default:
+      res = cci_get_data (request, index, CCI_A_TYPE_STR, &buffer, &ind);
+      if (res < 0)
+        {
+          return handle_error (res, NULL);
+        }
+      if (ind < 0)
+        {
+          Py_INCREF (Py_None);
+          return Py_None;
+        }
+      else
+        {
+          val = PyUnicode_FromString (buffer);
+        }
+      break;
     }
 
-  Py_INCREF (Py_None);
-  return Py_None;
+  return val;
 }
 
-static void
-_cubrid_CursorObject_set_description (_cubrid_CursorObject * self)
+static PyObject *
+_cubrid_ConnectionObject_fetch_schema (_cubrid_ConnectionObject * self,
+                                       int request, T_CCI_COL_INFO * col_info,
+                                       int col_count)
 {
-  PyObject *desc, *item;
+  int type;
+  PyObject *val, *row;
   int i;
-  int datatype, precision, scale, nullable;
-
-  if (self->state == CURSOR_STATE_CLOSED)
-    {
-      return;
-    }
-  if (self->col_count == 0)
-    {
-      Py_XDECREF (self->description);
-      self->description = PyTuple_New (0);
-      return;
-    }
 
-  desc = (PyObject *) PyTuple_New (self->col_count);
+  row = PyList_New (col_count);
 
-  for (i = 1; i <= self->col_count; i++)
+  for (i = 0; i < col_count; i++)
     {
-      char *colName = NULL;
+      type = CCI_GET_RESULT_INFO_TYPE (col_info, i + 1);
+      val =
+        _cubrid_ConnectionObject_schema_to_pyvalue (self, request, type,
+                                                    i + 1);
 
-      item = PyTuple_New (7);
+      PyList_SetItem (row, i, val);
+    }
 
-      colName = CCI_GET_RESULT_INFO_NAME (self->col_info, i);
-      precision = CCI_GET_RESULT_INFO_PRECISION (self->col_info, i);
-      scale = CCI_GET_RESULT_INFO_SCALE (self->col_info, i);
-      nullable =
-        (CCI_GET_RESULT_INFO_IS_NON_NULL (self->col_info, i)) ? 0 : 1;
-      datatype = CCI_GET_RESULT_INFO_TYPE (self->col_info, i);
+  return row;
+}
 
-      PyTuple_SetItem (item, 0, PyUnicode_FromString (colName));
-      PyTuple_SetItem (item, 1, PyLong_FromLong (datatype));
-      PyTuple_SetItem (item, 2, PyLong_FromLong (0));
-      PyTuple_SetItem (item, 3, PyLong_FromLong (0));
-      PyTuple_SetItem (item, 4, PyLong_FromLong (precision));
-      PyTuple_SetItem (item, 5, PyLong_FromLong (scale));
-      PyTuple_SetItem (item, 6, PyLong_FromLong (nullable));
-
-      PyTuple_SetItem (desc, i - 1, item);
-    }
-
-  Py_XDECREF (self->description);
-  self->description = desc;
-}
-
-static char _cubrid_CursorObject_result_info__doc__[] = "result_info(n)\n\
-returns a sequence of 15-item sequences.\n\
-Each of these sequence contails information describing one result column::\n\
- (datatype,\n\
-  scale,\n\
-  precision,\n\
-  col_name,\n\
-  attr_name,\n\
-  class_name,\n\
-  not_null,\n\
-  default_value,\n\
-  auto_increment,\n\
-  unique_key,\n\
-  primary_key,\n\
-  foreign_key,\n\
-  reverse_index,\n\
-  reverse_unique,\n\
-  shared)\n\
-values of datatype will map the following::\n\
-  char                 1\n\
-  string,varchar       2\n\
-  nchar                3\n\
-  varnchar             4\n\
-  bit                  5\n\
-  varbit               6\n\
-  numeric              7\n\
-  int                  8\n\
-  short                9\n\
-  monetary             10\n\
-  float                11\n\
-  double               12\n\
-  date                 13\n\
-  time                 14\n\
-  timestamp            15\n\
-  object               19\n\
-  set                  32\n\
-  multiset             64\n\
-  sequence             96\n\
-This function will return none if there is no result set.\n\
-If user not specifies the parameter row, it will return all\n\
-column's information.\n\
-If user specify row, it will return the specified column's information.\n\
+static char _cubrid_ConnectionObject_schema_info__doc__[] =
+  "schema_info(schema_type[,class_name[,attr_name]])\n\
+This function is used to get the requested schema information from\n\
+database. You have to designate class_name, if you want to get\n\
+information on certain class, attr_name, if you want to get\n\
+information on certain attribute (can be used only with\n\
+CUBRID_SCH_COLUMN_PRIVILEGE).\n\
+The following tables shows types of schema and the column structure\n\
+of the result::\n\
+ ----------------------------------------------------------------------\n\
+ Schema                      Col Number  Col Name        Value\n\
+ ----------------------------------------------------------------------\n\
+ CUBRID_SCH_TABLE                1       NAME\n\
+                                 2       TYPE            0:system table\n\
+                                                         1:viem\n\
+                                                         2:table\n\
+ ----------------------------------------------------------------------\n\
+ CUBRID_SCH_VIEW                 1       NAME\n\
+                                 2       TYPE            1:view\n\
+ ----------------------------------------------------------------------\n\
+ CUBRID_SCH_QUERY_SPEC           1       QUERY_SPEC\n\
+ ----------------------------------------------------------------------\n\
+ CUBRID_SCH_ATTRIBUTE            1       ATTR_NAME\n\
+ CUBRID_SCH_TABLE_ATTRIBUTE      2       DOMAIN\n\
+                                 3       SCALE\n\
+                                 4       PRECISION\n\
+                                 5       INDEXED         1:indexed\n\
+                                 6       NOT NULL        1:not null\n\
+                                 7       SHARED          1:shared\n\
+                                 8       UNIQUE          1:uniqe\n\
+                                 9       DEFAULT\n\
+                                 10      ATTR_ORDER      1:base\n\
+                                 11      TABLE_NAME\n\
+                                 12      SOURCE_CLASS\n\
+                                 13      IS_KEY          1:key\n\
+ ----------------------------------------------------------------------\n\
+ CUBRID_SCH_METHOD               1       NAME\n\
+ CUBRID_SCH_TABLE_METHOD         2       RET_DOMAIN\n\
+                                 3       ARG_DOMAIN\n\
+ ----------------------------------------------------------------------\n\
+ CUBRID_SCH_METHOD_FILE          1       METHOD_FILE\n\
+ ----------------------------------------------------------------------\n\
+ CUBRID_SCH_SUPERTABLE           1       TABLE_NAME\n\
+ CUBRID_SCH_SUBTABLE             2       TYPE            0:system table\n\
+ CUBRID_SCH_DIRECT_SUPER_TABLE                           1:view\n\
+                                                         2:table\n\
+ ----------------------------------------------------------------------\n\
+ CUBRID_SCH_CONSTRAINT           1       TYPE            0:unique\n\
+                                                         1:index\n\
+                                                         2:reverse unique\n\
+                                                         3:reverse index\n\
+                                 2       NAME\n\
+                                 3       ATTR_NAME\n\
+                                 4       NUM_PAGES\n\
+                                 5       NUM_KEYS\n\
+                                 6       PRIMARY_KEY     1:primary key\n\
+                                 7       KEY_ORDER       1:base\n\
+ ----------------------------------------------------------------------\n\
+ CUBRID_SCH_TRIGGER              1       NAME\n\
+                                 2       STATUS\n\
+                                 3       EVENT\n\
+                                 4       TARGET_TABLE\n\
+                                 5       TARGET_ATTR\n\
+                                 6       ACTION_TIME\n\
+                                 7       ACTION\n\
+                                 8       PRIORITY\n\
+                                 9       CONDITION_TIME\n\
+                                 10      CONDITION\n\
+ ----------------------------------------------------------------------\n\
+ CUBRID_SCH_TABLE_PRIVILEGE      1       TABLE_NAME\n\
+                                 2       PRIVILEGE\n\
+                                 3       GRANTABLE\n\
+ ----------------------------------------------------------------------\n\
+ CCI_SCH_ATTR_PRIVILEGE          1       ATTR_NAME\n\
+                                 2       PRIVILEGE\n\
+                                 3       GRANTABLE\n\
+ ----------------------------------------------------------------------\n\
+ CUBRID_SCH_PRIMARY_KEY          1       TABLE_NAME\n\
+                                 2       ATTR_NAME\n\
+                                 3       KEY_SEQ         1:base\n\
+                                 4       KEY_NAME\n\
+ ----------------------------------------------------------------------\n\
+ CUBRID_SCH_IMPORTED_KEYS        1       PKTABLE_NAME\n\
+ CUBRID_SCH_EXPORTED_KEYS        2       PKCOLUMN_NAME\n\
+ CUBRID_SCH_CROSS_REFERENCE      3       FKTABLE_NAME    1:base\n\
+                                 4       FKCOLUMN_NAME\n\
+                                 5       KEY_SEQ\n\
+                                 6       UPDATE_ACTION   0:cascade\n\
+                                                         1:restrict\n\
+                                                         2:no action\n\
+                                                         3:set null\n\
+                                 7       DELETE_ACTION   0:cascade\n\
+                                                         1:restrict\n\
+                                                         2:no action\n\
+                                                         3:set null\n\
+                                 8       FK_NAME\n\
+                                 9       PK_NAME\n\
+ ----------------------------------------------------------------------\n\
 \n\
-row: int, the column you want to get the information.\n\
+Parameters::\n\
+  schema_type: schema type in the table\n\
+  table_name: string, table you want to know the schema of\n\
+  attr_name: string, attribute you want to know the schema of\n\
+\n\
+Return values::\n\
+  A tuple that contains the schema information when success\n\
+  None when fail\n\
+\n\
+While meta_cache_ttl is set, the results are cached for that many\n\
+seconds, until a statement executed through the connection changes\n\
+the schema.\n\
 \n\
 Example::\n\
   import _cubrid\n\
   con = _cubrid.connect('CUBRID:localhost:33000:demodb:::', 'public')\n\
-  cur = con.cursor()\n\
-  cur.prepare('select * from test_cubrid')\n\
-  cur.execute()\n\
-  infos = cur.result_info()\n\
-  for info in infos:\n\
-      print info\n\
-  print cur.result_info(1)\n\
-  cur.close()\n\
+  print con.schema_info(_cubrid.CUBRID_SCH_TABLE, 'test_cubrid')\n\
   con.close()";
 
 static PyObject *
-_cubrid_CursorObject_result_info (_cubrid_CursorObject * self,
-                                  PyObject * args)
+_cubrid_ConnectionObject_schema_request (_cubrid_ConnectionObject * self,
+                                         int type, char *class_name,
+                                         char *attr_name)
 {
-  PyObject *result, *item;
-  int i, j, n = 0, len = 0;
+  int flag = 0, request, res;
+  T_CCI_ERROR error;
+  PyObject *result;
+  T_CCI_COL_INFO *col_info;
+  T_CCI_CUBRID_STMT sql_type;
+  int col_count;
 
-  if (self->state == CURSOR_STATE_CLOSED)
+  switch (type)
     {
-      return handle_error (CUBRID_ER_INVALID_CURSOR, NULL);
+    case CCI_SCH_CLASS:
+    case CCI_SCH_VCLASS:
+      flag = CCI_CLASS_NAME_PATTERN_MATCH;
+      break;
+    case CCI_SCH_ATTRIBUTE:
+    case CCI_SCH_CLASS_ATTRIBUTE:
+      flag = CCI_ATTR_NAME_PATTERN_MATCH;
+      break;
+    default:
+      flag = 0;
+      break;
     }
-  if (!PyArg_ParseTuple (args, "|i", &n))
+
+  CUBRID_BEGIN_ALLOW_THREADS (self);
+  res =
+    cci_schema_info (self->handle, type, class_name, attr_name, (char) flag,
+                     &error);
+  CUBRID_END_ALLOW_THREADS (self);
+  if (res < 0)
     {
-      return NULL;
+      return handle_error (res, &error);
     }
 
-  if (self->col_count == 0)
+  request = res;
+
+  col_info = cci_get_result_info (request, &sql_type, &col_count);
+  if (!col_info)
     {
+      return handle_error (CUBRID_ER_CANNOT_GET_COLUMN_INFO, NULL);
+    }
+
+  CUBRID_BEGIN_ALLOW_THREADS (self);
+  res = cci_cursor (request, 1, CCI_CURSOR_CURRENT, &error);
+  CUBRID_END_ALLOW_THREADS (self);
+  if (res == CCI_ER_NO_MORE_DATA)
+    {
+      CUBRID_BEGIN_ALLOW_THREADS (self);
+      cci_close_req_handle (request);
+      CUBRID_END_ALLOW_THREADS (self);
       Py_INCREF (Py_None);
       return Py_None;
     }
-
-  if (n < 0 || n > self->col_count)
+  if (res < 0)
     {
-      return handle_error (CUBRID_ER_INVALID_PARAM, NULL);
+      return handle_error (res, &error);
     }
 
-  if (n != 0)
+  CUBRID_BEGIN_ALLOW_THREADS (self);
+  res = cci_fetch (request, &error);
+  CUBRID_END_ALLOW_THREADS (self);
+  if (res < 0)
     {
-      i = n;
-      len = n;
+      return handle_error (res, &error);
     }
-  else
+
+  result =
+    _cubrid_ConnectionObject_fetch_schema (self, request, col_info,
+                                           col_count);
+
+  CUBRID_BEGIN_ALLOW_THREADS (self);
+  res = cci_cursor (request, 1, CCI_CURSOR_CURRENT, &error);
+  CUBRID_END_ALLOW_THREADS (self);
+  if (res < 0 && res != CCI_ER_NO_MORE_DATA)
     {
-      i = 1;
-      len = self->col_count;
+      return handle_error (res, &error);
     }
 
-  result = (PyObject *) PyTuple_New (len - i + 1);
+  CUBRID_BEGIN_ALLOW_THREADS (self);
+  cci_close_req_handle (request);
+  CUBRID_END_ALLOW_THREADS (self);
 
-  for (j = 0; i <= len; i++, j++)
-    {
-      char *col_name = NULL, *real_attr = NULL;
-      char *class_name = NULL, *default_value = NULL;
-      int type, precision, scale, not_null, auto_increment, unique_key,
-        primary_key, foreign_key, reverse_index, resverse_unique, shared;
+  return result;
+}
 
-      item = PyTuple_New (15);
+static PyObject *
+_cubrid_ConnectionObject_schema_info (_cubrid_ConnectionObject * self,
+                                      PyObject * args)
+{
+  int type;
+  char *class_name = NULL;
+  char *attr_name = NULL;
+  PyObject *key = NULL, *result, *cached;
 
-      type = CCI_GET_RESULT_INFO_TYPE (self->col_info, i);
-      not_null = CCI_GET_RESULT_INFO_IS_NON_NULL (self->col_info, i);
-      scale = CCI_GET_RESULT_INFO_SCALE (self->col_info, i);
-      precision = CCI_GET_RESULT_INFO_PRECISION (self->col_info, i);
-      col_name = CCI_GET_RESULT_INFO_NAME (self->col_info, i);
-      real_attr = CCI_GET_RESULT_INFO_ATTR_NAME (self->col_info, i);
-      class_name = CCI_GET_RESULT_INFO_CLASS_NAME (self->col_info, i);
-      default_value = CCI_GET_RESULT_INFO_DEFAULT_VALUE (self->col_info, i);
-      auto_increment =
-        CCI_GET_RESULT_INFO_IS_AUTO_INCREMENT (self->col_info, i);
-      unique_key = CCI_GET_RESULT_INFO_IS_UNIQUE_KEY (self->col_info, i);
-      primary_key = CCI_GET_RESULT_INFO_IS_PRIMARY_KEY (self->col_info, i);
-      foreign_key = CCI_GET_RESULT_INFO_IS_FOREIGN_KEY (self->col_info, i);
-      reverse_index =
-        CCI_GET_RESULT_INFO_IS_REVERSE_INDEX (self->col_info, i);
-      resverse_unique =
-        CCI_GET_RESULT_INFO_IS_REVERSE_UNIQUE (self->col_info, i);
-      shared = CCI_GET_RESULT_INFO_IS_SHARED (self->col_info, i);
+  if (!PyArg_ParseTuple (args, "is|s", &type, &class_name, &attr_name))
+    {
+      return NULL;
+    }
 
-      PyTuple_SetItem (item, 0, PyLong_FromLong (type));
-      PyTuple_SetItem (item, 1, PyLong_FromLong (not_null));
-      PyTuple_SetItem (item, 2, PyLong_FromLong (scale));
-      PyTuple_SetItem (item, 3, PyLong_FromLong (precision));
-      PyTuple_SetItem (item, 4,
-                       PyUnicode_FromString (col_name));
-      PyTuple_SetItem (item, 5,
-                       PyUnicode_FromString (real_attr));
-      PyTuple_SetItem (item, 6,
-                       PyUnicode_FromString (class_name));
-      PyTuple_SetItem (item, 7,
-                       PyUnicode_FromString (default_value));
-      PyTuple_SetItem (item, 8,
-                       PyLong_FromLong (auto_increment));
-      PyTuple_SetItem (item, 9, PyLong_FromLong (unique_key));
-      PyTuple_SetItem (item, 10, PyLong_FromLong (primary_key));
-      PyTuple_SetItem (item, 11, PyLong_FromLong (foreign_key));
-      PyTuple_SetItem (item, 12,
-                       PyLong_FromLong (reverse_index));
-      PyTuple_SetItem (item, 13,
-                       PyLong_FromLong (resverse_unique));
-      PyTuple_SetItem (item, 14, PyLong_FromLong (shared));
+  if (type > CCI_SCH_LAST || type < CCI_SCH_FIRST)
+    {
+      return handle_error (CUBRID_ER_SCHEMA_TYPE, NULL);
+    }
 
-      PyTuple_SetItem (result, j, item);
+  if (self->meta_cache_ttl > 0
+      && (key = Py_BuildValue ("(isz)", type, class_name, attr_name)))
+    {
+      /* Rows are cached as tuples, and returned as new lists */
+      if ((cached = _cubrid_meta_cache_get (self, key)))
+        {
+          Py_DECREF (key);
+          if (cached == Py_None)
+            {
+              return cached;
+            }
+          result = PySequence_List (cached);
+          Py_DECREF (cached);
+          return result;
+        }
+    }
+  PyErr_Clear ();
+
+  result =
+    _cubrid_ConnectionObject_schema_request (self, type, class_name,
+                                             attr_name);
+  if (result && key)
+    {
+      if (result == Py_None)
+        {
+          Py_INCREF (Py_None);
+          cached = Py_None;
+        }
+      else
+        {
+          cached = PySequence_Tuple (result);
+        }
+      if (cached)
+        {
+          _cubrid_meta_cache_put (self, key, cached);
+          Py_DECREF (cached);
+        }
+      PyErr_Clear ();
     }
+  Py_XDECREF (key);
 
   return result;
 }
 
-static char _cubrid_CursorObject_execute__doc__[] =
-  "execute([option[,max_col_size]])\n\
-Executes a prepared Query.\n\
-A option can be used when retrieving the query result from the server.\n\
-A option can be classified as synchronous or asynchronous. \n\
-If the option is set to CUBRID_EXEC_QUERY_ALL, a synchronous mode(sync_mode) \n\
-is used to retrieve query results immediately after executing prepared queries. \n\
-If it is set to CUBRID_EXEC_ASYNC, an asynchronous mode (async_mode) is used to\n\
-retrieve the result immediately each time a query result is created.\n\
-The option is set to CUBRID_EXEC_QUERY_ALL by default, and in such\n\
-cases the following rules are applied:\n\
-  - The return value is the result of the first query.\n\
-  - If an error occurs in any query, the execution is processed\n\
-    as a failure.\n\
-  - For a query composed of in a query composed of q1 q2 q3\n\
-    if an error occurs in q2 after q1 succeeds the execution,\n\
-    the result of q1 remains valid. That is, the previous successful\n\
-    query executions are not rolled back when an error occurs.\n\
-  - If a query is executed successfully, the result of the second\n\
-    query can be obtained using next_result().\n\
-max_col is a value that is used to determine the size of the column\n\
-to be transferred to the client when the type of the column of the\n\
-prepared query is CHAR, VARCHAR, NCHAR, VARNCHAR, BIT or VARBIT.\n\
-If it is set to 0, all data is transferred.\n\
-\n\
-Parameters::\n\
-  option: Exec option, option maybe the following values:\n\
-    CUBRID_EXEC_ASYNC\n\
-    CUBRID_EXEC_QUERY_ALL\n\
-    CUBRID_EXEC_QUERY_INFO\n\
-    CUBRID_EXEC_ONLY_QUERY_PLAN\n\
-    CUBRID_EXEC_THREAD\n\
-\n\
-Return values::\n\
-  SELECT: Returns the number of results in sync mode,\n\
-          returns 0 in asynchronism mode.\n\
-  INSERT, UPDATE: Returns the number of tuples reflected.\n\
-  Others queries: 0\n";
+static char _cubrid_ConnectionObject_set_meta_cache__doc__[] =
+  "set_meta_cache(cache)\n\
+Use the dict cache for the schema_info() results and the descriptions\n\
+cached while meta_cache_ttl is set, e.g. to share one cache between the\n\
+connections to a database. None gives the connection a cache of its own.";
 
 static PyObject *
-_cubrid_CursorObject_execute (_cubrid_CursorObject * self, PyObject * args)
+_cubrid_ConnectionObject_set_meta_cache (_cubrid_ConnectionObject * self,
+                                         PyObject * args)
 {
-  int res, option = 0, max_col_size = 0;
-  T_CCI_ERROR error;
-  T_CCI_COL_INFO *res_col_info;
-  T_CCI_SQLX_CMD res_sql_type;
-  int res_col_count;
+  PyObject *cache;
 
-  if (self->state == CURSOR_STATE_CLOSED)
+  if (!PyArg_ParseTuple (args, "O", &cache))
     {
-      return handle_error (CUBRID_ER_INVALID_CURSOR, NULL);
+      return NULL;
     }
-  if (!PyArg_ParseTuple (args, "|ii", &option, &max_col_size))
+  if (cache != Py_None && !PyDict_Check (cache))
     {
+      PyErr_SetString (PyExc_TypeError, "cache must be a dict or None");
       return NULL;
     }
 
-  res = cci_execute (self->handle, option, max_col_size, &error);
-  if (res < 0)
+  Py_CLEAR (self->meta_cache);
+  if (cache != Py_None)
     {
-      return handle_error (res, &error);
+      Py_INCREF (cache);
+      self->meta_cache = cache;
     }
 
-  res_col_info =
-    cci_get_result_info (self->handle, &res_sql_type, &res_col_count);
-  if (res_sql_type == SQLX_CMD_SELECT && !res_col_info)
-    {
-      return handle_error (CUBRID_ER_CANNOT_GET_COLUMN_INFO, NULL);
-    }
+  Py_INCREF (Py_None);
+  return Py_None;
+}
 
-  self->col_info = res_col_info;
-  self->sql_type = res_sql_type;
-  self->col_count = res_col_count;
+static char _cubrid_ConnectionObject_meta_cache_clear__doc__[] =
+  "meta_cache_clear()\n\
+Drop the cached schema_info() results and descriptions, e.g. after the\n\
+schema was changed through another connection. The cache is cleared\n\
+automatically after a statement that changes the schema is executed\n\
+through this connection, and on rollback.";
 
-  switch (res_sql_type)
+static PyObject *
+_cubrid_ConnectionObject_meta_cache_clear (_cubrid_ConnectionObject * self,
+                                           PyObject * args)
+{
+  if (!PyArg_ParseTuple (args, ""))
     {
-    case SQLX_CMD_SELECT:
-    case SQLX_CMD_INSERT:
-    case SQLX_CMD_UPDATE:
-    case SQLX_CMD_DELETE:
-    case SQLX_CMD_CALL:
-      self->row_count = res;
-      break;
-    default:
-      self->row_count = -1;
-      break;
+      return NULL;
     }
 
-  if (res_sql_type == SQLX_CMD_SELECT)
+  if (self->meta_cache)
     {
-      int ret;
-
-      _cubrid_CursorObject_set_description (self);
-      ret = cci_cursor (self->handle, 1, CCI_CURSOR_CURRENT, &error);
-      if (ret < 0 && ret != CCI_ER_NO_MORE_DATA)
-        {
-          return handle_error (ret, &error);
-        }
+      PyDict_Clear (self->meta_cache);
     }
 
-  return PyLong_FromLong (res);
+  Py_INCREF (Py_None);
+  return Py_None;
 }
 
-/* DB type to Python type mapping
-*
-* bit, varbit                       -> bytes
-* int, short                         -> Integer
-* float, double, numeric         -> Float
-* numeric                           -> Decimal
-* time                                         -> datetime.time
-* date                                         -> datetime.date
-* datetime                                 -> datetime.datetime
-* timestamp                         -> datetime.datetime
-* another type                        -> String
-*/
+static char _cubrid_ConnectionObject_escape_string__doc__[] =
+  "escape_string()\n\
+Escape special characters in a string for use in an SQL statement";
 
 static PyObject *
-_cubrid_CursorObject_dbval_to_pyvalue (_cubrid_CursorObject * self, int type,
-                                       int index)
+_cubrid_ConnectionObject_escape_string (_cubrid_ConnectionObject * self,
+                                        PyObject * args)
 {
-  int res, ind;
-  PyObject *val, *tmpval;
-  char *buffer;
-  int num;
-  CUBRID_LONG_LONG bignum;
-  T_CCI_DATE dt;
-  int len;
+  char *unescape_string = NULL, *escape_string = NULL;
+  Py_ssize_t len = -1;
+  int res;
+  PyObject *op;
+  T_CCI_ERROR error;
 
-  if (self->state == CURSOR_STATE_CLOSED)
+  if (!PyArg_ParseTuple (args, "s#", &unescape_string, &len))
     {
-      return handle_error (CUBRID_ER_INVALID_CURSOR, NULL);
+      return NULL;
     }
-  switch (type)
+
+  if (len < 0)
     {
-    case CCI_U_TYPE_BIT:        //CCI_A_TYPE_BIT
-    case CCI_U_TYPE_VARBIT:
-      res = cci_get_data (self->handle, index, CCI_A_TYPE_STR, &buffer, &ind);
-      if (res < 0)
-        {
-          return handle_error (res, NULL);
-        }
-      if (ind < 0)
-        {
-          Py_INCREF (Py_None);
-          val = Py_None;
-        }
-      else
-        {
-          len = strlen(buffer);
-          // Allocate buffer for half the length of the hex string
-          unsigned char* bin_data = (unsigned char*)malloc(len / 2);
-          if (bin_data == NULL)
-            {
-              Py_INCREF(Py_None);
-              return Py_None;
-            }
+      return handle_error (CUBRID_ER_INVALID_PARAM, NULL);
+    }
 
-          for (int i = 0; i < len; i += 2)
-            {
-              // Convert each pair of hexadecimal characters into a byte
-              char hex[3] = {buffer[i], buffer[i + 1], 0}; // 3 for including null terminator
-              unsigned long byte = strtoul(hex, NULL, 16); // Convert from hex to long
-              bin_data[i / 2] = (unsigned char)byte; // Store the byte
-            }
+  escape_string = (char *) malloc (len * 2 + 16);
 
-          // Create the Python bytes object from the binary data
-          val = PyBytes_FromStringAndSize((const char*)bin_data, len / 2);
-          free(bin_data); // Free the allocated memory
-        }
+  if (!escape_string)
+    {
+      return handle_error (CUBRID_ER_NO_MORE_MEMORY, NULL);
+    }
+  CUBRID_COUNT_ALLOC ();
 
-      break;
-    case CCI_U_TYPE_INT:
-    case CCI_U_TYPE_SHORT:
-      res = cci_get_data (self->handle, index, CCI_A_TYPE_INT, &num, &ind);
-      if (res < 0)
-        {
-          return handle_error (res, NULL);
-        }
-      if (ind < 0)
-        {
-          Py_INCREF (Py_None);
-          return Py_None;
-        }
-      else
-        {
-          val = PyLong_FromLong (num);
-        }
-      break;
-    case CCI_U_TYPE_BIGINT:
-      res = cci_get_data (self->handle, index, CCI_A_TYPE_BIGINT, &bignum, &ind);
-      if (res < 0)
-        {
-          return handle_error (res, NULL);
-        }
-      if (ind < 0)
-        {
-          Py_INCREF (Py_None);
-          return Py_None;
-        }
-      else
-        {
-          val = PyLong_FromLongLong (bignum);
-        }
-      break;
-    case CCI_U_TYPE_FLOAT:
-    case CCI_U_TYPE_DOUBLE:
-      res = cci_get_data (self->handle, index, CCI_A_TYPE_STR, &buffer, &ind);
-      if (res < 0)
-        {
-          return handle_error (res, NULL);
-        }
-      if (ind < 0)
-        {
-          Py_INCREF (Py_None);
-          val = Py_None;
-        }
-      else
-        {
-          tmpval = PyUnicode_FromString (buffer);
-          val = PyFloat_FromString (tmpval);
-          Py_DECREF (tmpval);
-        }
-      break;
-    case CCI_U_TYPE_NUMERIC:
-      res = cci_get_data (self->handle, index, CCI_A_TYPE_STR, &buffer, &ind);
-      if (res < 0)
-        {
-          return handle_error (res, NULL);
-        }
-      if (ind < 0)
-        {
-          Py_INCREF (Py_None);
-          val = Py_None;
-        }
-      else
-        {
-          tmpval = PyTuple_New (1);
-          PyTuple_SetItem (tmpval, 0, Py_BuildValue ("s", buffer));
-          val = PyObject_CallObject (DecimalType, tmpval);
-          Py_DECREF (tmpval);
-        }
-      break;
-    case CCI_U_TYPE_DATE:
-      res = cci_get_data (self->handle, index, CCI_A_TYPE_DATE, &dt, &ind);
-      if (res < 0)
+  memset (escape_string, 0, len * 2 + 16);
+
+  if ((res = cci_escape_string (self->handle,
+                                escape_string, unescape_string, len,
+                                &error)) < 0)
+    {
+      free (escape_string);
+      return handle_error (res, &error);
+    }
+
+  op = PyUnicode_FromStringAndSize (escape_string, res);
+
+  free (escape_string);
+
+  return op;
+}
+
+static char _cubrid_ConnectionObject_close__doc__[] = "close()\n\
+Close the connection now.";
+
+static PyObject *
+_cubrid_ConnectionObject_close (_cubrid_ConnectionObject * self,
+                                PyObject * args)
+{
+  T_CCI_ERROR error;
+  int err_code;
+  if(self->handle <= 0)
+    {
+      Py_INCREF (Py_None);
+      return Py_None;
+    }
+  CUBRID_BEGIN_ALLOW_THREADS (self);
+  err_code = cci_disconnect (self->handle, &error);
+  CUBRID_END_ALLOW_THREADS (self);
+  if (err_code < 0)
+    {
+      return handle_error (err_code, &error);
+    }
+  self->handle = 0;
+  _cubrid_stmt_cache_clear (self, 0);
+  if (self->url)
+    {
+      free (self->url);
+      self->url = NULL;
+    }
+
+  if (self->user)
+    {
+      free (self->user);
+      self->user = NULL;
+    }
+
+  if (self->isolation_level)
+    {
+      Py_DECREF (self->isolation_level);
+      self->isolation_level = NULL;
+    }
+
+  if (self->autocommit)
+    {
+      Py_DECREF (self->autocommit);
+      self->autocommit = NULL;
+    }
+
+  Py_INCREF (Py_None);
+  return Py_None;
+}
+
+static void
+_cubrid_ConnectionObject_dealloc (_cubrid_ConnectionObject * self)
+{
+  PyObject *o;
+
+  o = _cubrid_ConnectionObject_close (self, NULL);
+  Py_XDECREF (o);
+  Py_CLEAR (self->stmt_cache);
+  Py_CLEAR (self->meta_cache);
+  Py_CLEAR (self->trace_callback);
+  _cubrid_arena_free (&self->arena);
+
+  if (self->lock)
+    {
+      PyThread_free_lock (self->lock);
+      self->lock = NULL;
+    }
+  if (self->cancel_lock)
+    {
+      PyThread_free_lock (self->cancel_lock);
+      self->cancel_lock = NULL;
+    }
+
+  Py_TYPE (self)->tp_free ((PyObject *) self);
+}
+
+static PyObject *
+_cubrid_CursorObject_new (PyTypeObject * type, PyObject * args,
+                          PyObject * kwargs)
+{
+  _cubrid_CursorObject *self;
+
+  self = (_cubrid_CursorObject *) type->tp_alloc (type, 0);
+  if (!self)
+    {
+      return NULL;
+    }
+
+  return (PyObject *) self;
+}
+
+static int
+_cubrid_CursorObject_init (_cubrid_CursorObject * self, PyObject * args,
+                           PyObject * kwargs)
+{
+  _cubrid_ConnectionObject *conn;
+
+  if (!PyArg_ParseTuple (args, "O!", &_cubrid_ConnectionObject_type, &conn))
+    {
+      return -1;
+    }
+
+  Py_INCREF (conn);
+
+  self->state = CURSOR_STATE_OPENED;
+  self->handle = 0;
+  self->connection = conn->handle;
+  self->conn = conn;
+  self->description = NULL;
+  self->desc_handle = 0;
+  self->desc_gen = 0;
+  self->desc_col_info = NULL;
+  Py_CLEAR (self->desc_sql);
+  self->bind_num = -1;
+  self->col_count = -1;
+  self->sql_type = 0;
+  self->row_count = -1;
+  self->cursor_pos = 0;
+  self->row_pos = 1;
+  self->lazy_pos = 0;
+  self->result_gen = 0;
+  self->fetch_size = conn->fetch_size;
+  self->array_size = 0;
+  self->array_binds = NULL;
+  _cubrid_arena_free (&self->arena);
+  self->arena.cap = CUBRID_ARENA_CAP;
+  self->allocs = 0;
+  self->allocs_pending = 0;
+  self->sql = NULL;
+  self->stmt_cache_gen = 0;
+  self->col_names = NULL;
+  self->row_type = NULL;
+  self->query = NULL;
+
+  memset (self->charset, 0, sizeof (self->charset));
+  strncpy(self->charset, "utf8", sizeof (self->charset) - 1);
+  self->utf8 = 1;
+  self->decoder = NULL;
+  self->intern_strings = 0;
+  self->epoch_datetimes = 0;
+  self->query_timeout = -1;
+
+  return 0;
+}
+
+/* utf8, UTF-8, utf_8... */
+static int
+_cubrid_charset_is_utf8 (const char *charset)
+{
+  const char *p = "utf8";
+
+  for (; *charset; charset++)
+    {
+      if (*charset == '-' || *charset == '_')
         {
-          return handle_error (res, NULL);
+          continue;
         }
-      if (ind < 0)
+      if (*p == '\0' || Py_TOLOWER (*charset) != *p)
         {
-          Py_INCREF (Py_None);
-          val = Py_None;
+          return 0;
         }
-      else
+      p++;
+    }
+
+  return *p == '\0';
+}
+
+static int
+_cubrid_is_ascii (const char *buffer, Py_ssize_t len)
+{
+  Py_ssize_t i = 0;
+  uint64_t word;
+
+  for (; i + 8 <= len; i += 8)
+    {
+      memcpy (&word, buffer + i, 8);
+      if (word & 0x8080808080808080ULL)
         {
-          val = PyDate_FromDate (dt.yr, dt.mon, dt.day);
+          return 0;
         }
-      break;
-    case CCI_U_TYPE_TIME:
-      res = cci_get_data (self->handle, index, CCI_A_TYPE_DATE, &dt, &ind);
-      if (res < 0)
+    }
+  for (; i < len; i++)
+    {
+      if (buffer[i] & 0x80)
         {
-          return handle_error (res, NULL);
+          return 0;
         }
-      if (ind < 0)
+    }
+
+  return 1;
+}
+
+/*
+ * Decode len bytes of a string value with the charset of the cursor.
+ * UTF-8 is decoded directly, with ASCII strings copied as they are;
+ * other charsets go through the decoder looked up by set_charset().
+ */
+static PyObject *
+_cubrid_CursorObject_decode (_cubrid_CursorObject * self,
+                             const char *buffer, Py_ssize_t len)
+{
+  PyObject *val, *bytes, *res;
+
+  if (self->utf8)
+    {
+      if (_cubrid_is_ascii (buffer, len))
         {
-          Py_INCREF (Py_None);
-          val = Py_None;
+          val = PyUnicode_New (len, 127);
+          if (val != NULL)
+            {
+              memcpy (PyUnicode_1BYTE_DATA (val), buffer, len);
+            }
         }
       else
         {
-          val = PyTime_FromTime (dt.hh, dt.mm, dt.ss, 0);
+          val = PyUnicode_DecodeUTF8 (buffer, len, NULL);
         }
-      break;
-    case CCI_U_TYPE_DATETIME:
-      res = cci_get_data (self->handle, index, CCI_A_TYPE_DATE, &dt, &ind);
-      if (res < 0)
+    }
+  else
+    {
+      val = NULL;
+      bytes = PyBytes_FromStringAndSize (buffer, len);
+      if (bytes != NULL)
         {
-          return handle_error (res, NULL);
+          res = PyObject_CallFunctionObjArgs (self->decoder, bytes, NULL);
+          Py_DECREF (bytes);
+          if (res != NULL && PyTuple_Check (res) && PyTuple_GET_SIZE (res) == 2
+              && PyUnicode_Check (PyTuple_GET_ITEM (res, 0)))
+            {
+              val = PyTuple_GET_ITEM (res, 0);
+              Py_INCREF (val);
+            }
+          Py_XDECREF (res);
         }
-      if (ind < 0)
+    }
+
+  if (val == NULL)
+    {
+      PyErr_SetString (PyExc_ValueError, "String decoding failed");
+      return NULL;
+    }
+  if (self->intern_strings && len <= CUBRID_INTERN_MAX_LEN)
+    {
+      PyUnicode_InternInPlace (&val);
+    }
+
+  return val;
+}
+
+static char _cubrid_CursorObject_set_charset__doc__[] =
+  "Set the charset name used by the cursor object. Default value is utf8.\n\
+The codec is looked up once, and LookupError is raised if Python\n\
+does not know it.";
+
+static PyObject *
+_cubrid_CursorObject_set_charset (_cubrid_CursorObject * self, PyObject * args)
+{
+  char *charset = NULL;
+
+  if (self->state == CURSOR_STATE_CLOSED)
+    {
+      return handle_error (CUBRID_ER_INVALID_CURSOR, NULL);
+    }
+  if (!PyArg_ParseTuple (args, "s", &charset))
+    {
+      return NULL;
+    }
+
+  if (charset != NULL && *charset != '\0')
+    {
+      if (_cubrid_charset_is_utf8 (charset))
         {
-          Py_INCREF (Py_None);
-          val = Py_None;
+          Py_CLEAR (self->decoder);
+          self->utf8 = 1;
         }
       else
         {
-          val =
-            PyDateTime_FromDateAndTime (dt.yr, dt.mon, dt.day, dt.hh, dt.mm,
-                                        dt.ss, dt.ms * 1000);
-        }
-      break;
-    case CCI_U_TYPE_TIMESTAMP:
-      res = cci_get_data (self->handle, index, CCI_A_TYPE_DATE, &dt, &ind);
-      if (res < 0)
-        {
-          return handle_error (res, NULL);
-        }
-      if (ind < 0)
-        {
-          Py_INCREF (Py_None);
-          val = Py_None;
+          PyObject *decoder = PyCodec_Decoder (charset);
+
+          if (decoder == NULL)
+            {
+              return NULL;
+            }
+          Py_XSETREF (self->decoder, decoder);
+          self->utf8 = 0;
+        }
+      snprintf (self->charset, sizeof (self->charset), "%s", charset);
+    }
+
+  Py_INCREF (Py_None);
+  return Py_None;
+
+}
+
+
+/*
+ * The cursor gets a new result set, or none: the CCI cursor is on its first
+ * row and the lazy rows of the previous result can no longer be read.
+ */
+static void
+_cubrid_CursorObject_new_result (_cubrid_CursorObject * self)
+{
+  self->row_pos = 1;
+  self->lazy_pos = 0;
+  self->result_gen++;
+}
+
+/*
+ * Reading a lazy row moves the CCI cursor to that row: put it back on
+ * row_pos before it is moved relative to its position.
+ */
+static int
+_cubrid_CursorObject_restore_pos (_cubrid_CursorObject * self,
+                                  T_CCI_ERROR * error)
+{
+  int res;
+
+  if (!self->lazy_pos)
+    {
+      return 0;
+    }
+
+  CUBRID_BEGIN_ALLOW_THREADS (self->conn);
+  res = cci_cursor (self->handle, self->row_pos, CCI_CURSOR_FIRST, error);
+  CUBRID_END_ALLOW_THREADS (self->conn);
+  if (res < 0 && res != CCI_ER_NO_MORE_DATA)
+    {
+      return res;
+    }
+
+  self->lazy_pos = 0;
+  return 0;
+}
+
+static void
+_cubrid_CursorObject_reset (_cubrid_CursorObject * self)
+{
+  _cubrid_CursorObject_new_result (self);
+  if (self->handle)
+    {
+      if (self->sql && self->stmt_cache_gen == self->conn->stmt_cache_gen
+          && self->conn->stmt_cache_size > 0 && self->conn->handle)
+        {
+          T_CCI_ERROR error;
+
+          /* Keep the statement, but free its result set on the server */
+          if (self->sql_type == SQLX_CMD_SELECT)
+            {
+              CUBRID_BEGIN_ALLOW_THREADS (self->conn);
+              cci_close_query_result (self->handle, &error);
+              CUBRID_END_ALLOW_THREADS (self->conn);
+            }
+          /*
+           * The column names and description stay valid for this handle,
+           * and are reused if the statement is taken again from the cache
+           */
+          _cubrid_stmt_cache_put (self->conn, self->sql, self->handle);
         }
       else
         {
-          val =
-            PyDateTime_FromDateAndTime (dt.yr, dt.mon, dt.day, dt.hh, dt.mm,
-                                        dt.ss, 0);
+          CUBRID_BEGIN_ALLOW_THREADS (self->conn);
+          cci_close_req_handle (self->handle);
+          CUBRID_END_ALLOW_THREADS (self->conn);
+          self->desc_handle = 0;
+          Py_CLEAR (self->description);
         }
-      break;
-    case 130: // JSON
-    case CCI_U_TYPE_CHAR:
-    case CCI_U_TYPE_STRING:
-      res = cci_get_data (self->handle, index, CCI_A_TYPE_STR, &buffer, &ind);
-      if (res < 0)
+      self->handle = 0;
+
+      self->bind_num = -1;
+      self->col_count = -1;
+      self->sql_type = 0;
+      self->row_count = -1;
+      self->cursor_pos = 0;
+    }
+
+  Py_CLEAR (self->array_binds);
+  self->array_size = 0;
+  _cubrid_arena_reset (&self->arena);
+  Py_CLEAR (self->sql);
+  Py_CLEAR (self->query);
+}
+
+static char _cubrid_CursorObject_prepare__doc__[] = "prepare(sql)\n\
+This function creates a prepared statement. A prepared statement is a\n\
+server-side object that can be used to optimize performance. You can \n\
+use this statement effectively to execute repeatedly or to process \n\
+long data. Only a single statement can be used. The SQL statement can \n\
+contain zero or more question mark (?) parameter markers for which real \n\
+values will be substituted when the statement is executed. Add a \n\
+parameter when you bind a value in the VALUES clause of INSERT statement \n\
+or in the WHERE clause.\n\
+\n\
+sql: string, the sql statement you want to execute.";
+
+static PyObject *
+_cubrid_CursorObject_prepare (_cubrid_CursorObject * self, PyObject * args)
+{
+  int res;
+  T_CCI_ERROR error;
+  char *stmt = "";
+  CUBRID_LONG_LONG start;
+
+  if (self->state == CURSOR_STATE_CLOSED)
+    {
+      return handle_error (CUBRID_ER_INVALID_CURSOR, NULL);
+    }
+  if (!PyArg_ParseTuple (args, "s", &stmt))
+    {
+      return NULL;
+    }
+
+  _cubrid_CursorObject_reset (self);
+  /* prepare() is not traced, only counted */
+  start = self->conn->stats_enabled ? _cubrid_monotonic_ns () : 0;
+
+  if (self->conn->stmt_cache_size > 0)
+    {
+      if (!(self->sql = PyUnicode_FromString (stmt)))
         {
-          return handle_error (res, NULL);
+          return NULL;
         }
-      if (ind < 0)
+      self->stmt_cache_gen = self->conn->stmt_cache_gen;
+      self->handle = _cubrid_stmt_cache_take (self->conn, self->sql);
+    }
+
+  if (self->handle)
+    {
+      int i;
+
+      /* Unbound parameters are NULL, as on a freshly prepared handle */
+      self->bind_num = cci_get_bind_num (self->handle);
+      for (i = 1; i <= self->bind_num; i++)
         {
-          Py_INCREF (Py_None);
-          val = Py_None;
+          cci_bind_param (self->handle, i, CCI_A_TYPE_STR, NULL,
+                          CCI_U_TYPE_NULL, 0);
         }
-      else
+    }
+  else
+    {
+      CUBRID_BEGIN_ALLOW_THREADS (self->conn);
+      res = cci_prepare (self->connection, stmt, 0, &error);
+      CUBRID_END_ALLOW_THREADS (self->conn);
+      if (res < 0)
         {
-          val = PyUnicode_Decode (buffer, strlen (buffer), self->charset, NULL);
-          if (val == NULL)
-            {
-              PyErr_SetString (PyExc_ValueError, "String decoding failed");
-            }
+          Py_CLEAR (self->sql);
+          return handle_error (res, &error);
         }
-      break;
-    default:
-      // Unknown type, try int
-      res = cci_get_data (self->handle, index, CCI_A_TYPE_INT, &num, &ind);
-      if (res == 0)
+      self->handle = res;
+      self->bind_num = cci_get_bind_num (res);
+      if (self->conn->query_timeout_default < 0)
         {
-          if (ind < 0)
-            {
-              Py_INCREF (Py_None);
-              return Py_None;
-            }
-
-          return PyLong_FromLong (num);
+          /* A new handle has the timeout of the connection URL */
+          self->conn->query_timeout_default = cci_get_query_timeout (res);
         }
 
-      // Unknown type, try date, time or datetime
-      res = cci_get_data (self->handle, index, CCI_A_TYPE_DATE, &dt, &ind);
-      if (res == 0)
-        {
-          if (ind < 0)
-            {
-              Py_INCREF (Py_None);
-              val = Py_None;
-            }
+      /* A closed handle id may be reused: never match an old description */
+      self->desc_handle = 0;
+      Py_CLEAR (self->description);
+    }
 
-          if (dt.yr == 0)
-            {
-              return PyTime_FromTime(dt.hh, dt.mm, dt.ss, dt.ms * 1000);
-            }
-          if (dt.hh == 0 && dt.mm == 0 && dt.ss == 0 && dt.ms == 0)
-            {
-              return PyDate_FromDate (dt.yr, dt.mon, dt.day);
-            }
-          else
-            {
-              return PyDateTime_FromDateAndTime (dt.yr, dt.mon, dt.day, dt.hh,
-                                                 dt.mm, dt.ss, dt.ms * 1000);
-            }
-        }
+  /* Also resets the size a cached handle kept from another cursor */
+  cci_fetch_size (self->handle, self->fetch_size);
 
-      // Unknown type, try str
-      res = cci_get_data (self->handle, index, CCI_A_TYPE_STR, &buffer, &ind);
-      if (res < 0)
-        {
-          return handle_error (res, NULL);
-        }
-      if (ind < 0)
+  /* The statement text is only kept for the trace callback and the cache */
+  if (self->conn->trace_callback || self->conn->meta_cache_ttl > 0)
+    {
+      if (self->sql)
         {
-          Py_INCREF (Py_None);
-          val = Py_None;
+          Py_INCREF (self->sql);
+          self->query = self->sql;
         }
       else
         {
-          val = PyUnicode_Decode (buffer, strlen (buffer), self->charset, NULL);
-          if (val == NULL)
+          self->query = PyUnicode_FromString (stmt);
+          if (!self->query)
             {
-              PyErr_SetString (PyExc_ValueError, "String decoding failed");
+              return NULL;
             }
         }
-      break;
     }
 
-  return val;
+  if (self->conn->stats_enabled)
+    {
+      self->conn->stats.prepare_count++;
+      self->conn->stats.prepare_ns += _cubrid_stats_elapsed (start);
+    }
+
+  Py_INCREF (Py_None);
+  return Py_None;
+}
+
+static char _cubrid_CursorObject_set_fetch_size__doc__[] =
+  "set_fetch_size(n)\n\
+Set the number of rows the server sends in each fetch packet of a\n\
+SELECT result. Larger values mean fewer round trips on big scans, at\n\
+the cost of more client memory per packet. The size applies to the\n\
+current statement and to the statements prepared after this call.\n\
+0 restores the CCI default, for the current statement too. New\n\
+cursors start with the fetch_size of their connection.\n\
+\n\
+n: int, rows per fetch packet";
+
+static PyObject *
+_cubrid_CursorObject_set_fetch_size (_cubrid_CursorObject * self,
+                                     PyObject * args)
+{
+  int fetch_size;
+
+  if (self->state == CURSOR_STATE_CLOSED)
+    {
+      return handle_error (CUBRID_ER_INVALID_CURSOR, NULL);
+    }
+  if (!PyArg_ParseTuple (args, "i", &fetch_size))
+    {
+      return NULL;
+    }
+
+  if (fetch_size < 0)
+    {
+      return handle_error (CUBRID_ER_INVALID_PARAM, NULL);
+    }
+
+  /* 0 is the CCI default, which the server replaces with its own */
+  self->fetch_size = fetch_size;
+  if (self->handle)
+    {
+      cci_fetch_size (self->handle, fetch_size);
+    }
+
+  Py_INCREF (Py_None);
+  return Py_None;
+}
+
+static char _cubrid_CursorObject_bind_param__doc__[] =
+  "bind_param(index, value, bind_type=None)\n\
+This function is used to bind a value to a prepared statement variable. It supports\n\
+binding of various Python data types, including int, float, str (encoded as bytes),\n\
+date, time, and datetime objects, in addition to handling BLOB/CLOB types.\n\
+\n\
+In a CUBRID shard environment, specifying the bind_type is recommended for\n\
+optimal performance and compatibility.\n\
+\n\
+Supported Python types for binding include:\n\
+  - int (mapped to CUBRID INT or BIGINT based on size)\n\
+  - float (mapped to CUBRID FLOAT or DOUBLE)\n\
+  - decimal.Decimal (mapped to CUBRID NUMERIC)\n\
+  - str (encoded as UTF-8 bytes, mapped to CUBRID CHAR or STRING types)\n\
+  - bytes-like (mapped to CUBRID BIT VARYING, or to the bind_type given)\n\
+  - None (bound as NULL)\n\
+  - date (mapped to CUBRID DATE)\n\
+  - time (mapped to CUBRID TIME)\n\
+  - datetime (mapped to CUBRID TIMESTAMP)\n\
+\n\
+The function automatically determines the appropriate CUBRID data type based on\n\
+the Python type of the value argument, unless the bind_type is explicitly specified.\n\
+\n\
+Parameters:\n\
+  index (int): The index of the variable in the prepared statement to bind the value to.\n\
+  value: The Python object to bind to the variable. Supported types include int, float,\n\
+         decimal.Decimal, str, bytes, date, time, and datetime.\n\
+  bind_type (optional): The CUBRID column type to bind the value as. This parameter\n\
+                        is optional and is recommended for use in specific scenarios\n\
+                        where the automatic type resolution needs to be overridden.\n\
+\n\
+Returns:\n\
+  None: This function does not return a value.\n\
+\n\
+Raises:\n\
+  InterfaceError: If a collection is passed; use bind_set() for those.\n\
+  OverflowError: If an int does not fit in a CUBRID BIGINT.\n";
+
+static void
+_cubrid_pydate_to_cci (PyObject * value, T_CCI_DATE * date)
+{
+  memset (date, 0, sizeof (*date));
+
+  if (PyDate_Check (value))
+    {
+      date->yr = PyDateTime_GET_YEAR (value);
+      date->mon = PyDateTime_GET_MONTH (value);
+      date->day = PyDateTime_GET_DAY (value);
+    }
+
+  if (PyDateTime_Check (value))
+    {
+      date->hh = PyDateTime_DATE_GET_HOUR (value);
+      date->mm = PyDateTime_DATE_GET_MINUTE (value);
+      date->ss = PyDateTime_DATE_GET_SECOND (value);
+      date->ms = PyDateTime_DATE_GET_MICROSECOND (value) / 1000;
+    }
+  else if (PyTime_Check (value))
+    {
+      date->hh = PyDateTime_TIME_GET_HOUR (value);
+      date->mm = PyDateTime_TIME_GET_MINUTE (value);
+      date->ss = PyDateTime_TIME_GET_SECOND (value);
+      date->ms = PyDateTime_TIME_GET_MICROSECOND (value) / 1000;
+    }
+}
+
+/* Whether a datetime has a tzinfo other than None */
+static int
+_cubrid_datetime_has_tz (PyObject * value)
+{
+#if PY_VERSION_HEX >= 0x030A0000
+  return PyDateTime_DATE_GET_TZINFO (value) != Py_None;
+#else
+  /* No accessor before 3.10: the public struct holds tzinfo if flagged */
+  return ((PyDateTime_DateTime *) value)->hastzinfo
+    && ((PyDateTime_DateTime *) value)->tzinfo != Py_None;
+#endif
+}
+
+/*
+ * Convert an aware datetime to a CCI date with the "+HH:MM" zone of its
+ * UTC offset. Returns -1 with an exception set on error.
+ */
+static int
+_cubrid_pydatetime_to_cci_tz (PyObject * value, T_CCI_DATE_TZ * date)
+{
+  T_CCI_DATE naive;
+  PyObject *delta;
+  int offset;
+
+  delta = PyObject_CallMethod (value, "utcoffset", NULL);
+  if (delta == NULL)
+    {
+      return -1;
+    }
+  offset = 0;
+  if (delta != Py_None)
+    {
+      offset = PyDateTime_DELTA_GET_DAYS (delta) * 86400
+        + PyDateTime_DELTA_GET_SECONDS (delta);
+    }
+  Py_DECREF (delta);
+
+  _cubrid_pydate_to_cci (value, &naive);
+  memset (date, 0, sizeof (*date));
+  date->yr = naive.yr;
+  date->mon = naive.mon;
+  date->day = naive.day;
+  date->hh = naive.hh;
+  date->mm = naive.mm;
+  date->ss = naive.ss;
+  date->ms = naive.ms;
+  snprintf (date->tz, sizeof (date->tz), "%c%02d:%02d",
+            offset < 0 ? '-' : '+', abs (offset) / 3600,
+            abs (offset) % 3600 / 60);
+  return 0;
+}
+
+/*
+ * Bind one Python value to the statement variable index. u_type is the
+ * bind_type given by the caller, or 0 to choose it from the value.
+ *
+ * The common types are checked first with the cheap type flag checks,
+ * and the Decimal instance check only after them. str values are bound from their cached
+ * UTF-8 representation, and bytes-like values natively as BIT VARYING;
+ * CCI copies the value, so no temporary object is kept.
+ *
+ * Returns 0 when the value is bound, -1 with an exception set on error,
+ * and 1 for iterables (collections), which are left to the caller.
+ */
+static int
+_cubrid_CursorObject_bind_value (_cubrid_CursorObject * self, int index,
+                                 PyObject * value, int u_type)
+{
+  int res, overflow, int_value;
+  int a_type = CCI_A_TYPE_STR;
+  void *bind_value = NULL;
+  CUBRID_LONG_LONG bigint_value;
+  double double_value;
+  Py_ssize_t size;
+  T_CCI_DATE date_value;
+  T_CCI_DATE_TZ date_tz_value;
+  T_CCI_BIT bit_value;
+  Py_buffer view = { 0 };
+  PyObject *temp = NULL, *iter;
+
+  if (value == Py_None)
+    {
+      a_type = CCI_A_TYPE_STR;
+      u_type = CCI_U_TYPE_NULL;
+    }
+  else if (PyUnicode_Check (value))
+    {
+      if (!(bind_value = (void *) PyUnicode_AsUTF8AndSize (value, &size)))
+        {
+          return -1;
+        }
+      if (u_type == 0)
+        {
+          u_type = CCI_U_TYPE_CHAR;
+        }
+    }
+  else if (PyLong_CheckExact (value)
+           || (PyLong_Check (value) && !PyBool_Check (value)))
+    {
+      bigint_value = PyLong_AsLongLongAndOverflow (value, &overflow);
+      if (overflow)
+        {
+          PyErr_SetString (PyExc_OverflowError,
+                           "Python int out of range of C int64_t");
+          return -1;
+        }
+      if (bigint_value == -1 && PyErr_Occurred ())
+        {
+          return -1;
+        }
+
+      if (u_type == CCI_U_TYPE_BIGINT || bigint_value < INT_MIN
+          || bigint_value > INT_MAX)
+        {
+          bind_value = &bigint_value;
+          a_type = CCI_A_TYPE_BIGINT;
+          u_type = CCI_U_TYPE_BIGINT;
+        }
+      else
+        {
+          int_value = (int) bigint_value;
+          bind_value = &int_value;
+          a_type = CCI_A_TYPE_INT;
+          u_type = CCI_U_TYPE_INT;
+        }
+    }
+  else if (PyFloat_Check (value))
+    {
+      double_value = PyFloat_AS_DOUBLE (value);
+      bind_value = &double_value;
+      a_type = CCI_A_TYPE_DOUBLE;
+      u_type = CCI_U_TYPE_DOUBLE;
+    }
+  else if (PyDateTime_Check (value) && _cubrid_datetime_has_tz (value))
+    {
+      if (_cubrid_pydatetime_to_cci_tz (value, &date_tz_value) < 0)
+        {
+          return -1;
+        }
+      bind_value = &date_tz_value;
+      a_type = CCI_A_TYPE_DATE_TZ;
+      u_type = CCI_U_TYPE_DATETIMETZ;
+    }
+  else if (PyDateTime_Check (value) || PyDate_Check (value)
+           || PyTime_Check (value))
+    {
+      _cubrid_pydate_to_cci (value, &date_value);
+      bind_value = &date_value;
+      a_type = CCI_A_TYPE_DATE;
+      if (PyDateTime_Check (value))
+        {
+          u_type = CCI_U_TYPE_DATETIME;
+        }
+      else if (PyDate_Check (value))
+        {
+          u_type = CCI_U_TYPE_DATE;
+        }
+      else
+        {
+          u_type = CCI_U_TYPE_TIME;
+        }
+    }
+  else if (PyBool_Check (value))
+    {
+      int_value = (value == Py_True);
+      bind_value = &int_value;
+      a_type = CCI_A_TYPE_INT;
+      u_type = CCI_U_TYPE_INT;
+    }
+  else if (PyBytes_Check (value) || PyByteArray_Check (value)
+           || PyMemoryView_Check (value))
+    {
+      if (PyObject_GetBuffer (value, &view, PyBUF_SIMPLE) < 0)
+        {
+          return -1;
+        }
+
+      if (u_type == 0 || u_type == CCI_U_TYPE_BIT
+          || u_type == CCI_U_TYPE_VARBIT)
+        {
+          bit_value.size = (int) view.len;
+          bit_value.buf = view.buf;
+          bind_value = &bit_value;
+          a_type = CCI_A_TYPE_BIT;
+          if (u_type == 0)
+            {
+              u_type = CCI_U_TYPE_VARBIT;
+            }
+        }
+      else if (!PyMemoryView_Check (value))
+        {
+          /* bytes and bytearray keep a NUL after their data */
+          bind_value = view.buf;
+        }
+      else
+        {
+          /* A memoryview need not: bind a NUL terminated copy */
+          if (!(temp = PyBytes_FromStringAndSize (view.buf, view.len)))
+            {
+              PyBuffer_Release (&view);
+              return -1;
+            }
+          bind_value = PyBytes_AS_STRING (temp);
+        }
+    }
+  else if (PyObject_IsInstance (value, DecimalType) == 1)
+    {
+      if (!(temp = PyObject_Str (value)))
+        {
+          return -1;
+        }
+      if (!(bind_value = (void *) PyUnicode_AsUTF8AndSize (temp, &size)))
+        {
+          Py_DECREF (temp);
+          return -1;
+        }
+      u_type = CCI_U_TYPE_NUMERIC;
+    }
+  else if (PyObject_CheckBuffer (value))
+    {
+      /*
+       * Other buffers (array.array, numpy arrays) hold typed items, not
+       * bit strings: wrap them in a memoryview to bind their raw bytes
+       */
+      handle_error (CUBRID_ER_NOT_SUPPORTED_TYPE, NULL);
+      return -1;
+    }
+  else if ((iter = PyObject_GetIter (value)) != NULL)
+    {
+      Py_DECREF (iter);
+      return 1;
+    }
+  else
+    {
+      /* Anything else is bound as its str() */
+      PyErr_Clear ();
+      if (!(temp = PyObject_Str (value)))
+        {
+          return -1;
+        }
+      if (!(bind_value = (void *) PyUnicode_AsUTF8AndSize (temp, &size)))
+        {
+          Py_DECREF (temp);
+          return -1;
+        }
+      if (u_type == 0)
+        {
+          u_type = CCI_U_TYPE_CHAR;
+        }
+    }
+
+  res = cci_bind_param (self->handle, index, a_type, bind_value, u_type, 0);
+  if (self->conn->stats_enabled)
+    {
+      self->conn->stats.bind_count++;
+    }
+
+  PyBuffer_Release (&view);
+  Py_XDECREF (temp);
+
+  if (res < 0)
+    {
+      handle_error (res, NULL);
+      return -1;
+    }
+
+  return 0;
+}
+
+static PyObject *
+_cubrid_CursorObject_bind_param (_cubrid_CursorObject * self, PyObject * args)
+{
+  int res, index = -1, bind_type = 0;
+  PyObject *value_obj = NULL;
+
+  if (self->state == CURSOR_STATE_CLOSED)
+    {
+      return handle_error (CUBRID_ER_INVALID_CURSOR, NULL);
+    }
+  if (!self->handle)
+    {
+      return handle_error (CUBRID_ER_SQL_UNPREPARE, NULL);
+    }
+
+  if (!PyArg_ParseTuple (args, "iO|i", &index, &value_obj, &bind_type))
+    {
+      return NULL;
+    }
+
+  res = _cubrid_CursorObject_bind_value (self, index, value_obj, bind_type);
+  if (res < 0)
+    {
+      return NULL;
+    }
+  if (res > 0)
+    {
+      return handle_error (CUBRID_ER_NOT_SUPPORTED_TYPE, NULL);
+    }
+
+  Py_INCREF (Py_None);
+  return Py_None;
+}
+
+static char _cubrid_CursorObject_bind_params__doc__[] =
+  "bind_params(params)\n\
+Bind a sequence of values to the variables of a prepared statement, the\n\
+first value to variable 1, in a single call. Each value is bound as by\n\
+bind_param() without bind_type: int as INT, or BIGINT when it does not\n\
+fit, bytes-like objects as BIT VARYING, decimal.Decimal as NUMERIC,\n\
+None as NULL, bool as 0 or 1, and other objects as their str().\n\
+\n\
+Collections (iterables other than str and bytes) are not bound; the\n\
+method returns the list of their variable indexes, so the caller can\n\
+bind them with bind_set().\n\
+\n\
+Parameters:\n\
+  params: A sequence of values, one per statement variable.\n\
+\n\
+Returns:\n\
+  list: The indexes of the variables left unbound, usually empty.";
+
+static PyObject *
+_cubrid_CursorObject_bind_params (_cubrid_CursorObject * self,
+                                  PyObject * args)
+{
+  PyObject *params, *seq, *deferred, *pos;
+  Py_ssize_t i, n;
+  int res;
+
+  if (self->state == CURSOR_STATE_CLOSED)
+    {
+      return handle_error (CUBRID_ER_INVALID_CURSOR, NULL);
+    }
+  if (!self->handle)
+    {
+      return handle_error (CUBRID_ER_SQL_UNPREPARE, NULL);
+    }
+
+  if (!PyArg_ParseTuple (args, "O", &params))
+    {
+      return NULL;
+    }
+
+  if (!(seq = PySequence_Fast (params, "params must be a sequence")))
+    {
+      return NULL;
+    }
+  if (!(deferred = PyList_New (0)))
+    {
+      Py_DECREF (seq);
+      return NULL;
+    }
+
+  n = PySequence_Fast_GET_SIZE (seq);
+  for (i = 0; i < n; i++)
+    {
+      res = _cubrid_CursorObject_bind_value (self, (int) i + 1,
+                                             PySequence_Fast_GET_ITEM (seq,
+                                                                       i),
+                                             0);
+      if (res > 0)
+        {
+          pos = PyLong_FromSsize_t (i + 1);
+          res = (pos && PyList_Append (deferred, pos) == 0) ? 0 : -1;
+          Py_XDECREF (pos);
+        }
+      if (res < 0)
+        {
+          Py_DECREF (deferred);
+          Py_DECREF (seq);
+          return NULL;
+        }
+    }
+
+  Py_DECREF (seq);
+  return deferred;
+}
+
+static char _cubrid_CursorObject_bind_param_array__doc__[] =
+  "bind_param_array(index, values, bind_type=None)\n\
+Bind a whole column of values to a prepared statement variable, for\n\
+execute_array(). All the columns bound to a statement must have the\n\
+same number of values, one per row to execute.\n\
+\n\
+The column type is taken from bind_type, or else from the first value\n\
+that is not None, with the same mapping as bind_param(). The other\n\
+values must be of the same type, except that int values are accepted\n\
+in a float column. None values are bound as NULL.\n\
+\n\
+Parameters:\n\
+  index (int): The index of the variable in the prepared statement.\n\
+  values: A sequence with the value of the variable for each row.\n\
+  bind_type (optional): The CUBRID column type to bind the values as.\n\
+\n\
+Returns:\n\
+  None: This function does not return a value.";
+
+/*
+ * Set the timeout of the cursor on its handle before an execute. A handle
+ * may come from the statement cache with the timeout another cursor set,
+ * so the connection default is set again for a query_timeout of -1.
+ */
+static void
+_cubrid_CursorObject_set_query_timeout (_cubrid_CursorObject * self)
+{
+  int timeout = self->query_timeout;
+
+  if (timeout < 0)
+    {
+      timeout = self->conn->query_timeout_default;
+    }
+  if (timeout >= 0)
+    {
+      cci_set_query_timeout (self->handle, timeout);
+    }
+}
+
+/*
+ * Allocate a bound array from the arena of the cursor, where it is kept
+ * until execute_array(). Repeated batches of the same shape reuse the
+ * same memory.
+ */
+static void *
+_cubrid_CursorObject_array_buffer (_cubrid_CursorObject * self,
+                                   Py_ssize_t size)
+{
+  return _cubrid_arena_alloc (&self->arena, (size_t) size);
+}
+
+/*
+ * The work of the bind arrays is done: keep for the allocs member the
+ * heap allocations of the calls of this cursor since its last execute,
+ * up to now in this one. The rest of the call counts for the next one.
+ */
+static void
+_cubrid_CursorObject_arena_done (_cubrid_CursorObject * self)
+{
+  _cubrid_arena_reset (&self->arena);
+  self->allocs = self->allocs_pending
+    + (_cubrid_heap_allocs - _cubrid_heap_allocs_mark);
+  self->allocs_pending = 0;
+  _cubrid_heap_allocs_mark = _cubrid_heap_allocs;
+}
+
+static PyObject *
+_cubrid_CursorObject_bind_param_array (_cubrid_CursorObject * self,
+                                       PyObject * args)
+{
+  int res, index = -1, bind_type = 0, u_type, a_type, *null_ind, fits_int;
+  PyObject *values_obj, *values, *first = NULL, *value;
+  Py_ssize_t i, n;
+  void *bind_value;
+
+  if (self->state == CURSOR_STATE_CLOSED)
+    {
+      return handle_error (CUBRID_ER_INVALID_CURSOR, NULL);
+    }
+  if (!self->handle)
+    {
+      return handle_error (CUBRID_ER_SQL_UNPREPARE, NULL);
+    }
+  if (!PyArg_ParseTuple (args, "iO|i", &index, &values_obj, &bind_type))
+    {
+      return NULL;
+    }
+
+  values = PySequence_Fast (values_obj, "values must be a sequence");
+  if (!values)
+    {
+      return NULL;
+    }
+  n = PySequence_Fast_GET_SIZE (values);
+  if (n == 0 || n > INT_MAX
+      || (self->array_size > 0 && n != self->array_size))
+    {
+      Py_DECREF (values);
+      return handle_error (CUBRID_ER_INVALID_PARAM, NULL);
+    }
+
+  /* Array bound handles are not given back to the statement cache */
+  Py_CLEAR (self->sql);
+
+  /* The values sequence owns the str and bytes buffers we point into */
+  if (!self->array_binds && !(self->array_binds = PyList_New (0)))
+    {
+      Py_DECREF (values);
+      return NULL;
+    }
+  res = PyList_Append (self->array_binds, values);
+  Py_DECREF (values);
+  if (res < 0)
+    {
+      return NULL;
+    }
+
+  null_ind = _cubrid_CursorObject_array_buffer (self, n * sizeof (int));
+  if (!null_ind)
+    {
+      return NULL;
+    }
+  for (i = 0; i < n; i++)
+    {
+      value = PySequence_Fast_GET_ITEM (values, i);
+      null_ind[i] = value == Py_None;
+      if (!first && value != Py_None)
+        {
+          first = value;
+        }
+    }
+
+  u_type = bind_type ? bind_type : CCI_U_TYPE_CHAR;
+  a_type = CCI_A_TYPE_STR;
+
+  if (!first)
+    {
+      /* All NULL: the type does not matter */
+      bind_value = _cubrid_CursorObject_array_buffer (self,
+                                                      n * sizeof (char *));
+      if (!bind_value)
+        {
+          return NULL;
+        }
+      memset (bind_value, 0, n * sizeof (char *));
+    }
+  else if (PyLong_Check (first))
+    {
+      CUBRID_LONG_LONG *bignums;
+
+      bignums = _cubrid_CursorObject_array_buffer (self,
+                                                   n * sizeof (*bignums));
+      if (!bignums)
+        {
+          return NULL;
+        }
+      fits_int = 1;
+      for (i = 0; i < n; i++)
+        {
+          value = PySequence_Fast_GET_ITEM (values, i);
+          bignums[i] = 0;
+          if (value == Py_None)
+            {
+              continue;
+            }
+          if (!PyLong_Check (value))
+            {
+              return handle_error (CUBRID_ER_INVALID_ARRAY_TYPE, NULL);
+            }
+          bignums[i] = PyLong_AsLongLong (value);
+          if (bignums[i] == -1 && PyErr_Occurred ())
+            {
+              return NULL;
+            }
+          if (bignums[i] < INT_MIN || bignums[i] > INT_MAX)
+            {
+              fits_int = 0;
+            }
+        }
+
+      if (fits_int && u_type != CCI_U_TYPE_BIGINT)
+        {
+          int *nums = _cubrid_CursorObject_array_buffer (self,
+                                                         n * sizeof (int));
+          if (!nums)
+            {
+              return NULL;
+            }
+          for (i = 0; i < n; i++)
+            {
+              nums[i] = (int) bignums[i];
+            }
+          bind_value = nums;
+          u_type = CCI_U_TYPE_INT;
+          a_type = CCI_A_TYPE_INT;
+        }
+      else
+        {
+          bind_value = bignums;
+          u_type = CCI_U_TYPE_BIGINT;
+          a_type = CCI_A_TYPE_BIGINT;
+        }
+    }
+  else if (PyFloat_Check (first))
+    {
+      double *dnums;
+
+      dnums = _cubrid_CursorObject_array_buffer (self, n * sizeof (double));
+      if (!dnums)
+        {
+          return NULL;
+        }
+      for (i = 0; i < n; i++)
+        {
+          value = PySequence_Fast_GET_ITEM (values, i);
+          dnums[i] = 0;
+          if (value == Py_None)
+            {
+              continue;
+            }
+          if (!PyFloat_Check (value) && !PyLong_Check (value))
+            {
+              return handle_error (CUBRID_ER_INVALID_ARRAY_TYPE, NULL);
+            }
+          dnums[i] = PyFloat_AsDouble (value);
+          if (dnums[i] == -1.0 && PyErr_Occurred ())
+            {
+              return NULL;
+            }
+        }
+      bind_value = dnums;
+      u_type = CCI_U_TYPE_DOUBLE;
+      a_type = CCI_A_TYPE_DOUBLE;
+    }
+  else if (PyDate_Check (first) || PyTime_Check (first))
+    {
+      T_CCI_DATE *dates;
+      int kind = PyDateTime_Check (first) ? CCI_U_TYPE_DATETIME :
+        PyDate_Check (first) ? CCI_U_TYPE_DATE : CCI_U_TYPE_TIME;
+
+      dates = _cubrid_CursorObject_array_buffer (self,
+                                                 n * sizeof (T_CCI_DATE));
+      if (!dates)
+        {
+          return NULL;
+        }
+      memset (dates, 0, n * sizeof (T_CCI_DATE));
+      for (i = 0; i < n; i++)
+        {
+          value = PySequence_Fast_GET_ITEM (values, i);
+          if (value == Py_None)
+            {
+              continue;
+            }
+          if (kind == CCI_U_TYPE_DATETIME ? !PyDateTime_Check (value) :
+              kind == CCI_U_TYPE_DATE ? !PyDate_Check (value)
+              || PyDateTime_Check (value) : !PyTime_Check (value))
+            {
+              return handle_error (CUBRID_ER_INVALID_ARRAY_TYPE, NULL);
+            }
+          if (kind != CCI_U_TYPE_TIME)
+            {
+              dates[i].yr = PyDateTime_GET_YEAR (value);
+              dates[i].mon = PyDateTime_GET_MONTH (value);
+              dates[i].day = PyDateTime_GET_DAY (value);
+            }
+          if (kind == CCI_U_TYPE_DATETIME)
+            {
+              dates[i].hh = PyDateTime_DATE_GET_HOUR (value);
+              dates[i].mm = PyDateTime_DATE_GET_MINUTE (value);
+              dates[i].ss = PyDateTime_DATE_GET_SECOND (value);
+              dates[i].ms = PyDateTime_DATE_GET_MICROSECOND (value) / 1000;
+            }
+          else if (kind == CCI_U_TYPE_TIME)
+            {
+              dates[i].hh = PyDateTime_TIME_GET_HOUR (value);
+              dates[i].mm = PyDateTime_TIME_GET_MINUTE (value);
+              dates[i].ss = PyDateTime_TIME_GET_SECOND (value);
+              dates[i].ms = PyDateTime_TIME_GET_MICROSECOND (value) / 1000;
+            }
+        }
+      bind_value = dates;
+      u_type = kind;
+      a_type = CCI_A_TYPE_DATE;
+    }
+  else if (PyBytes_Check (first)
+           && (u_type == CCI_U_TYPE_BIT || u_type == CCI_U_TYPE_VARBIT))
+    {
+      T_CCI_BIT *bits;
+
+      bits = _cubrid_CursorObject_array_buffer (self,
+                                                n * sizeof (T_CCI_BIT));
+      if (!bits)
+        {
+          return NULL;
+        }
+      memset (bits, 0, n * sizeof (T_CCI_BIT));
+      for (i = 0; i < n; i++)
+        {
+          value = PySequence_Fast_GET_ITEM (values, i);
+          if (value == Py_None)
+            {
+              continue;
+            }
+          if (!PyBytes_Check (value))
+            {
+              return handle_error (CUBRID_ER_INVALID_ARRAY_TYPE, NULL);
+            }
+          bits[i].size = (int) PyBytes_GET_SIZE (value);
+          bits[i].buf = PyBytes_AS_STRING (value);
+        }
+      bind_value = bits;
+      a_type = CCI_A_TYPE_BIT;
+    }
+  else
+    {
+      /* str, bytes and Decimal are bound as strings */
+      char **strs;
+      int is_decimal = PyObject_IsInstance (first, DecimalType) == 1;
+      int is_str = PyUnicode_Check (first);
+
+      if (!is_decimal && !is_str && !PyBytes_Check (first))
+        {
+          return handle_error (CUBRID_ER_NOT_SUPPORTED_TYPE, NULL);
+        }
+      strs = _cubrid_CursorObject_array_buffer (self, n * sizeof (char *));
+      if (!strs)
+        {
+          return NULL;
+        }
+      for (i = 0; i < n; i++)
+        {
+          value = PySequence_Fast_GET_ITEM (values, i);
+          strs[i] = NULL;
+          if (value == Py_None)
+            {
+              continue;
+            }
+          if (is_decimal)
+            {
+              PyObject *s;
+
+              if (PyObject_IsInstance (value, DecimalType) != 1)
+                {
+                  return handle_error (CUBRID_ER_INVALID_ARRAY_TYPE, NULL);
+                }
+              /* Keep the text form alive with the other bound buffers */
+              s = PyObject_Str (value);
+              if (!s)
+                {
+                  return NULL;
+                }
+              res = PyList_Append (self->array_binds, s);
+              Py_DECREF (s);
+              if (res < 0)
+                {
+                  return NULL;
+                }
+              value = s;
+            }
+          else if (is_str ? !PyUnicode_Check (value) : !PyBytes_Check (value))
+            {
+              return handle_error (CUBRID_ER_INVALID_ARRAY_TYPE, NULL);
+            }
+
+          if (PyBytes_Check (value))
+            {
+              strs[i] = PyBytes_AS_STRING (value);
+            }
+          else if (!(strs[i] = (char *) PyUnicode_AsUTF8 (value)))
+            {
+              return NULL;
+            }
+        }
+      bind_value = strs;
+      if (is_decimal)
+        {
+          u_type = CCI_U_TYPE_NUMERIC;
+        }
+    }
+
+  if (self->array_size == 0)
+    {
+      res = cci_bind_param_array_size (self->handle, (int) n);
+      if (res < 0)
+        {
+          return handle_error (res, NULL);
+        }
+      self->array_size = (int) n;
+    }
+
+  res = cci_bind_param_array (self->handle, index, a_type, bind_value,
+                              null_ind, u_type);
+  if (res < 0)
+    {
+      return handle_error (res, NULL);
+    }
+
+  Py_INCREF (Py_None);
+  return Py_None;
+}
+
+static char _cubrid_CursorObject_execute_array__doc__[] =
+  "execute_array([keep_errors])\n\
+Execute the prepared statement once for each row of the arrays bound\n\
+with bind_param_array(), sending all the rows in a single request.\n\
+The bound arrays are released afterwards.\n\
+\n\
+Parameters::\n\
+  keep_errors: bool, report the rows that failed in the result list\n\
+  instead of raising (default False)\n\
+\n\
+Return values::\n\
+  A list with the number of rows affected by each executed row.\n\
+  If a row fails, the error of the first failed row is raised, with\n\
+  its 0-based index as the row attribute, or, with keep_errors, the\n\
+  (negative) error code is its list item. The server executes all the\n\
+  rows of the request in any case: the rows after a failed one are\n\
+  applied, and committed in autocommit mode.";
+
+/*
+ * Set the row attribute of the exception being raised to the index of
+ * the failed row of a batch.
+ */
+static void
+_cubrid_set_error_row (int row)
+{
+  PyObject *type, *value, *tb, *index;
+
+  PyErr_Fetch (&type, &value, &tb);
+  PyErr_NormalizeException (&type, &value, &tb);
+  if (value && (index = PyLong_FromLong (row)))
+    {
+      if (PyObject_SetAttrString (value, "row", index) < 0)
+        {
+          PyErr_Clear ();
+        }
+      Py_DECREF (index);
+    }
+  PyErr_Restore (type, value, tb);
+}
+
+static PyObject *
+_cubrid_CursorObject_execute_array (_cubrid_CursorObject * self,
+                                    PyObject * args)
+{
+  int res, i, count, total = 0, keep_errors = 0, canceled;
+  long gen;
+  T_CCI_QUERY_RESULT *qr = NULL;
+  T_CCI_ERROR error;
+  PyObject *results, *val;
+  CUBRID_LONG_LONG start, elapsed;
+
+  if (self->state == CURSOR_STATE_CLOSED)
+    {
+      return handle_error (CUBRID_ER_INVALID_CURSOR, NULL);
+    }
+  if (!self->handle)
+    {
+      return handle_error (CUBRID_ER_SQL_UNPREPARE, NULL);
+    }
+  if (!PyArg_ParseTuple (args, "|i", &keep_errors))
+    {
+      return NULL;
+    }
+  if (self->array_size == 0)
+    {
+      return handle_error (CUBRID_ER_PARAM_UNBIND, NULL);
+    }
+
+  _cubrid_CursorObject_set_query_timeout (self);
+
+  start = _cubrid_stats_start (self->conn);
+  gen = _cubrid_exec_begin (self->conn);
+  _cubrid_CursorObject_new_result (self);
+  CUBRID_BEGIN_ALLOW_THREADS (self->conn);
+  if (_cubrid_exec_canceled (self->conn, gen))
+    {
+      res = CUBRID_ER_QUERY_CANCELED;
+    }
+  else
+    {
+      res = cci_execute_array (self->handle, &qr, &error);
+    }
+  CUBRID_END_ALLOW_THREADS (self->conn);
+  canceled = _cubrid_exec_end (self->conn, gen);
+  elapsed = _cubrid_stats_elapsed (start);
+  if (self->conn->stats_enabled)
+    {
+      self->conn->stats.execute_count++;
+      self->conn->stats.execute_ns += elapsed;
+    }
+
+  Py_CLEAR (self->array_binds);
+  self->array_size = 0;
+  _cubrid_CursorObject_arena_done (self);
+
+  if (res < 0)
+    {
+      _cubrid_CursorObject_trace (self, elapsed, -1);
+      return handle_execute_error (res, &error, canceled);
+    }
+  count = res;
+
+  if (!(results = PyList_New (count)))
+    {
+      cci_query_result_free (qr, count);
+      return NULL;
+    }
+  for (i = 1; i <= count; i++)
+    {
+      res = CCI_QUERY_RESULT_RESULT (qr, i);
+      if (res < 0 && keep_errors)
+        {
+          res = CCI_QUERY_RESULT_ERR_NO (qr, i);
+        }
+      else if (res < 0)
+        {
+          error.err_code = CCI_QUERY_RESULT_ERR_NO (qr, i);
+          snprintf (error.err_msg, sizeof (error.err_msg), "%s",
+                    CCI_QUERY_RESULT_ERR_MSG (qr, i) ?
+                    CCI_QUERY_RESULT_ERR_MSG (qr, i) : "");
+          Py_DECREF (results);
+          cci_query_result_free (qr, count);
+          _cubrid_CursorObject_trace (self, elapsed, -1);
+          handle_error (CCI_ER_DBMS, &error);
+          _cubrid_set_error_row (i - 1);
+          return NULL;
+        }
+      if (res > 0)
+        {
+          total += res;
+        }
+
+      if (!(val = PyLong_FromLong (res)))
+        {
+          Py_DECREF (results);
+          cci_query_result_free (qr, count);
+          return NULL;
+        }
+      PyList_SET_ITEM (results, i - 1, val);
+    }
+  cci_query_result_free (qr, count);
+
+  self->row_count = total;
+  _cubrid_CursorObject_trace (self, elapsed, total);
+
+  return results;
+}
+
+static char _cubrid_CursorObject_bind_lob__doc__[] = "bind_lob(n, lob)\n\
+bind BLOB/CLOB type in prepare() variable.\n\
+\n\
+Parameters::\n\
+  index: string, actual value for binding\n\
+  lob: LOB Object\n\
+\n\
+Example::\n\
+  import _cubrid\n\
+  con = _cubrid.connect('CUBRID:localhost:33000:demodb:::', 'public')\n\
+  cur = con.cursor()\n\
+  \n\
+  cur.prepare('create table test_blob(image BLOB)')\n\
+  cur.execute()\n\
+  cur.prepare('create table test_clob(image CLOB)')\n\
+  cur.execute()\n\
+  \n\
+  lob = con.lob()\n\
+  \n\
+  cur.prepare('insert into test_blob values (?)')\n\
+  lob.imports('123.jpg') # or lob.imports('123.jpg', 'B')\n\
+  cur.bind_lob(1, lob)\n\
+  cur.execute()\n\
+  lob.close()\n\
+  \n\
+  cur.prepare('insert into test_clob values (?)')\n\
+  lob.imports('123.jpg', 'C')\n\
+  cur.bind_lob(1, lob)\n\
+  cur.execute()\n\
+  lob.close()\n\
+  \n\
+  cur.close()\n\
+  con.close()";
+
+static PyObject *
+_cubrid_CursorObject_bind_lob (_cubrid_CursorObject * self, PyObject * args)
+{
+  _cubrid_LobObject *lob;
+  int index, res;
+
+  if (self->state == CURSOR_STATE_CLOSED)
+    {
+      return handle_error (CUBRID_ER_INVALID_CURSOR, NULL);
+    }
+  if (!PyArg_ParseTuple (args, "iO!", &index, &_cubrid_LobObject_type, &lob))
+    {
+      return NULL;
+    }
+
+  if (lob->type == CUBRID_BLOB)
+    {
+      res =
+        cci_bind_param (self->handle, index, CCI_A_TYPE_BLOB,
+                        (void *) lob->blob, CCI_U_TYPE_BLOB, CCI_BIND_PTR);
+      if (res < 0)
+        {
+          return handle_error (res, NULL);
+        }
+    }
+  else
+    {
+      res =
+        cci_bind_param (self->handle, index, CCI_A_TYPE_CLOB,
+                        (void *) lob->clob, CCI_U_TYPE_CLOB, CCI_BIND_PTR);
+      if (res < 0)
+        {
+          return handle_error (res, NULL);
+        }
+    }
+
+  Py_INCREF (Py_None);
+  return Py_None;
+}
+
+static char _cubrid_CursorObject_bind_set__doc__[] = "bind_set(index,data)\n\
+bind_set LIST/SET/MULTISET data. To use this function.\n\
+index:actual value for binding\n\
+data:tuple object \n\
+\n\
+    Example::\n\
+    con = _cubrid.connect('CUBRID:localhost:30000:demodb:dba::')\n\
+    c = con.cursor()\n\
+    s = con.set()\n\
+    value = ('1','2')\n\
+    s.imports(value ,cubrid_db.CCI_U_TYPE_INT)\n\
+    c.prepare('''INSERT INTO set_tbl_int VALUES(?);''')\n\
+    c.bind_set(1,s)\n\
+    c.execute()\n\
+    con.commit()\n\
+    c.close()\n\
+    con.close()";
+
+static PyObject *
+_cubrid_CursorObject_bind_Set (_cubrid_CursorObject * self, PyObject * args)
+{
+  _cubrid_SetObject *set;
+  int index, res;
+
+  if (self->state == CURSOR_STATE_CLOSED)
+    {
+      return handle_error (CUBRID_ER_INVALID_CURSOR, NULL);
+    }
+  if (!PyArg_ParseTuple (args, "iO!", &index, &_cubrid_SetObject_type, &set))
+    {
+      return handle_error (CUBRID_ER_INVALID_PARAM, NULL);
+    }
+
+  res =
+    cci_bind_param (self->handle, index, CCI_A_TYPE_SET,
+                    (void *) set->data, CCI_U_TYPE_SET, CCI_BIND_PTR);
+  if (res < 0)
+    {
+      return handle_error (res, NULL);
+    }
+  self->allocs_pending += set->allocs;
+  set->allocs = 0;
+
+  Py_INCREF (Py_None);
+  return Py_None;
+}
+
+/*
+ * Build the column name objects of the current result. They are interned
+ * and shared by the description and by every dict and Row row, so rows
+ * do not create or hash a name per cell. When the names did not change
+ * (e.g. the same statement executed again), the previous objects and the
+ * Row type made for them are kept.
+ */
+static int
+_cubrid_CursorObject_set_col_names (_cubrid_CursorObject * self)
+{
+  PyObject *names, *name;
+  int i, count = (self->col_count > 0) ? self->col_count : 0;
+
+  if (!(names = PyTuple_New (count)))
+    {
+      return -1;
+    }
+
+  for (i = 0; i < count; i++)
+    {
+      name =
+        PyUnicode_InternFromString (CCI_GET_RESULT_INFO_NAME
+                                    (self->col_info, i + 1));
+      if (!name)
+        {
+          Py_DECREF (names);
+          return -1;
+        }
+      PyTuple_SET_ITEM (names, i, name);
+    }
+
+  if (self->col_names
+      && PyObject_RichCompareBool (names, self->col_names, Py_EQ) == 1)
+    {
+      Py_DECREF (names);
+      return 0;
+    }
+
+  Py_XDECREF (self->col_names);
+  self->col_names = names;
+  Py_CLEAR (self->row_type);
+
+  return 0;
+}
+
+/*
+ * Whether the statement is the one the description was built for. The
+ * statement cache closes the handles it evicts, and the server may give
+ * the same handle id to another statement taken from the cache later.
+ */
+static int
+_cubrid_CursorObject_same_sql (_cubrid_CursorObject * self)
+{
+  if (!self->desc_sql || !self->sql)
+    {
+      return self->desc_sql == self->sql;
+    }
+  return PyUnicode_Compare (self->desc_sql, self->sql) == 0;
+}
+
+/*
+ * Called after each execute that returns a result set. When the cursor
+ * describes the same result as before (the same statement, handle and
+ * column info, i.e. the statement executed again or taken again from the
+ * statement cache), the column names and the description are kept.
+ * Otherwise the names are rebuilt and the description is dropped; it is
+ * only built again when Python reads it.
+ */
+static int
+_cubrid_CursorObject_update_columns (_cubrid_CursorObject * self)
+{
+  if (self->desc_handle == self->handle
+      && self->desc_col_info == self->col_info
+      && self->desc_gen == self->conn->stmt_cache_gen && self->col_names
+      && _cubrid_CursorObject_same_sql (self))
+    {
+      return 0;
+    }
+
+  Py_CLEAR (self->description);
+  self->desc_handle = 0;
+  if (_cubrid_CursorObject_set_col_names (self) < 0)
+    {
+      return -1;
+    }
+  self->desc_handle = self->handle;
+  self->desc_col_info = self->col_info;
+  self->desc_gen = self->conn->stmt_cache_gen;
+  Py_XINCREF (self->sql);
+  Py_XSETREF (self->desc_sql, self->sql);
+
+  return 0;
+}
+
+static int
+_cubrid_CursorObject_set_description (_cubrid_CursorObject * self)
+{
+  PyObject *desc, *item, *name;
+  int i;
+  int datatype, precision, scale, nullable;
+
+  if (self->state == CURSOR_STATE_CLOSED)
+    {
+      return 0;
+    }
+  if (self->col_count == 0)
+    {
+      Py_XDECREF (self->description);
+      self->description = PyTuple_New (0);
+      return 0;
+    }
+
+  desc = (PyObject *) PyTuple_New (self->col_count);
+  if (!desc)
+    {
+      return -1;
+    }
+
+  for (i = 1; i <= self->col_count; i++)
+    {
+      item = PyTuple_New (7);
+
+      name = PyTuple_GET_ITEM (self->col_names, i - 1);
+      Py_INCREF (name);
+      precision = CCI_GET_RESULT_INFO_PRECISION (self->col_info, i);
+      scale = CCI_GET_RESULT_INFO_SCALE (self->col_info, i);
+      nullable =
+        (CCI_GET_RESULT_INFO_IS_NON_NULL (self->col_info, i)) ? 0 : 1;
+      datatype = CCI_GET_RESULT_INFO_TYPE (self->col_info, i);
+
+      PyTuple_SetItem (item, 0, name);
+      PyTuple_SetItem (item, 1, PyLong_FromLong (datatype));
+      PyTuple_SetItem (item, 2, PyLong_FromLong (0));
+      PyTuple_SetItem (item, 3, PyLong_FromLong (0));
+      PyTuple_SetItem (item, 4, PyLong_FromLong (precision));
+      PyTuple_SetItem (item, 5, PyLong_FromLong (scale));
+      PyTuple_SetItem (item, 6, PyLong_FromLong (nullable));
+
+      PyTuple_SetItem (desc, i - 1, item);
+    }
+
+  Py_XDECREF (self->description);
+  self->description = desc;
+  return 0;
+}
+
+static char _cubrid_CursorObject_result_info__doc__[] = "result_info(n)\n\
+returns a sequence of 15-item sequences.\n\
+Each of these sequence contails information describing one result column::\n\
+ (datatype,\n\
+  scale,\n\
+  precision,\n\
+  col_name,\n\
+  attr_name,\n\
+  class_name,\n\
+  not_null,\n\
+  default_value,\n\
+  auto_increment,\n\
+  unique_key,\n\
+  primary_key,\n\
+  foreign_key,\n\
+  reverse_index,\n\
+  reverse_unique,\n\
+  shared)\n\
+values of datatype will map the following::\n\
+  char                 1\n\
+  string,varchar       2\n\
+  nchar                3\n\
+  varnchar             4\n\
+  bit                  5\n\
+  varbit               6\n\
+  numeric              7\n\
+  int                  8\n\
+  short                9\n\
+  monetary             10\n\
+  float                11\n\
+  double               12\n\
+  date                 13\n\
+  time                 14\n\
+  timestamp            15\n\
+  object               19\n\
+  set                  32\n\
+  multiset             64\n\
+  sequence             96\n\
+This function will return none if there is no result set.\n\
+If user not specifies the parameter row, it will return all\n\
+column's information.\n\
+If user specify row, it will return the specified column's information.\n\
+\n\
+row: int, the column you want to get the information.\n\
+\n\
+Example::\n\
+  import _cubrid\n\
+  con = _cubrid.connect('CUBRID:localhost:33000:demodb:::', 'public')\n\
+  cur = con.cursor()\n\
+  cur.prepare('select * from test_cubrid')\n\
+  cur.execute()\n\
+  infos = cur.result_info()\n\
+  for info in infos:\n\
+      print info\n\
+  print cur.result_info(1)\n\
+  cur.close()\n\
+  con.close()";
+
+static PyObject *
+_cubrid_CursorObject_result_info (_cubrid_CursorObject * self,
+                                  PyObject * args)
+{
+  PyObject *result, *item;
+  int i, j, n = 0, len = 0;
+
+  if (self->state == CURSOR_STATE_CLOSED)
+    {
+      return handle_error (CUBRID_ER_INVALID_CURSOR, NULL);
+    }
+  if (!PyArg_ParseTuple (args, "|i", &n))
+    {
+      return NULL;
+    }
+
+  if (self->col_count == 0)
+    {
+      Py_INCREF (Py_None);
+      return Py_None;
+    }
+
+  if (n < 0 || n > self->col_count)
+    {
+      return handle_error (CUBRID_ER_INVALID_PARAM, NULL);
+    }
+
+  if (n != 0)
+    {
+      i = n;
+      len = n;
+    }
+  else
+    {
+      i = 1;
+      len = self->col_count;
+    }
+
+  result = (PyObject *) PyTuple_New (len - i + 1);
+
+  for (j = 0; i <= len; i++, j++)
+    {
+      char *col_name = NULL, *real_attr = NULL;
+      char *class_name = NULL, *default_value = NULL;
+      int type, precision, scale, not_null, auto_increment, unique_key,
+        primary_key, foreign_key, reverse_index, resverse_unique, shared;
+
+      item = PyTuple_New (15);
+
+      type = CCI_GET_RESULT_INFO_TYPE (self->col_info, i);
+      not_null = CCI_GET_RESULT_INFO_IS_NON_NULL (self->col_info, i);
+      scale = CCI_GET_RESULT_INFO_SCALE (self->col_info, i);
+      precision = CCI_GET_RESULT_INFO_PRECISION (self->col_info, i);
+      col_name = CCI_GET_RESULT_INFO_NAME (self->col_info, i);
+      real_attr = CCI_GET_RESULT_INFO_ATTR_NAME (self->col_info, i);
+      class_name = CCI_GET_RESULT_INFO_CLASS_NAME (self->col_info, i);
+      default_value = CCI_GET_RESULT_INFO_DEFAULT_VALUE (self->col_info, i);
+      auto_increment =
+        CCI_GET_RESULT_INFO_IS_AUTO_INCREMENT (self->col_info, i);
+      unique_key = CCI_GET_RESULT_INFO_IS_UNIQUE_KEY (self->col_info, i);
+      primary_key = CCI_GET_RESULT_INFO_IS_PRIMARY_KEY (self->col_info, i);
+      foreign_key = CCI_GET_RESULT_INFO_IS_FOREIGN_KEY (self->col_info, i);
+      reverse_index =
+        CCI_GET_RESULT_INFO_IS_REVERSE_INDEX (self->col_info, i);
+      resverse_unique =
+        CCI_GET_RESULT_INFO_IS_REVERSE_UNIQUE (self->col_info, i);
+      shared = CCI_GET_RESULT_INFO_IS_SHARED (self->col_info, i);
+
+      PyTuple_SetItem (item, 0, PyLong_FromLong (type));
+      PyTuple_SetItem (item, 1, PyLong_FromLong (not_null));
+      PyTuple_SetItem (item, 2, PyLong_FromLong (scale));
+      PyTuple_SetItem (item, 3, PyLong_FromLong (precision));
+      PyTuple_SetItem (item, 4,
+                       PyUnicode_FromString (col_name));
+      PyTuple_SetItem (item, 5,
+                       PyUnicode_FromString (real_attr));
+      PyTuple_SetItem (item, 6,
+                       PyUnicode_FromString (class_name));
+      PyTuple_SetItem (item, 7,
+                       PyUnicode_FromString (default_value));
+      PyTuple_SetItem (item, 8,
+                       PyLong_FromLong (auto_increment));
+      PyTuple_SetItem (item, 9, PyLong_FromLong (unique_key));
+      PyTuple_SetItem (item, 10, PyLong_FromLong (primary_key));
+      PyTuple_SetItem (item, 11, PyLong_FromLong (foreign_key));
+      PyTuple_SetItem (item, 12,
+                       PyLong_FromLong (reverse_index));
+      PyTuple_SetItem (item, 13,
+                       PyLong_FromLong (resverse_unique));
+      PyTuple_SetItem (item, 14, PyLong_FromLong (shared));
+
+      PyTuple_SetItem (result, j, item);
+    }
+
+  return result;
+}
+
+static char _cubrid_CursorObject_execute__doc__[] =
+  "execute([option[,max_col_size]])\n\
+Executes a prepared Query.\n\
+A option can be used when retrieving the query result from the server.\n\
+A option can be classified as synchronous or asynchronous. \n\
+If the option is set to CUBRID_EXEC_QUERY_ALL, a synchronous mode(sync_mode) \n\
+is used to retrieve query results immediately after executing prepared queries. \n\
+If it is set to CUBRID_EXEC_ASYNC, an asynchronous mode (async_mode) is used to\n\
+retrieve the result immediately each time a query result is created.\n\
+The option is set to CUBRID_EXEC_QUERY_ALL by default, and in such\n\
+cases the following rules are applied:\n\
+  - The return value is the result of the first query.\n\
+  - If an error occurs in any query, the execution is processed\n\
+    as a failure.\n\
+  - For a query composed of in a query composed of q1 q2 q3\n\
+    if an error occurs in q2 after q1 succeeds the execution,\n\
+    the result of q1 remains valid. That is, the previous successful\n\
+    query executions are not rolled back when an error occurs.\n\
+  - If a query is executed successfully, the result of the second\n\
+    query can be obtained using next_result().\n\
+max_col is a value that is used to determine the size of the column\n\
+to be transferred to the client when the type of the column of the\n\
+prepared query is CHAR, VARCHAR, NCHAR, VARNCHAR, BIT or VARBIT.\n\
+If it is set to 0, all data is transferred.\n\
+\n\
+Parameters::\n\
+  option: Exec option, option maybe the following values:\n\
+    CUBRID_EXEC_ASYNC\n\
+    CUBRID_EXEC_QUERY_ALL\n\
+    CUBRID_EXEC_QUERY_INFO\n\
+    CUBRID_EXEC_ONLY_QUERY_PLAN\n\
+    CUBRID_EXEC_THREAD\n\
+\n\
+Return values::\n\
+  SELECT: Returns the number of results in sync mode,\n\
+          returns 0 in asynchronism mode.\n\
+  INSERT, UPDATE: Returns the number of tuples reflected.\n\
+  Others queries: 0\n";
+
+static PyObject *
+_cubrid_CursorObject_execute (_cubrid_CursorObject * self, PyObject * args)
+{
+  int res, option = 0, max_col_size = 0, canceled;
+  long gen;
+  T_CCI_ERROR error;
+  T_CCI_COL_INFO *res_col_info;
+  T_CCI_SQLX_CMD res_sql_type;
+  int res_col_count;
+  CUBRID_LONG_LONG start, elapsed;
+
+  if (self->state == CURSOR_STATE_CLOSED)
+    {
+      return handle_error (CUBRID_ER_INVALID_CURSOR, NULL);
+    }
+  if (!PyArg_ParseTuple (args, "|ii", &option, &max_col_size))
+    {
+      return NULL;
+    }
+
+  _cubrid_CursorObject_set_query_timeout (self);
+
+  start = _cubrid_stats_start (self->conn);
+  gen = _cubrid_exec_begin (self->conn);
+  _cubrid_CursorObject_new_result (self);
+  CUBRID_BEGIN_ALLOW_THREADS (self->conn);
+  if (_cubrid_exec_canceled (self->conn, gen))
+    {
+      res = CUBRID_ER_QUERY_CANCELED;
+    }
+  else
+    {
+      res = cci_execute (self->handle, option, max_col_size, &error);
+    }
+  CUBRID_END_ALLOW_THREADS (self->conn);
+  canceled = _cubrid_exec_end (self->conn, gen);
+  if (self->array_size == 0)
+    {
+      _cubrid_CursorObject_arena_done (self);
+    }
+  elapsed = _cubrid_stats_elapsed (start);
+  if (self->conn->stats_enabled)
+    {
+      self->conn->stats.execute_count++;
+      self->conn->stats.execute_ns += elapsed;
+    }
+  if (res < 0)
+    {
+      /* Do not cache a handle that may have gone stale */
+      Py_CLEAR (self->sql);
+      _cubrid_CursorObject_trace (self, elapsed, -1);
+      return handle_execute_error (res, &error, canceled);
+    }
+
+  res_col_info =
+    cci_get_result_info (self->handle, &res_sql_type, &res_col_count);
+  if (res_sql_type == SQLX_CMD_SELECT && !res_col_info)
+    {
+      return handle_error (CUBRID_ER_CANNOT_GET_COLUMN_INFO, NULL);
+    }
+
+  self->col_info = res_col_info;
+  self->sql_type = res_sql_type;
+  self->col_count = res_col_count;
+
+  if (_cubrid_stmt_changes_schema (res_sql_type))
+    {
+      Py_CLEAR (self->sql);
+      _cubrid_schema_changed (self->conn);
+    }
+
+  switch (res_sql_type)
+    {
+    case SQLX_CMD_SELECT:
+    case SQLX_CMD_INSERT:
+    case SQLX_CMD_UPDATE:
+    case SQLX_CMD_DELETE:
+    case SQLX_CMD_CALL:
+      self->row_count = res;
+      break;
+    default:
+      self->row_count = -1;
+      break;
+    }
+
+  _cubrid_CursorObject_trace (self, elapsed, res);
+
+  if (res_sql_type == SQLX_CMD_SELECT)
+    {
+      int ret;
+
+      if (_cubrid_CursorObject_update_columns (self) < 0)
+        {
+          return NULL;
+        }
+      CUBRID_BEGIN_ALLOW_THREADS (self->conn);
+      ret = cci_cursor (self->handle, 1, CCI_CURSOR_CURRENT, &error);
+      CUBRID_END_ALLOW_THREADS (self->conn);
+      if (ret < 0 && ret != CCI_ER_NO_MORE_DATA)
+        {
+          return handle_error (ret, &error);
+        }
+    }
+
+  return PyLong_FromLong (res);
+}
+
+/* The powers of ten a double holds exactly */
+static const double _cubrid_pow10[] = {
+  1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+  1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
+/* x * 10^k, rounded more than once when |k| > 22 */
+static double
+_cubrid_scale10 (double x, int k)
+{
+  for (; k > 22; k -= 22)
+    {
+      x *= 1e22;
+    }
+  for (; k < -22; k += 22)
+    {
+      x /= 1e22;
+    }
+  return k >= 0 ? x * _cubrid_pow10[k] : x / _cubrid_pow10[-k];
+}
+
+/*
+ * The double nearest to n * 10^q, for an integer 0 <= n < 10^9. Either
+ * operand is exact and the single multiplication or division rounds
+ * correctly, as strtod would. Above 10^22 the part of 10^q past 10^22 is
+ * folded into n first: n * 10^(q - 22) stays exact as long as
+ * n * 5^(q - 22) < 2^53, which holds up to FLT_MAX. Only the values
+ * below about 1e-13 would need a second rounding and are parsed instead,
+ * with the C strtod: fetch_columns() runs without the GIL, and the text
+ * has no decimal point the locale could change.
+ */
+static double
+_cubrid_decimal_to_double (double n, int q)
+{
+  char num[32];
+
+  if (q >= 0 && q <= 22)
+    {
+      return n * _cubrid_pow10[q];
+    }
+  if (q < 0 && q >= -22)
+    {
+      return n / _cubrid_pow10[-q];
+    }
+  if (q > 22 && q <= 22 + 17)
+    {
+      return n * _cubrid_pow10[q - 22] * 1e22;
+    }
+  PyOS_snprintf (num, sizeof (num), "%.0fe%d", n, q);
+  return strtod (num, NULL);
+}
+
+/*
+ * Widen a single precision value to the double Python would get from its
+ * shortest round-tripping decimal form, so FLOAT columns fetched in binary
+ * still compare equal to the literals that were stored (1.1, not
+ * 1.100000023841858). Integers are exact in both types. Otherwise the
+ * value is scaled to 6 to 9 significant digits, rounded to an integer
+ * and scaled back, and the first form that gives the float back is used.
+ */
+static double
+_cubrid_float_to_double (float value)
+{
+  double d = (double) value, a = fabs (d), n, r;
+  int exp, prec;
+
+  if (a < 16777216.0 && d == (double) (int) d)
+    {
+      return d;
+    }
+  if (!isfinite (d))
+    {
+      return d;
+    }
+
+  /* Decimal exponent of the first digit, log10() may be one off */
+  exp = (int) floor (log10 (a));
+  if (_cubrid_scale10 (a, -exp) >= 10.0)
+    {
+      exp++;
+    }
+  else if (_cubrid_scale10 (a, -exp) < 1.0)
+    {
+      exp--;
+    }
+
+  for (prec = FLT_DIG; prec <= FLT_DIG + 3; prec++)
+    {
+      n = rint (_cubrid_scale10 (a, prec - 1 - exp));
+      r = _cubrid_decimal_to_double (n, exp - prec + 1);
+      if (d < 0)
+        {
+          r = -r;
+        }
+      if ((float) r == value)
+        {
+          return r;
+        }
+    }
+
+  return d;
+}
+
+/* Days since 1970-01-01 of a proleptic Gregorian date */
+static int
+_cubrid_days_from_civil (int y, int m, int d)
+{
+  int era, yoe, doy, doe;
+
+  y -= m <= 2;
+  era = (y >= 0 ? y : y - 399) / 400;
+  yoe = y - era * 400;
+  doy = (153 * (m + (m > 2 ? -3 : 9)) + 2) / 5 + d - 1;
+  doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+  return era * 146097 + doe - 719468;
+}
+
+/*
+ * Parse a zone offset such as "+09:00", "-0530" or "Z" to seconds east
+ * of UTC. Returns -1 for region names ("Asia/Seoul KST").
+ */
+static int
+_cubrid_parse_tz_offset (const char *tz, int *offset)
+{
+  int sign, hh, mm = 0;
+
+  if (tz[0] == 'Z' && tz[1] == '\0')
+    {
+      *offset = 0;
+      return 0;
+    }
+  if (tz[0] != '+' && tz[0] != '-')
+    {
+      return -1;
+    }
+  sign = tz[0] == '-' ? -1 : 1;
+  tz++;
+  if (!Py_ISDIGIT (tz[0]) || !Py_ISDIGIT (tz[1]))
+    {
+      return -1;
+    }
+  hh = (tz[0] - '0') * 10 + (tz[1] - '0');
+  tz += 2;
+  if (*tz == ':')
+    {
+      tz++;
+    }
+  if (Py_ISDIGIT (tz[0]) && Py_ISDIGIT (tz[1]))
+    {
+      mm = (tz[0] - '0') * 10 + (tz[1] - '0');
+      tz += 2;
+    }
+  if (*tz != '\0' && *tz != ' ')
+    {
+      return -1;
+    }
+
+  *offset = sign * (hh * 3600 + mm * 60);
+  return 0;
+}
+
+/*
+ * Return a new reference to the tzinfo of a CUBRID zone string: a
+ * datetime.timezone for offsets, a zoneinfo.ZoneInfo for region names.
+ * The objects are cached by zone string. None is returned when the
+ * region is unknown to Python (or zoneinfo is missing, before 3.9), after
+ * a RuntimeWarning that is issued once per zone string.
+ */
+static PyObject *
+_cubrid_tzinfo_from_string (const char *tz)
+{
+  PyObject *tzinfo, *cached, *delta, *name;
+  const char *end;
+  int offset, res;
+
+  if (tz == NULL || *tz == '\0')
+    {
+      Py_INCREF (Py_None);
+      return Py_None;
+    }
+
+  /* Entries are never replaced, see the end of the function */
+  Py_BEGIN_CRITICAL_SECTION (_cubrid_tzinfo_cache);
+  tzinfo = PyDict_GetItemString (_cubrid_tzinfo_cache, tz);
+  Py_XINCREF (tzinfo);
+  Py_END_CRITICAL_SECTION ();
+  if (tzinfo != NULL)
+    {
+      return tzinfo;
+    }
+
+  if (_cubrid_parse_tz_offset (tz, &offset) == 0)
+    {
+      if (offset == 0)
+        {
+          tzinfo = PyDateTime_TimeZone_UTC;
+          Py_INCREF (tzinfo);
+        }
+      else
+        {
+          delta = PyDelta_FromDSU (0, offset, 0);
+          if (delta == NULL)
+            {
+              return NULL;
+            }
+          tzinfo = PyTimeZone_FromOffset (delta);
+          Py_DECREF (delta);
+          if (tzinfo == NULL)
+            {
+              return NULL;
+            }
+        }
+    }
+  else
+    {
+      /* The region name is followed by its abbreviation */
+      end = strchr (tz, ' ');
+      name = PyUnicode_FromStringAndSize (tz, end ? end - tz
+                                          : (Py_ssize_t) strlen (tz));
+      if (name == NULL)
+        {
+          return NULL;
+        }
+      tzinfo = NULL;
+      if (_cubrid_zoneinfo != Py_None)
+        {
+          tzinfo = PyObject_CallFunctionObjArgs (_cubrid_zoneinfo, name, NULL);
+        }
+      Py_DECREF (name);
+      if (tzinfo == NULL)
+        {
+          PyErr_Clear ();
+          if (PyErr_WarnFormat (PyExc_RuntimeWarning, 1,
+                                "unknown time zone '%s', its values are "
+                                "returned as naive datetimes", tz) < 0)
+            {
+              return NULL;
+            }
+          Py_INCREF (Py_None);
+          tzinfo = Py_None;
+        }
+    }
+
+  /* Keep the first tzinfo cached for tz if another thread added one */
+  res = 0;
+  Py_BEGIN_CRITICAL_SECTION (_cubrid_tzinfo_cache);
+  cached = PyDict_GetItemString (_cubrid_tzinfo_cache, tz);
+  if (cached != NULL)
+    {
+      Py_INCREF (cached);
+      Py_SETREF (tzinfo, cached);
+    }
+  else
+    {
+      res = PyDict_SetItemString (_cubrid_tzinfo_cache, tz, tzinfo);
+    }
+  Py_END_CRITICAL_SECTION ();
+  if (res < 0)
+    {
+      Py_DECREF (tzinfo);
+      return NULL;
+    }
+
+  return tzinfo;
+}
+
+/* Microseconds since 1970-01-01 00:00 of a date and time */
+static CUBRID_LONG_LONG
+_cubrid_epoch_us (const T_CCI_DATE * dt, int us)
+{
+  CUBRID_LONG_LONG value;
+
+  value = _cubrid_days_from_civil (dt->yr, dt->mon, dt->day);
+  value = value * 86400 + dt->hh * 3600 + dt->mm * 60 + dt->ss;
+  return value * 1000000 + us;
+}
+
+/*
+ * Convert a DATETIME or TIMESTAMP value, with the zone string tz for the
+ * TZ and LTZ types, to a datetime.datetime (aware when tz is given), or
+ * to int microseconds since the epoch (UTC for the zoned types) when the
+ * cursor has epoch_datetimes set.
+ */
+static PyObject *
+_cubrid_CursorObject_datetime_to_pyvalue (_cubrid_CursorObject * self,
+                                          const T_CCI_DATE * dt, int us,
+                                          const char *tz)
+{
+  PyObject *tzinfo, *val, *delta;
+  CUBRID_LONG_LONG epoch = 0;
+  int offset;
+
+  if (self->epoch_datetimes)
+    {
+      epoch = _cubrid_epoch_us (dt, us);
+      if (tz == NULL || *tz == '\0')
+        {
+          return PyLong_FromLongLong (epoch);
+        }
+      if (_cubrid_parse_tz_offset (tz, &offset) == 0)
+        {
+          return PyLong_FromLongLong (epoch - offset * (CUBRID_LONG_LONG) 1000000);
+        }
+    }
+
+  tzinfo = _cubrid_tzinfo_from_string (tz);
+  if (tzinfo == NULL)
+    {
+      return NULL;
+    }
+  val = PyDateTimeAPI->DateTime_FromDateAndTime (dt->yr, dt->mon, dt->day,
+                                                 dt->hh, dt->mm, dt->ss, us,
+                                                 tzinfo,
+                                                 PyDateTimeAPI->DateTimeType);
+  Py_DECREF (tzinfo);
+  if (val == NULL || !self->epoch_datetimes)
+    {
+      return val;
+    }
+
+  /* epoch of a region zone: subtract the offset of the zone at that time */
+  delta = PyObject_CallMethod (val, "utcoffset", NULL);
+  Py_DECREF (val);
+  if (delta == NULL)
+    {
+      return NULL;
+    }
+  if (delta != Py_None)
+    {
+      epoch -= ((CUBRID_LONG_LONG) PyDateTime_DELTA_GET_DAYS (delta) * 86400
+                + PyDateTime_DELTA_GET_SECONDS (delta)) * 1000000
+        + PyDateTime_DELTA_GET_MICROSECONDS (delta);
+    }
+  Py_DECREF (delta);
+
+  return PyLong_FromLongLong (epoch);
+}
+
+/* DB type to Python type mapping
+*
+* bit, varbit                       -> bytes
+* int, short                         -> Integer
+* float, double, numeric         -> Float
+* numeric                           -> Decimal
+* time                                         -> datetime.time
+* date                                         -> datetime.date
+* datetime                                 -> datetime.datetime
+* timestamp                         -> datetime.datetime
+* datetimetz, timestamptz (ltz)     -> aware datetime.datetime
+* datetime, timestamp (tz, ltz)     -> int microseconds since the epoch,
+*                                      with epoch_datetimes set
+* another type                        -> String
+*/
+
+static PyObject *
+_cubrid_CursorObject_dbval_to_pyvalue (_cubrid_CursorObject * self, int type,
+                                       int index)
+{
+  int res, ind;
+  PyObject *val, *tmpval;
+  char *buffer;
+  int num;
+  CUBRID_LONG_LONG bignum;
+  float fnum;
+  double dnum;
+  T_CCI_BIT bit;
+  T_CCI_DATE dt;
+  T_CCI_DATE_TZ dt_tz;
+
+  if (self->state == CURSOR_STATE_CLOSED)
+    {
+      return handle_error (CUBRID_ER_INVALID_CURSOR, NULL);
+    }
+  switch (type)
+    {
+    case CCI_U_TYPE_BIT:
+    case CCI_U_TYPE_VARBIT:
+      res = cci_get_data (self->handle, index, CCI_A_TYPE_BIT, &bit, &ind);
+      if (res < 0)
+        {
+          return handle_error (res, NULL);
+        }
+      if (ind < 0)
+        {
+          Py_INCREF (Py_None);
+          val = Py_None;
+        }
+      else
+        {
+          val = PyBytes_FromStringAndSize (bit.buf, bit.size);
+        }
+      break;
+    case CCI_U_TYPE_INT:
+    case CCI_U_TYPE_SHORT:
+      res = cci_get_data (self->handle, index, CCI_A_TYPE_INT, &num, &ind);
+      if (res < 0)
+        {
+          return handle_error (res, NULL);
+        }
+      if (ind < 0)
+        {
+          Py_INCREF (Py_None);
+          return Py_None;
+        }
+      else
+        {
+          val = PyLong_FromLong (num);
+        }
+      break;
+    case CCI_U_TYPE_BIGINT:
+      res = cci_get_data (self->handle, index, CCI_A_TYPE_BIGINT, &bignum, &ind);
+      if (res < 0)
+        {
+          return handle_error (res, NULL);
+        }
+      if (ind < 0)
+        {
+          Py_INCREF (Py_None);
+          return Py_None;
+        }
+      else
+        {
+          val = PyLong_FromLongLong (bignum);
+        }
+      break;
+    case CCI_U_TYPE_FLOAT:
+      res = cci_get_data (self->handle, index, CCI_A_TYPE_FLOAT, &fnum, &ind);
+      if (res < 0)
+        {
+          return handle_error (res, NULL);
+        }
+      if (ind < 0)
+        {
+          Py_INCREF (Py_None);
+          val = Py_None;
+        }
+      else
+        {
+          val = PyFloat_FromDouble (_cubrid_float_to_double (fnum));
+        }
+      break;
+    case CCI_U_TYPE_DOUBLE:
+      res = cci_get_data (self->handle, index, CCI_A_TYPE_DOUBLE, &dnum, &ind);
+      if (res < 0)
+        {
+          return handle_error (res, NULL);
+        }
+      if (ind < 0)
+        {
+          Py_INCREF (Py_None);
+          val = Py_None;
+        }
+      else
+        {
+          val = PyFloat_FromDouble (dnum);
+        }
+      break;
+    case CCI_U_TYPE_NUMERIC:
+      res = cci_get_data (self->handle, index, CCI_A_TYPE_STR, &buffer, &ind);
+      if (res < 0)
+        {
+          return handle_error (res, NULL);
+        }
+      if (ind < 0)
+        {
+          Py_INCREF (Py_None);
+          val = Py_None;
+        }
+      else
+        {
+          tmpval = PyUnicode_FromString (buffer);
+          if (tmpval == NULL)
+            {
+              return NULL;
+            }
+#if PY_VERSION_HEX >= 0x03090000
+          val = PyObject_CallOneArg (DecimalType, tmpval);
+#else
+          val = PyObject_CallFunctionObjArgs (DecimalType, tmpval, NULL);
+#endif
+          Py_DECREF (tmpval);
+        }
+      break;
+    case CCI_U_TYPE_DATE:
+      res = cci_get_data (self->handle, index, CCI_A_TYPE_DATE, &dt, &ind);
+      if (res < 0)
+        {
+          return handle_error (res, NULL);
+        }
+      if (ind < 0)
+        {
+          Py_INCREF (Py_None);
+          val = Py_None;
+        }
+      else
+        {
+          val = PyDate_FromDate (dt.yr, dt.mon, dt.day);
+        }
+      break;
+    case CCI_U_TYPE_TIME:
+      res = cci_get_data (self->handle, index, CCI_A_TYPE_DATE, &dt, &ind);
+      if (res < 0)
+        {
+          return handle_error (res, NULL);
+        }
+      if (ind < 0)
+        {
+          Py_INCREF (Py_None);
+          val = Py_None;
+        }
+      else
+        {
+          val = PyTime_FromTime (dt.hh, dt.mm, dt.ss, 0);
+        }
+      break;
+    case CCI_U_TYPE_DATETIME:
+      res = cci_get_data (self->handle, index, CCI_A_TYPE_DATE, &dt, &ind);
+      if (res < 0)
+        {
+          return handle_error (res, NULL);
+        }
+      if (ind < 0)
+        {
+          Py_INCREF (Py_None);
+          val = Py_None;
+        }
+      else
+        {
+          val = _cubrid_CursorObject_datetime_to_pyvalue (self, &dt,
+                                                          dt.ms * 1000, NULL);
+        }
+      break;
+    case CCI_U_TYPE_TIMESTAMP:
+      res = cci_get_data (self->handle, index, CCI_A_TYPE_DATE, &dt, &ind);
+      if (res < 0)
+        {
+          return handle_error (res, NULL);
+        }
+      if (ind < 0)
+        {
+          Py_INCREF (Py_None);
+          val = Py_None;
+        }
+      else
+        {
+          val = _cubrid_CursorObject_datetime_to_pyvalue (self, &dt, 0, NULL);
+        }
+      break;
+    case CCI_U_TYPE_DATETIMETZ:
+    case CCI_U_TYPE_DATETIMELTZ:
+    case CCI_U_TYPE_TIMESTAMPTZ:
+    case CCI_U_TYPE_TIMESTAMPLTZ:
+      res = cci_get_data (self->handle, index, CCI_A_TYPE_DATE_TZ, &dt_tz,
+                          &ind);
+      if (res < 0)
+        {
+          return handle_error (res, NULL);
+        }
+      if (ind < 0)
+        {
+          Py_INCREF (Py_None);
+          val = Py_None;
+        }
+      else
+        {
+          dt.yr = dt_tz.yr;
+          dt.mon = dt_tz.mon;
+          dt.day = dt_tz.day;
+          dt.hh = dt_tz.hh;
+          dt.mm = dt_tz.mm;
+          dt.ss = dt_tz.ss;
+          dt.ms = 0;
+          if (type == CCI_U_TYPE_DATETIMETZ || type == CCI_U_TYPE_DATETIMELTZ)
+            {
+              dt.ms = dt_tz.ms;
+            }
+          val = _cubrid_CursorObject_datetime_to_pyvalue (self, &dt,
+                                                          dt.ms * 1000,
+                                                          dt_tz.tz);
+        }
+      break;
+    case 130: // JSON
+    case CCI_U_TYPE_CHAR:
+    case CCI_U_TYPE_STRING:
+      res = cci_get_data (self->handle, index, CCI_A_TYPE_STR, &buffer, &ind);
+      if (res < 0)
+        {
+          return handle_error (res, NULL);
+        }
+      if (ind < 0)
+        {
+          Py_INCREF (Py_None);
+          val = Py_None;
+        }
+      else
+        {
+          /* ind is the length of the string */
+          val = _cubrid_CursorObject_decode (self, buffer, ind);
+        }
+      break;
+    default:
+      // Unknown type, try int
+      res = cci_get_data (self->handle, index, CCI_A_TYPE_INT, &num, &ind);
+      if (res == 0)
+        {
+          if (ind < 0)
+            {
+              Py_INCREF (Py_None);
+              return Py_None;
+            }
+
+          return PyLong_FromLong (num);
+        }
+
+      // Unknown type, try date, time or datetime
+      res = cci_get_data (self->handle, index, CCI_A_TYPE_DATE, &dt, &ind);
+      if (res == 0)
+        {
+          if (ind < 0)
+            {
+              Py_INCREF (Py_None);
+              val = Py_None;
+            }
+
+          if (dt.yr == 0)
+            {
+              return PyTime_FromTime(dt.hh, dt.mm, dt.ss, dt.ms * 1000);
+            }
+          if (dt.hh == 0 && dt.mm == 0 && dt.ss == 0 && dt.ms == 0)
+            {
+              return PyDate_FromDate (dt.yr, dt.mon, dt.day);
+            }
+          else
+            {
+              return PyDateTime_FromDateAndTime (dt.yr, dt.mon, dt.day, dt.hh,
+                                                 dt.mm, dt.ss, dt.ms * 1000);
+            }
+        }
+
+      // Unknown type, try str
+      res = cci_get_data (self->handle, index, CCI_A_TYPE_STR, &buffer, &ind);
+      if (res < 0)
+        {
+          return handle_error (res, NULL);
+        }
+      if (ind < 0)
+        {
+          Py_INCREF (Py_None);
+          val = Py_None;
+        }
+      else
+        {
+          val = _cubrid_CursorObject_decode (self, buffer, strlen (buffer));
+        }
+      break;
+    }
+
+  /* ind is the length of the column data */
+  if (self->conn->stats_enabled && ind > 0)
+    {
+      self->conn->stats.bytes_converted += ind;
+    }
+
+  return val;
+}
+
+/*
+ * Decode element index (1-based) of a collection whose elements have the
+ * CCI type u_type, with the same mapping as the column values. Types
+ * without a native mapping are decoded as strings.
+ */
+static PyObject *
+_cubrid_CursorObject_set_elem_to_pyvalue (_cubrid_CursorObject * self,
+                                          T_CCI_SET set, int index,
+                                          int u_type)
+{
+  int res, ind, a_type;
+  union
+  {
+    int num;
+    CUBRID_LONG_LONG bignum;
+    float fnum;
+    double dnum;
+    char *buffer;
+    T_CCI_BIT bit;
+    T_CCI_DATE dt;
+  } v;
+  PyObject *val, *tmpval;
+
+  switch (u_type)
+    {
+    case CCI_U_TYPE_INT:
+    case CCI_U_TYPE_SHORT:
+      a_type = CCI_A_TYPE_INT;
+      break;
+    case CCI_U_TYPE_BIGINT:
+      a_type = CCI_A_TYPE_BIGINT;
+      break;
+    case CCI_U_TYPE_FLOAT:
+      a_type = CCI_A_TYPE_FLOAT;
+      break;
+    case CCI_U_TYPE_DOUBLE:
+    case CCI_U_TYPE_MONETARY:
+      a_type = CCI_A_TYPE_DOUBLE;
+      break;
+    case CCI_U_TYPE_BIT:
+    case CCI_U_TYPE_VARBIT:
+      a_type = CCI_A_TYPE_BIT;
+      break;
+    case CCI_U_TYPE_DATE:
+    case CCI_U_TYPE_TIME:
+    case CCI_U_TYPE_DATETIME:
+    case CCI_U_TYPE_TIMESTAMP:
+      a_type = CCI_A_TYPE_DATE;
+      break;
+    default:
+      a_type = CCI_A_TYPE_STR;
+      break;
+    }
+
+  res = cci_set_get (set, index, a_type, &v, &ind);
+  if (res < 0)
+    {
+      return handle_error (res, NULL);
+    }
+  if (ind < 0 || (a_type == CCI_A_TYPE_STR && v.buffer == NULL))
+    {
+      Py_INCREF (Py_None);
+      return Py_None;
+    }
+
+  switch (u_type)
+    {
+    case CCI_U_TYPE_INT:
+    case CCI_U_TYPE_SHORT:
+      return PyLong_FromLong (v.num);
+    case CCI_U_TYPE_BIGINT:
+      return PyLong_FromLongLong (v.bignum);
+    case CCI_U_TYPE_FLOAT:
+      return PyFloat_FromDouble (_cubrid_float_to_double (v.fnum));
+    case CCI_U_TYPE_DOUBLE:
+    case CCI_U_TYPE_MONETARY:
+      return PyFloat_FromDouble (v.dnum);
+    case CCI_U_TYPE_BIT:
+    case CCI_U_TYPE_VARBIT:
+      return PyBytes_FromStringAndSize (v.bit.buf, v.bit.size);
+    case CCI_U_TYPE_DATE:
+      return PyDate_FromDate (v.dt.yr, v.dt.mon, v.dt.day);
+    case CCI_U_TYPE_TIME:
+      return PyTime_FromTime (v.dt.hh, v.dt.mm, v.dt.ss, 0);
+    case CCI_U_TYPE_DATETIME:
+      return _cubrid_CursorObject_datetime_to_pyvalue (self, &v.dt,
+                                                       v.dt.ms * 1000, NULL);
+    case CCI_U_TYPE_TIMESTAMP:
+      return _cubrid_CursorObject_datetime_to_pyvalue (self, &v.dt, 0, NULL);
+    case CCI_U_TYPE_NUMERIC:
+      tmpval = PyUnicode_FromString (v.buffer);
+      if (tmpval == NULL)
+        {
+          return NULL;
+        }
+#if PY_VERSION_HEX >= 0x03090000
+      val = PyObject_CallOneArg (DecimalType, tmpval);
+#else
+      val = PyObject_CallFunctionObjArgs (DecimalType, tmpval, NULL);
+#endif
+      Py_DECREF (tmpval);
+      return val;
+    default:
+      return _cubrid_CursorObject_decode (self, v.buffer, strlen (v.buffer));
+    }
+}
+
+/*
+ * Collection(set)                        -> Set,
+ * Collection(multiset, sequence)         -> List,
+ * Collection' item  -> String, or the Python type of the element domain
+ *                      when the connection has native_collections set
+ */
+
+static PyObject *
+_cubrid_CursorObject_dbset_to_pyvalue (_cubrid_CursorObject * self, int type, int index)
+{
+  int i, res, ind, elem_type = 0;
+  PyObject *val;
+  T_CCI_SET set = NULL;
+  int set_size;
+  PyObject *e;
+  char *buffer;
+
+  if (self->state == CURSOR_STATE_CLOSED)
+    {
+      return handle_error (CUBRID_ER_INVALID_CURSOR, NULL);
+    }
+  res = cci_get_data (self->handle, index, CCI_A_TYPE_SET, &set, &ind);
+  if (res < 0)
+    {
+      return handle_error (res, NULL);
+    }
+
+  if (ind < 0)
+    {
+      Py_INCREF (Py_None);
+      return Py_None;
+    }
+
+  set_size = cci_set_size (set);
+  if (self->conn->native_collections)
+    {
+      elem_type = cci_set_element_type (set);
+    }
+
+  // Initialize val as a set or list based on the type argument
+  if (CCI_IS_SET_TYPE (type))
+    {
+      val = PySet_New (NULL);
+    }
+  else
+    {
+      val = PyList_New (set_size);
+    }
+  if (!val)
+    {
+      cci_set_free (set);
+      return NULL;
+    }
+
+  for (i = 0; i < set_size; i++)
+    {
+      if (elem_type)
+        {
+          e = _cubrid_CursorObject_set_elem_to_pyvalue (self, set, i + 1,
+                                                        elem_type);
+          if (!e)
+            {
+              Py_DECREF (val);
+              cci_set_free (set);
+              return NULL;
+            }
+          goto add;
+        }
+
+      res = cci_set_get (set, i + 1, CCI_A_TYPE_STR, &buffer, &ind);
+      if (res < 0)
+        {
+          cci_set_free (set);
+          return handle_error (res, NULL);
+        }
+
+      if (buffer == NULL)
+        {
+          e = PyUnicode_FromString ("");
+        }
+      else
+        {
+          e = _cubrid_CursorObject_decode (self, buffer, ind);
+          if (e == NULL)
+            {
+              Py_DECREF (val);
+              cci_set_free (set);
+              return NULL;
+            }
+        }
+
+    add:
+      if (CCI_IS_SET_TYPE (type))
+        {
+          PySet_Add (val, e);
+          Py_DECREF (e); // Decrement the reference count
+        }
+      else
+        {
+          PyList_SetItem (val, i, e);
+        }
+    }
+
+  cci_set_free (set);
+  return val;
+}
+
+static PyObject *
+_cubrid_CursorObject_col_value (_cubrid_CursorObject * self, int index)
+{
+  int type = CCI_GET_RESULT_INFO_TYPE (self->col_info, index);
+
+  if (CCI_IS_COLLECTION_TYPE (type))
+    {
+      return _cubrid_CursorObject_dbset_to_pyvalue (self, type, index);
+    }
+
+  return _cubrid_CursorObject_dbval_to_pyvalue (self, type, index);
+}
+
+/*
+ * A subclass of _cubrid.Row for the column names in the tuple names,
+ * holding them in _fields and the name -> index map in _index. With
+ * empty __slots__ its rows are as small as tuples.
+ */
+static PyObject *
+_cubrid_new_row_type (PyObject * names)
+{
+  PyObject *index, *pos, *row_type;
+  Py_ssize_t i;
+
+  if (!(index = PyDict_New ()))
+    {
+      return NULL;
+    }
+
+  for (i = 0; i < PyTuple_GET_SIZE (names); i++)
+    {
+      /* On duplicate names, the first column wins */
+      pos = PyLong_FromSsize_t (i);
+      if (!pos || !PyDict_SetDefault (index, PyTuple_GET_ITEM (names, i),
+                                      pos))
+        {
+          Py_XDECREF (pos);
+          Py_DECREF (index);
+          return NULL;
+        }
+      Py_DECREF (pos);
+    }
+
+  row_type =
+    PyObject_CallFunction ((PyObject *) & PyType_Type, "s(O){s()sOsOss}",
+                           "Row", &_cubrid_RowObject_type, "__slots__",
+                           "_fields", names, "_index", index,
+                           "__module__", "_cubrid");
+  Py_DECREF (index);
+
+  return row_type;
+}
+
+/*
+ * The Row type for the column names in the tuple names, made once: the
+ * types are cached by names, so that results with the same columns do
+ * not each make one. The cache is dropped when it grows too large.
+ */
+static PyObject *
+_cubrid_make_row_type (PyObject * names)
+{
+  PyObject *row_type;
+
+  Py_BEGIN_CRITICAL_SECTION (_cubrid_row_types);
+  row_type = PyDict_GetItemWithError (_cubrid_row_types, names);
+  if (row_type)
+    {
+      Py_INCREF (row_type);
+    }
+  else if (!PyErr_Occurred ()
+           && (row_type = _cubrid_new_row_type (names)))
+    {
+      if (PyDict_GET_SIZE (_cubrid_row_types) >= CUBRID_ROW_TYPES_MAX)
+        {
+          PyDict_Clear (_cubrid_row_types);
+        }
+      if (PyDict_SetItem (_cubrid_row_types, names, row_type) < 0)
+        {
+          Py_CLEAR (row_type);
+        }
+    }
+  Py_END_CRITICAL_SECTION ();
+
+  return row_type;
+}
+
+/* The Row type of the current result, made once per set of column names */
+static PyTypeObject *
+_cubrid_CursorObject_row_type (_cubrid_CursorObject * self)
+{
+  if (self->row_type)
+    {
+      return (PyTypeObject *) self->row_type;
+    }
+
+  if (!self->col_names && _cubrid_CursorObject_set_col_names (self) < 0)
+    {
+      return NULL;
+    }
+
+  self->row_type = _cubrid_make_row_type (self->col_names);
+  return (PyTypeObject *) self->row_type;
+}
+
+/*
+ * The columns converted by a fetch with a projection: count 0-based
+ * column indexes, their names and, for Row rows, a Row type for those
+ * names. The other columns are never read from the fetch buffer.
+ */
+typedef struct
+{
+  int *columns;
+  int count;
+  PyObject *names;
+  PyTypeObject *row_type;
+} _cubrid_Projection;
+
+static void
+_cubrid_projection_free (_cubrid_Projection * proj)
+{
+  PyMem_Free (proj->columns);
+  Py_CLEAR (proj->names);
+  Py_CLEAR (proj->row_type);
+}
+
+/*
+ * Set up proj from a sequence of 0-based column indexes. Returns 0 when
+ * columns is None (no projection), 1 when proj is set up, -1 on error.
+ */
+static int
+_cubrid_projection_init (_cubrid_Projection * proj,
+                         _cubrid_CursorObject * self, PyObject * columns,
+                         int how)
+{
+  PyObject *seq, *name;
+  Py_ssize_t i, count;
+  long col;
+
+  memset (proj, 0, sizeof (*proj));
+  if (!columns || columns == Py_None)
+    {
+      return 0;
+    }
+
+  if (!self->col_names && _cubrid_CursorObject_set_col_names (self) < 0)
+    {
+      return -1;
+    }
+  if (!(seq = PySequence_Fast (columns, "columns must be a sequence")))
+    {
+      return -1;
+    }
+
+  count = PySequence_Fast_GET_SIZE (seq);
+  proj->columns = PyMem_New (int, count ? count : 1);
+  if (proj->columns)
+    {
+      CUBRID_COUNT_ALLOC ();
+    }
+  proj->names = PyTuple_New (count);
+  if (!proj->columns || !proj->names)
+    {
+      Py_DECREF (seq);
+      _cubrid_projection_free (proj);
+      PyErr_NoMemory ();
+      return -1;
+    }
+
+  for (i = 0; i < count; i++)
+    {
+      col = PyLong_AsLong (PySequence_Fast_GET_ITEM (seq, i));
+      if (col == -1 && PyErr_Occurred ())
+        {
+          Py_DECREF (seq);
+          _cubrid_projection_free (proj);
+          return -1;
+        }
+      if (col < 0 || col >= PyTuple_GET_SIZE (self->col_names))
+        {
+          Py_DECREF (seq);
+          _cubrid_projection_free (proj);
+          PyErr_SetString (PyExc_IndexError, "column index out of range");
+          return -1;
+        }
+      proj->columns[i] = (int) col;
+      name = PyTuple_GET_ITEM (self->col_names, col);
+      Py_INCREF (name);
+      PyTuple_SET_ITEM (proj->names, i, name);
+    }
+  proj->count = (int) count;
+  Py_DECREF (seq);
+
+  if (how == 2
+      && !(proj->row_type =
+           (PyTypeObject *) _cubrid_make_row_type (proj->names)))
+    {
+      _cubrid_projection_free (proj);
+      return -1;
+    }
+
+  return 1;
+}
+
+static PyObject *
+_cubrid_row_to_tuple (_cubrid_CursorObject * self, PyTypeObject * row_type,
+                      const _cubrid_Projection * proj)
+{
+  int i, count;
+  PyObject *row, *val;
+
+  if (self->state == CURSOR_STATE_CLOSED)
+    {
+      return handle_error (CUBRID_ER_INVALID_CURSOR, NULL);
+    }
+  count = proj ? proj->count : self->col_count;
+  if (row_type)
+    {
+      row = row_type->tp_alloc (row_type, count);
+    }
+  else
+    {
+      row = PyTuple_New (count);
+    }
+  if (!row)
+    {
+      return NULL;
+    }
+
+  for (i = 0; i < count; i++)
+    {
+      val = _cubrid_CursorObject_col_value (self,
+                                            proj ? proj->columns[i] + 1 :
+                                            i + 1);
+      if (!val)
+        {
+          Py_DECREF (row);
+          return NULL;
+        }
+      PyTuple_SET_ITEM (row, i, val);
+    }
+
+  return row;
+}
+
+static PyObject *
+_cubrid_row_to_dict (_cubrid_CursorObject * self,
+                     const _cubrid_Projection * proj)
+{
+  PyObject *row, *val, *names;
+  int i, res, count;
+
+  if (self->state == CURSOR_STATE_CLOSED)
+    {
+      return handle_error (CUBRID_ER_INVALID_CURSOR, NULL);
+    }
+  if (!self->col_names && _cubrid_CursorObject_set_col_names (self) < 0)
+    {
+      return NULL;
+    }
+  if (!(row = PyDict_New ()))
+    {
+      return NULL;
+    }
+
+  names = proj ? proj->names : self->col_names;
+  count = proj ? proj->count : self->col_count;
+  for (i = 0; i < count; i++)
+    {
+      val = _cubrid_CursorObject_col_value (self,
+                                            proj ? proj->columns[i] + 1 :
+                                            i + 1);
+      if (!val)
+        {
+          Py_DECREF (row);
+          return NULL;
+        }
+
+      res = PyDict_SetItem (row, PyTuple_GET_ITEM (names, i), val);
+      Py_DECREF (val);
+      if (res < 0)
+        {
+          Py_DECREF (row);
+          return NULL;
+        }
+    }
+
+  return row;
+}
+
+/*
+ * A lazy row of the current row of the cursor. Nothing is read from the
+ * fetch buffer yet: the columns are converted on first access, see
+ * _cubrid_LazyRowObject_value().
+ */
+static PyObject *
+_cubrid_LazyRowObject_new (_cubrid_CursorObject * self)
+{
+  _cubrid_LazyRowObject *row;
+
+  if (self->state == CURSOR_STATE_CLOSED)
+    {
+      return handle_error (CUBRID_ER_INVALID_CURSOR, NULL);
+    }
+  if (!self->col_names && _cubrid_CursorObject_set_col_names (self) < 0)
+    {
+      return NULL;
+    }
+
+  row = PyObject_NewVar (_cubrid_LazyRowObject, &_cubrid_LazyRowObject_type,
+                         self->col_count);
+  if (!row)
+    {
+      return NULL;
+    }
+
+  memset (row->values, 0, self->col_count * sizeof (PyObject *));
+  Py_INCREF (self);
+  row->cursor = self;
+  Py_INCREF (self->col_names);
+  row->names = self->col_names;
+  row->position = self->row_pos;
+  row->result_gen = self->result_gen;
+
+  if (self->conn->stats_enabled)
+    {
+      self->conn->stats.rows_fetched++;
+    }
+
+  return (PyObject *) row;
+}
+
+/*
+ * Convert the current (fetched) row: how is 0 for a tuple, 1 for a dict,
+ * 2 for a Row. A lazy row (how 3) with a projection is a tuple.
+ */
+static PyObject *
+_cubrid_row_to_pyvalue_how (_cubrid_CursorObject * self, int how,
+                            const _cubrid_Projection * proj)
+{
+  PyTypeObject *row_type;
+
+  if (how == 0 || how == 3)
+    {
+      return _cubrid_row_to_tuple (self, NULL, proj);
+    }
+  if (how == 2)
+    {
+      row_type = proj ? proj->row_type : _cubrid_CursorObject_row_type (self);
+      if (!row_type)
+        {
+          return NULL;
+        }
+      return _cubrid_row_to_tuple (self, row_type, proj);
+    }
+
+  return _cubrid_row_to_dict (self, proj);
+}
+
+static PyObject *
+_cubrid_row_to_pyvalue (_cubrid_CursorObject * self, int how,
+                        const _cubrid_Projection * proj)
+{
+  PyObject *row;
+  CUBRID_LONG_LONG start;
+
+  if (!self->conn->stats_enabled)
+    {
+      return _cubrid_row_to_pyvalue_how (self, how, proj);
+    }
+
+  start = _cubrid_monotonic_ns ();
+  row = _cubrid_row_to_pyvalue_how (self, how, proj);
+  self->conn->stats.convert_ns += _cubrid_monotonic_ns () - start;
+  if (row)
+    {
+      self->conn->stats.rows_fetched++;
+    }
+
+  return row;
+}
+
+static char _cubrid_CursorObject_fetch__doc__[] = "fetch_row([how])\n\
+get a single row from the query result. The cursor automatically moves\n\
+to the next row after getting the result.\n\
+\n\
+how: int, 0 for tuple rows (default), 1 for dict rows,\n\
+  2 for _cubrid.Row rows, 3 for _cubrid.LazyRow rows\n\
+\n\
+Example::\n\
+  import _cubrid\n\
+  con = _cubrid.connect('CUBRID:localhost:33000:demodb:::', 'public')\n\
+  cur = con.cursor()\n\
+  cur.prepare('select * from test_cubrid')\n\
+  cur.execute()\n\
+  row = cur.fetch_row()\n\
+  while row:\n\
+    print row\n\
+    row = cur.fetch_row()\n\
+  cur.close()\n\
+  con.close()";
+
+static PyObject *
+_cubrid_CursorObject_fetch (_cubrid_CursorObject * self, PyObject * args)
+{
+  int res, how = 0;
+  T_CCI_ERROR error;
+  PyObject *row;
+  CUBRID_LONG_LONG start;
+
+  if (self->state == CURSOR_STATE_CLOSED)
+    {
+      return handle_error (CUBRID_ER_INVALID_CURSOR, NULL);
+    }
+  if (!PyArg_ParseTuple (args, "|i", &how))
+    {
+      return NULL;
+    }
+
+  if (how < 0 || how > 3)
+    {
+      return handle_error (CUBRID_ER_INVALID_PARAM, NULL);
+    }
+
+  start = self->conn->stats_enabled ? _cubrid_monotonic_ns () : 0;
+
+  if ((res = _cubrid_CursorObject_restore_pos (self, &error)) < 0)
+    {
+      return handle_error (res, &error);
+    }
+
+  CUBRID_BEGIN_ALLOW_THREADS (self->conn);
+  res = cci_cursor (self->handle, 0, CCI_CURSOR_CURRENT, &error);
+  CUBRID_END_ALLOW_THREADS (self->conn);
+  if (res == CCI_ER_NO_MORE_DATA)
+    {
+      Py_INCREF (Py_None);
+      return Py_None;
+    }
+  else if (res < 0)
+    {
+      return handle_error (res, &error);
+    }
+
+  if (how == 3)
+    {
+      row = _cubrid_LazyRowObject_new (self);
+    }
+  else
+    {
+      CUBRID_BEGIN_ALLOW_THREADS (self->conn);
+      res = cci_fetch (self->handle, &error);
+      CUBRID_END_ALLOW_THREADS (self->conn);
+      if (res < 0)
+        {
+          return handle_error (res, &error);
+        }
+
+      row = _cubrid_row_to_pyvalue (self, how, NULL);
+    }
+
+  CUBRID_BEGIN_ALLOW_THREADS (self->conn);
+  res = cci_cursor (self->handle, 1, CCI_CURSOR_CURRENT, &error);
+  CUBRID_END_ALLOW_THREADS (self->conn);
+  if (res < 0 && res != CCI_ER_NO_MORE_DATA)
+    {
+      Py_XDECREF (row);
+      return handle_error (res, &error);
+    }
+
+  self->cursor_pos += 1;
+  self->row_pos += 1;
+
+  if (start)
+    {
+      self->conn->stats.fetch_calls++;
+      self->conn->stats.fetch_ns += _cubrid_stats_elapsed (start);
+    }
+
+  return row;
+}
+
+static char _cubrid_CursorObject_fetch_many__doc__[] =
+  "fetch_many(n[, how[, columns]])\n\
+get up to n rows from the query result as a list, in a single call.\n\
+If n is negative, all the remaining rows are returned. The cursor\n\
+moves past the rows returned, exactly as n calls to fetch_row() would.\n\
+\n\
+Parameters::\n\
+  n: int, the maximum number of rows to fetch\n\
+  how: int, 0 for tuple rows (default), 1 for dict rows,\n\
+  2 for _cubrid.Row rows, 3 for _cubrid.LazyRow rows\n\
+  columns: sequence of 0-based column indexes, to get only those\n\
+  columns, in that order. The other columns are not read at all.\n\
+  With columns, how 3 gives tuple rows.\n\
+\n\
+Example::\n\
+  import _cubrid\n\
+  con = _cubrid.connect('CUBRID:localhost:33000:demodb:::', 'public')\n\
+  cur = con.cursor()\n\
+  cur.prepare('select * from test_cubrid')\n\
+  cur.execute()\n\
+  rows = cur.fetch_many(100)\n\
+  cur.close()\n\
+  con.close()";
+
+static PyObject *
+_cubrid_CursorObject_fetch_rows (_cubrid_CursorObject * self, Py_ssize_t n,
+                                 int how, const _cubrid_Projection * proj)
+{
+  int res;
+  T_CCI_ERROR error;
+  PyObject *rows, *row;
+
+  if (how < 0 || how > 3)
+    {
+      return handle_error (CUBRID_ER_INVALID_PARAM, NULL);
+    }
+
+  if (!(rows = PyList_New (0)))
+    {
+      return NULL;
+    }
+
+  if (n == 0)
+    {
+      return rows;
+    }
+
+  if ((res = _cubrid_CursorObject_restore_pos (self, &error)) < 0)
+    {
+      Py_DECREF (rows);
+      return handle_error (res, &error);
+    }
+
+  CUBRID_BEGIN_ALLOW_THREADS (self->conn);
+  res = cci_cursor (self->handle, 0, CCI_CURSOR_CURRENT, &error);
+  CUBRID_END_ALLOW_THREADS (self->conn);
+  if (res == CCI_ER_NO_MORE_DATA)
+    {
+      return rows;
+    }
+  else if (res < 0)
+    {
+      Py_DECREF (rows);
+      return handle_error (res, &error);
+    }
+
+  /*
+   * A successful move to the next row means that row exists, so only
+   * the first one needs the position check done by fetch_row().
+   */
+  while (n < 0 || PyList_GET_SIZE (rows) < n)
+    {
+      if (how == 3 && !proj)
+        {
+          row = _cubrid_LazyRowObject_new (self);
+        }
+      else
+        {
+          CUBRID_BEGIN_ALLOW_THREADS (self->conn);
+          res = cci_fetch (self->handle, &error);
+          CUBRID_END_ALLOW_THREADS (self->conn);
+          if (res < 0)
+            {
+              Py_DECREF (rows);
+              return handle_error (res, &error);
+            }
+
+          row = _cubrid_row_to_pyvalue (self, how, proj);
+        }
+      if (!row)
+        {
+          Py_DECREF (rows);
+          return NULL;
+        }
+      res = PyList_Append (rows, row);
+      Py_DECREF (row);
+      if (res < 0)
+        {
+          Py_DECREF (rows);
+          return NULL;
+        }
+
+      self->cursor_pos += 1;
+
+      CUBRID_BEGIN_ALLOW_THREADS (self->conn);
+      res = cci_cursor (self->handle, 1, CCI_CURSOR_CURRENT, &error);
+      CUBRID_END_ALLOW_THREADS (self->conn);
+      self->row_pos += 1;
+      if (res == CCI_ER_NO_MORE_DATA)
+        {
+          break;
+        }
+      if (res < 0)
+        {
+          Py_DECREF (rows);
+          return handle_error (res, &error);
+        }
+    }
+
+  return rows;
+}
+
+static PyObject *
+_cubrid_CursorObject_fetch_many_rows (_cubrid_CursorObject * self,
+                                      Py_ssize_t n, int how,
+                                      PyObject * columns)
+{
+  PyObject *rows;
+  _cubrid_Projection proj;
+  CUBRID_LONG_LONG start = 0;
+  int res;
+
+  if ((res = _cubrid_projection_init (&proj, self, columns, how)) < 0)
+    {
+      return NULL;
+    }
+
+  if (self->conn->stats_enabled)
+    {
+      start = _cubrid_monotonic_ns ();
+    }
+  rows = _cubrid_CursorObject_fetch_rows (self, n, how, res ? &proj : NULL);
+  _cubrid_projection_free (&proj);
+  if (!start)
+    {
+      return rows;
+    }
+
+  self->conn->stats.fetch_calls++;
+  self->conn->stats.fetch_ns += _cubrid_monotonic_ns () - start;
+
+  return rows;
+}
+
+static PyObject *
+_cubrid_CursorObject_fetch_many (_cubrid_CursorObject * self,
+                                 PyObject * args)
+{
+  Py_ssize_t n;
+  int how = 0;
+  PyObject *columns = NULL;
+
+  if (self->state == CURSOR_STATE_CLOSED)
+    {
+      return handle_error (CUBRID_ER_INVALID_CURSOR, NULL);
+    }
+  if (!PyArg_ParseTuple (args, "n|iO", &n, &how, &columns))
+    {
+      return NULL;
+    }
+
+  return _cubrid_CursorObject_fetch_many_rows (self, n, how, columns);
+}
+
+static char _cubrid_CursorObject_fetch_all__doc__[] =
+  "fetch_all([how[, columns]])\n\
+get all the remaining rows from the query result as a list, in\n\
+a single call. Same as fetch_many(-1, how, columns).\n\
+\n\
+how: int, 0 for tuple rows (default), 1 for dict rows,\n\
+  2 for _cubrid.Row rows, 3 for _cubrid.LazyRow rows\n\
+columns: sequence of 0-based column indexes, see fetch_many()";
+
+static PyObject *
+_cubrid_CursorObject_fetch_all (_cubrid_CursorObject * self, PyObject * args)
+{
+  int how = 0;
+  PyObject *columns = NULL;
+
+  if (self->state == CURSOR_STATE_CLOSED)
+    {
+      return handle_error (CUBRID_ER_INVALID_CURSOR, NULL);
+    }
+  if (!PyArg_ParseTuple (args, "|iO", &how, &columns))
+    {
+      return NULL;
+    }
+
+  return _cubrid_CursorObject_fetch_many_rows (self, -1, how, columns);
+}
+
+static char _cubrid_CursorObject_fetch_block__doc__[] =
+  "fetch_block(n[, how[, columns]])\n\
+get up to n rows from the query result as a list, like fetch_many(),\n\
+then release the CCI fetch buffer that held them. The next call gets\n\
+its rows with a new request to the server, so a result can be read\n\
+block by block with no more than one fetch packet kept in the client.\n\
+Use it with a fetch size (see set_fetch_size()) equal to n. A packet\n\
+holds fetch size rows, whatever their size in bytes.\n\
+\n\
+Parameters::\n\
+  n: int, the maximum number of rows to fetch\n\
+  how: int, 0 for tuple rows (default), 1 for dict rows,\n\
+  2 for _cubrid.Row rows. Lazy rows (how 3) are refused: their\n\
+  values are read from the buffer the call releases.\n\
+  columns: sequence of 0-based column indexes, see fetch_many()";
+
+static PyObject *
+_cubrid_CursorObject_fetch_block (_cubrid_CursorObject * self,
+                                  PyObject * args)
+{
+  Py_ssize_t n;
+  int how = 0;
+  PyObject *rows, *columns = NULL;
+
+  if (self->state == CURSOR_STATE_CLOSED)
+    {
+      return handle_error (CUBRID_ER_INVALID_CURSOR, NULL);
+    }
+  if (!PyArg_ParseTuple (args, "n|iO", &n, &how, &columns))
+    {
+      return NULL;
+    }
+  if (how == 3)
+    {
+      return handle_error (CUBRID_ER_INVALID_PARAM, NULL);
+    }
+
+  rows = _cubrid_CursorObject_fetch_many_rows (self, n, how, columns);
+  if (rows)
+    {
+      CUBRID_BEGIN_ALLOW_THREADS (self->conn);
+      cci_fetch_buffer_clear (self->handle);
+      CUBRID_END_ALLOW_THREADS (self->conn);
+    }
+
+  return rows;
+}
+
+/*
+ * Columnar fetch: values are copied from the CCI fetch buffer into
+ * contiguous, native-endian C buffers, one per column, without creating
+ * a Python object per cell.  Formats follow the Arrow C data interface.
+ */
+typedef struct
+{
+  int type;
+  const char *format;
+  Py_ssize_t width;           /* fixed value size, 0 for variable size */
+  char *data;
+  Py_ssize_t data_len;
+  Py_ssize_t data_cap;
+  unsigned char *validity;
+  Py_ssize_t validity_cap;
+  CUBRID_LONG_LONG *offsets;
+  Py_ssize_t offsets_cap;
+  Py_ssize_t null_count;
+} _cubrid_ColumnBuffer;
+
+static int
+_cubrid_buffer_reserve (void **buf, Py_ssize_t * cap, Py_ssize_t need)
+{
+  Py_ssize_t new_cap;
+  void *p;
+
+  if (need <= *cap)
+    {
+      return 0;
+    }
+  new_cap = *cap ? *cap : 1024;
+  while (new_cap < need)
+    {
+      new_cap *= 2;
+    }
+  /* Raw allocator: this runs with the GIL released */
+  p = PyMem_RawRealloc (*buf, new_cap);
+  if (p == NULL)
+    {
+      return -1;
+    }
+  CUBRID_COUNT_ALLOC ();
+  *buf = p;
+  *cap = new_cap;
+  return 0;
+}
+
+
+static int
+_cubrid_column_buffer_init (_cubrid_ColumnBuffer * col, int type,
+                            int utf8)
+{
+  memset (col, 0, sizeof (*col));
+  col->type = type;
+
+  switch (type)
+    {
+    case CCI_U_TYPE_INT:
+    case CCI_U_TYPE_SHORT:
+      col->format = "i";
+      col->width = 4;
+      break;
+    case CCI_U_TYPE_BIGINT:
+      col->format = "l";
+      col->width = 8;
+      break;
+    case CCI_U_TYPE_FLOAT:
+    case CCI_U_TYPE_DOUBLE:
+      col->format = "g";
+      col->width = 8;
+      break;
+    case CCI_U_TYPE_DATE:
+      col->format = "tdD";
+      col->width = 4;
+      break;
+    case CCI_U_TYPE_TIME:
+      col->format = "tts";
+      col->width = 4;
+      break;
+    case CCI_U_TYPE_DATETIME:
+    case CCI_U_TYPE_TIMESTAMP:
+      col->format = "tsu:";
+      col->width = 8;
+      break;
+    case CCI_U_TYPE_BIT:
+    case CCI_U_TYPE_VARBIT:
+      col->format = "Z";
+      break;
+    case CCI_U_TYPE_BLOB:
+    case CCI_U_TYPE_CLOB:
+      return -1;
+    default:
+      if (CCI_IS_COLLECTION_TYPE (type))
+        {
+          return -1;
+        }
+      /* Anything else, numeric included, as its exact text form */
+      col->format = utf8 ? "U" : "Z";
+      break;
+    }
+
+  return 0;
+}
+
+static void
+_cubrid_column_buffer_free (_cubrid_ColumnBuffer * col)
+{
+  PyMem_RawFree (col->data);
+  PyMem_RawFree (col->validity);
+  PyMem_RawFree (col->offsets);
+}
+
+/*
+ * Append the current row's value of column index to col.
+ * Called with the GIL released; returns a CCI error code on failure.
+ */
+static int
+_cubrid_column_buffer_append (_cubrid_ColumnBuffer * col, int handle,
+                              int index, Py_ssize_t row)
+{
+  int res, ind = 0, num;
+  CUBRID_LONG_LONG bignum;
+  float fnum;
+  double dnum;
+  T_CCI_DATE dt;
+  T_CCI_BIT bit;
+  char *buffer = NULL;
+  Py_ssize_t len = 0;
+  void *value = NULL;
+
+  switch (col->type)
+    {
+    case CCI_U_TYPE_INT:
+    case CCI_U_TYPE_SHORT:
+      res = cci_get_data (handle, index, CCI_A_TYPE_INT, &num, &ind);
+      value = &num;
+      break;
+    case CCI_U_TYPE_BIGINT:
+      res = cci_get_data (handle, index, CCI_A_TYPE_BIGINT, &bignum, &ind);
+      value = &bignum;
+      break;
+    case CCI_U_TYPE_FLOAT:
+      /* Same value fetch_row() would give */
+      res = cci_get_data (handle, index, CCI_A_TYPE_FLOAT, &fnum, &ind);
+      dnum = _cubrid_float_to_double (fnum);
+      value = &dnum;
+      break;
+    case CCI_U_TYPE_DOUBLE:
+      res = cci_get_data (handle, index, CCI_A_TYPE_DOUBLE, &dnum, &ind);
+      value = &dnum;
+      break;
+    case CCI_U_TYPE_DATE:
+    case CCI_U_TYPE_TIME:
+    case CCI_U_TYPE_DATETIME:
+    case CCI_U_TYPE_TIMESTAMP:
+      res = cci_get_data (handle, index, CCI_A_TYPE_DATE, &dt, &ind);
+      if (res < 0 || ind < 0)
+        {
+          break;
+        }
+      if (col->type == CCI_U_TYPE_DATE)
+        {
+          num = _cubrid_days_from_civil (dt.yr, dt.mon, dt.day);
+          value = &num;
+        }
+      else if (col->type == CCI_U_TYPE_TIME)
+        {
+          num = dt.hh * 3600 + dt.mm * 60 + dt.ss;
+          value = &num;
+        }
+      else
+        {
+          bignum = _cubrid_days_from_civil (dt.yr, dt.mon, dt.day);
+          bignum = bignum * 86400 + dt.hh * 3600 + dt.mm * 60 + dt.ss;
+          bignum = bignum * 1000000;
+          if (col->type == CCI_U_TYPE_DATETIME)
+            {
+              bignum += dt.ms * 1000;
+            }
+          value = &bignum;
+        }
+      break;
+    case CCI_U_TYPE_BIT:
+    case CCI_U_TYPE_VARBIT:
+      res = cci_get_data (handle, index, CCI_A_TYPE_BIT, &bit, &ind);
+      buffer = bit.buf;
+      len = bit.size;
+      break;
+    default:
+      res = cci_get_data (handle, index, CCI_A_TYPE_STR, &buffer, &ind);
+      if (res == 0 && ind >= 0)
+        {
+          len = strlen (buffer);
+        }
+      break;
+    }
+  if (res < 0)
+    {
+      return res;
+    }
+
+  if (_cubrid_buffer_reserve ((void **) &col->validity, &col->validity_cap,
+                              row / 8 + 1) < 0)
+    {
+      return CUBRID_ER_NO_MORE_MEMORY;
+    }
+  if (row % 8 == 0)
+    {
+      col->validity[row / 8] = 0;
+    }
+
+  if (ind < 0)
+    {
+      col->null_count++;
+      value = NULL;
+      buffer = NULL;
+      len = 0;
+    }
+  else
+    {
+      col->validity[row / 8] |= (unsigned char) (1 << (row % 8));
+    }
+
+  if (col->width > 0)
+    {
+      if (_cubrid_buffer_reserve ((void **) &col->data, &col->data_cap,
+                                  col->data_len + col->width) < 0)
+        {
+          return CUBRID_ER_NO_MORE_MEMORY;
+        }
+      if (value)
+        {
+          memcpy (col->data + col->data_len, value, col->width);
+        }
+      else
+        {
+          memset (col->data + col->data_len, 0, col->width);
+        }
+      col->data_len += col->width;
+      return 0;
+    }
+
+  if (_cubrid_buffer_reserve ((void **) &col->offsets, &col->offsets_cap,
+                              (row + 2) * sizeof (CUBRID_LONG_LONG)) < 0
+      || _cubrid_buffer_reserve ((void **) &col->data, &col->data_cap,
+                                 col->data_len + len) < 0)
+    {
+      return CUBRID_ER_NO_MORE_MEMORY;
+    }
+  if (row == 0)
+    {
+      col->offsets[0] = 0;
+    }
+  if (len > 0)
+    {
+      memcpy (col->data + col->data_len, buffer, len);
+    }
+  col->data_len += len;
+  col->offsets[row + 1] = col->data_len;
+
+  return 0;
+}
+
+/* Build the (format, data, validity, offsets) tuple of a filled column */
+static PyObject *
+_cubrid_column_buffer_export (_cubrid_ColumnBuffer * col, Py_ssize_t rows)
+{
+  PyObject *data, *validity, *offsets;
+
+  data = PyByteArray_FromStringAndSize (col->data ? col->data : "",
+                                        col->data_len);
+  if (col->null_count > 0)
+    {
+      validity = PyByteArray_FromStringAndSize ((char *) col->validity,
+                                                (rows + 7) / 8);
+    }
+  else
+    {
+      Py_INCREF (Py_None);
+      validity = Py_None;
+    }
+  if (col->width == 0)
+    {
+      CUBRID_LONG_LONG zero = 0;
+
+      offsets = PyByteArray_FromStringAndSize (rows ?
+                                               (char *) col->offsets :
+                                               (char *) &zero,
+                                               (rows + 1) *
+                                               sizeof (CUBRID_LONG_LONG));
+    }
+  else
+    {
+      Py_INCREF (Py_None);
+      offsets = Py_None;
+    }
+
+  if (!data || !validity || !offsets)
+    {
+      Py_XDECREF (data);
+      Py_XDECREF (validity);
+      Py_XDECREF (offsets);
+      return NULL;
+    }
+
+  return Py_BuildValue ("(sNNN)", col->format, data, validity, offsets);
+}
+
+static char _cubrid_CursorObject_fetch_columns__doc__[] =
+"fetch_columns([n])\n\
+get up to n rows (all the remaining rows by default or if n is\n\
+negative) from the query result, column by column. The values are\n\
+copied into contiguous native-endian buffers, without creating a\n\
+Python object per value.\n\
+\n\
+Returns a list with a (format, data, validity, offsets) tuple per\n\
+column. format is an Arrow C data interface format string:\n\
+  'i'    int32 (int, short)\n\
+  'l'    int64 (bigint)\n\
+  'g'    float64 (float, double)\n\
+  'tdD'  int32 days since 1970-01-01 (date)\n\
+  'tts'  int32 seconds since midnight (time)\n\
+  'tsu:' int64 microseconds since 1970-01-01 (datetime, timestamp)\n\
+  'Z'    binary (bit, varbit; text when the charset is not utf8)\n\
+  'U'    utf8 text (strings, numeric and the other types)\n\
+data is a bytearray with the values. validity is a bytearray bitmap,\n\
+bit i (LSB first) set when row i is not NULL, or None when the column\n\
+has no NULLs. offsets is a bytearray of n + 1 int64 offsets into data\n\
+for 'U' and 'Z' columns, None otherwise.\n\
+\n\
+Collection and LOB columns are not supported. A statement without\n\
+a result set (insert, update, ...) gives an empty list.\n\
+\n\
+Example::\n\
+  import numpy\n\
+  fmt, data, validity, offsets = cur.fetch_columns()[0]\n\
+  ids = numpy.frombuffer(data, dtype=numpy.int32)";
+
+static PyObject *
+_cubrid_CursorObject_fetch_columns (_cubrid_CursorObject * self,
+                                    PyObject * args)
+{
+  Py_ssize_t n = -1, rows = 0;
+  int i, res, utf8, append_failed = 0;
+  T_CCI_ERROR error;
+  _cubrid_ColumnBuffer *cols;
+  PyObject *result;
+  CUBRID_LONG_LONG start;
+
+  if (self->state == CURSOR_STATE_CLOSED)
+    {
+      return handle_error (CUBRID_ER_INVALID_CURSOR, NULL);
+    }
+  if (!PyArg_ParseTuple (args, "|n", &n))
+    {
+      return NULL;
+    }
+
+  if (self->col_count < 0)
+    {
+      /* No result set, so no columns */
+      return PyList_New (0);
+    }
+
+  start = self->conn->stats_enabled ? _cubrid_monotonic_ns () : 0;
+  utf8 = self->utf8;
+
+  cols = PyMem_Calloc (self->col_count ? self->col_count : 1,
+                       sizeof (_cubrid_ColumnBuffer));
+  if (cols == NULL)
+    {
+      return handle_error (CUBRID_ER_NO_MORE_MEMORY, NULL);
+    }
+  for (i = 0; i < self->col_count; i++)
+    {
+      if (_cubrid_column_buffer_init (&cols[i],
+                                      CCI_GET_RESULT_INFO_TYPE (self->col_info,
+                                                                i + 1),
+                                      utf8) < 0)
+        {
+          PyMem_Free (cols);
+          return handle_error (CUBRID_ER_NOT_SUPPORTED_TYPE, NULL);
+        }
+    }
+
+  /*
+   * The whole loop only touches C buffers, so it runs without the GIL.
+   * As in fetch_many(), only the first row needs the position check.
+   */
+  res = n == 0 ? 0 : _cubrid_CursorObject_restore_pos (self, &error);
+  CUBRID_BEGIN_ALLOW_THREADS (self->conn);
+  if (res >= 0)
+    {
+      res = n == 0 ? CCI_ER_NO_MORE_DATA :
+        cci_cursor (self->handle, 0, CCI_CURSOR_CURRENT, &error);
+    }
+  while (res >= 0 && (n < 0 || rows < n))
+    {
+      res = cci_fetch (self->handle, &error);
+      for (i = 0; res >= 0 && i < self->col_count; i++)
+        {
+          res = _cubrid_column_buffer_append (&cols[i], self->handle, i + 1,
+                                              rows);
+          append_failed = res < 0;
+        }
+      if (res < 0)
+        {
+          break;
+        }
+      rows++;
+      res = cci_cursor (self->handle, 1, CCI_CURSOR_CURRENT, &error);
+    }
+  CUBRID_END_ALLOW_THREADS (self->conn);
+
+  self->cursor_pos += (int) rows;
+  self->row_pos += (int) rows;
+
+  if (res < 0 && res != CCI_ER_NO_MORE_DATA)
+    {
+      for (i = 0; i < self->col_count; i++)
+        {
+          _cubrid_column_buffer_free (&cols[i]);
+        }
+      PyMem_Free (cols);
+      return handle_error (res, append_failed ? NULL : &error);
+    }
+
+  result = PyList_New (self->col_count);
+  for (i = 0; i < self->col_count; i++)
+    {
+      if (result)
+        {
+          PyObject *col = _cubrid_column_buffer_export (&cols[i], rows);
+          if (col == NULL)
+            {
+              Py_CLEAR (result);
+            }
+          else
+            {
+              PyList_SET_ITEM (result, i, col);
+            }
+        }
+      _cubrid_column_buffer_free (&cols[i]);
+    }
+  PyMem_Free (cols);
+
+  if (start)
+    {
+      self->conn->stats.fetch_calls++;
+      self->conn->stats.fetch_ns += _cubrid_stats_elapsed (start);
+      self->conn->stats.rows_fetched += rows;
+    }
+
+  return result;
+}
+
+static char _cubrid_CursorObject_fetch_lob__doc__[] = "fetch_lob(col, lob)\n\
+get BLOB/CLOB data out from the database server. You need to specify\n\
+which column is lob type.\n\
+\n\
+Parameters::\n\
+  col: int, the column of LOB\n\
+  lob: LOB object, to process LOB data.\n\
+\n\
+Example::\n\
+  import _cubrid\n\
+  con = _cubrid.connect('CUBRID:localhost:33000:demodb:::', 'public')\n\
+  cur = con.cursor()\n\
+  cur.prepare('select * from test_lob')\n\
+  cur.execute()\n\
+  lob = con.lob()\n\
+  cur.fetch_lob(1, lob)\n\
+  lob.close()\n\
+  cur.close()\n\
+  con.close()";
+
+static PyObject *
+_cubrid_CursorObject_fetch_lob (_cubrid_CursorObject * self, PyObject * args)
+{
+  _cubrid_LobObject *lob;
+  int col = 1, res, ind;
+  T_CCI_ERROR error;
+
+  if (self->state == CURSOR_STATE_CLOSED)
+    {
+      return handle_error (CUBRID_ER_INVALID_CURSOR, NULL);
+    }
+  if (!PyArg_ParseTuple (args, "iO!", &col, &_cubrid_LobObject_type, &lob))
+    {
+      return NULL;
+    }
+
+  if ((res = _cubrid_CursorObject_restore_pos (self, &error)) < 0)
+    {
+      return handle_error (res, &error);
+    }
+
+  CUBRID_BEGIN_ALLOW_THREADS (self->conn);
+  res = cci_cursor (self->handle, 0, CCI_CURSOR_CURRENT, &error);
+  CUBRID_END_ALLOW_THREADS (self->conn);
+  if (res == CCI_ER_NO_MORE_DATA)
+    {
+      Py_INCREF (Py_None);
+      return Py_None;
+    }
+  else if (res < 0)
+    {
+      return handle_error (res, &error);
+    }
+
+  CUBRID_BEGIN_ALLOW_THREADS (self->conn);
+  res = cci_fetch (self->handle, &error);
+  CUBRID_END_ALLOW_THREADS (self->conn);
+  if (res < 0)
+    {
+      return handle_error (res, &error);
+    }
+
+  if (CCI_GET_RESULT_INFO_TYPE (self->col_info, 1) == CCI_U_TYPE_BLOB)
+    {
+      lob->type = CUBRID_BLOB;
+      res =
+        cci_get_data (self->handle, col, CCI_A_TYPE_BLOB,
+                      (void *) &lob->blob, &ind);
+      if (res < 0)
+        {
+          return handle_error (res, NULL);
+        }
+    }
+  else
+    {
+      lob->type = CUBRID_CLOB;
+      res =
+        cci_get_data (self->handle, col, CCI_A_TYPE_CLOB,
+                      (void *) &lob->clob, &ind);
+      if (res < 0)
+        {
+          return handle_error (res, NULL);
+        }
+    }
+
+  CUBRID_BEGIN_ALLOW_THREADS (self->conn);
+  res = cci_cursor (self->handle, 1, CCI_CURSOR_CURRENT, &error);
+  CUBRID_END_ALLOW_THREADS (self->conn);
+  if (res < 0 && res != CCI_ER_NO_MORE_DATA)
+    {
+      return handle_error (res, &error);
+    }
+
+  self->cursor_pos += 1;
+  self->row_pos += 1;
+
+  Py_INCREF (Py_None);
+  return Py_None;
+}
+
+static char _cubrid_CursorObject_affected_rows__doc__[] = "affected_rows()\n\
+get the number of rows affected by the SQL sentence (INSERT,\n\
+DELETE, UPDATE).\n\
+\n\
+Return values::\n\
+  Success: Number of rows affected by the SQL sentence\n\
+  Failure: -1";
+
+static PyObject *
+_cubrid_CursorObject_affected_rows (_cubrid_CursorObject * self,
+                                    PyObject * args)
+{
+  int affected_rows;
+
+  if (self->state == CURSOR_STATE_CLOSED)
+    {
+      return handle_error (CUBRID_ER_INVALID_CURSOR, NULL);
+    }
+  if (!PyArg_ParseTuple (args, ""))
+    {
+      return NULL;
+    }
+
+  switch (self->sql_type)
+    {
+    case SQLX_CMD_INSERT:
+    case SQLX_CMD_UPDATE:
+    case SQLX_CMD_DELETE:
+      affected_rows = self->row_count;
+      break;
+    default:
+      affected_rows = -1;
+      break;
+    }
+
+  return PyLong_FromLong (affected_rows);
+}
+
+static char _cubrid_CursorObject_data_seek__doc__[] = "data_seek(n)\n\
+move the cursor based on the original position.\n\
+\n\
+offset: int, number of units you want to move the cursor.";
+
+static PyObject *
+_cubrid_CursorObject_data_seek (_cubrid_CursorObject * self, PyObject * args)
+{
+  int res;
+  T_CCI_ERROR error;
+  int row;
+
+  if (self->state == CURSOR_STATE_CLOSED)
+    {
+      return handle_error (CUBRID_ER_INVALID_CURSOR, NULL);
+    }
+  if (!PyArg_ParseTuple (args, "i", &row))
+    {
+      return NULL;
+    }
+
+  if (row < 1 || row > self->row_count)
+    {
+      return handle_error (CUBRID_ER_INVALID_PARAM, &error);
+    }
+
+  CUBRID_BEGIN_ALLOW_THREADS (self->conn);
+  res = cci_cursor (self->handle, row, CCI_CURSOR_FIRST, &error);
+  CUBRID_END_ALLOW_THREADS (self->conn);
+  if (res < 0 || res == CCI_ER_NO_MORE_DATA)
+    {
+      return handle_error (res, &error);
+    }
+
+  self->cursor_pos = row;
+  self->row_pos = row;
+  self->lazy_pos = 0;
+
+  Py_INCREF (Py_None);
+  return Py_None;
+}
+
+static char _cubrid_CursorObject_num_fields__doc__[] = "num_fields()\n\
+get the number of columns from the query result. It can\n\
+only be used when the query executed is a select sentence.\n";
+
+static PyObject *
+_cubrid_CursorObject_num_fields (_cubrid_CursorObject * self, PyObject * args)
+{
+  if (self->state == CURSOR_STATE_CLOSED)
+    {
+      return handle_error (CUBRID_ER_INVALID_CURSOR, NULL);
+    }
+  if (!PyArg_ParseTuple (args, ""))
+    {
+      return NULL;
+    }
+
+  if (self->sql_type == SQLX_CMD_SELECT)
+    {
+      return PyLong_FromLong (self->col_count);
+    }
+
+  Py_INCREF (Py_None);
+  return Py_None;
+}
+
+static char _cubrid_CursorObject_num_rows__doc__[] = "num_rows()\n\
+get the number of rows from the query result. It can\n\
+only be used when the query executed is a select sentence.\n";
+
+static PyObject *
+_cubrid_CursorObject_num_rows (_cubrid_CursorObject * self, PyObject * args)
+{
+  if (self->state == CURSOR_STATE_CLOSED)
+    {
+      return handle_error (CUBRID_ER_INVALID_CURSOR, NULL);
+    }
+  if (!PyArg_ParseTuple (args, ""))
+    {
+      return NULL;
+    }
+
+  if (self->sql_type == SQLX_CMD_SELECT)
+    {
+      return PyLong_FromLong (self->row_count);
+    }
+
+  Py_INCREF (Py_None);
+  return Py_None;
+}
+
+static char _cubrid_CursorObject_row_tell__doc__[] =
+  "get the current position of the cursor.";
+
+static PyObject *
+_cubrid_CursorObject_row_tell (_cubrid_CursorObject * self, PyObject * args)
+{
+  if (self->state == CURSOR_STATE_CLOSED)
+    {
+      return handle_error (CUBRID_ER_INVALID_CURSOR, NULL);
+    }
+  if (!PyArg_ParseTuple (args, ""))
+    {
+      return NULL;
+    }
+
+  if (self->cursor_pos > self->row_count)
+    {
+      return handle_error (CUBRID_ER_INVALID_CURSOR_POS, NULL);
+    }
+
+  return PyLong_FromLong (self->cursor_pos);
+}
+
+static char _cubrid_CursorObject_row_seek__doc__[] = "row_seek(offset)\n\
+move the current cursor based on current cursor\n\
+position. If give a positive number, it will move forward.\n\
+If you give a negative number, it will move back.\n\
+\n\
+offset: int, relative location that you want to move.\n";
+
+static PyObject *
+_cubrid_CursorObject_row_seek (_cubrid_CursorObject * self, PyObject * args)
+{
+  int offset, res;
+  T_CCI_ERROR error;
+
+  if (self->state == CURSOR_STATE_CLOSED)
+    {
+      return handle_error (CUBRID_ER_INVALID_CURSOR, NULL);
+    }
+  if (!PyArg_ParseTuple (args, "i", &offset))
+    {
+      return NULL;
+    }
+
+  if ((res = _cubrid_CursorObject_restore_pos (self, &error)) < 0)
+    {
+      return handle_error (res, &error);
+    }
+
+  CUBRID_BEGIN_ALLOW_THREADS (self->conn);
+  res = cci_cursor (self->handle, offset, CCI_CURSOR_CURRENT, &error);
+  CUBRID_END_ALLOW_THREADS (self->conn);
+  if (res < 0)
+    {
+      return handle_error (res, &error);
+    }
+
+  self->cursor_pos += offset;
+  self->row_pos += offset;
+
+  Py_INCREF (Py_None);
+  return Py_None;
+}
+
+static char _cubrid_CursorObject_next_result__doc__[] = "next_result()\n\
+get results of next query if CUBRID_EXEC_QUERY_ALL\n\
+flag is set upon execute(). If next result is executed successfully,\n\
+the database is updated with the information of the current query.";
+
+static PyObject *
+_cubrid_CursorObject_next_result (_cubrid_CursorObject * self,
+                                  PyObject * args)
+{
+  int res, col_count;
+  T_CCI_ERROR error;
+  T_CCI_COL_INFO *res_col_info;
+  T_CCI_SQLX_CMD res_sql_type;
+
+  if (self->state == CURSOR_STATE_CLOSED)
+    {
+      return handle_error (CUBRID_ER_INVALID_CURSOR, NULL);
+    }
+  if (!PyArg_ParseTuple (args, ""))
+    {
+      return NULL;
+    }
+
+  //_cubrid_CursorObject_reset (self);
+  Py_CLEAR (self->description);
+  self->desc_handle = 0;
+
+  self->bind_num = -1;
+  self->col_count = -1;
+  self->sql_type = 0;
+  self->row_count = -1;
+  self->cursor_pos = 0;
+  _cubrid_CursorObject_new_result (self);
+
+  CUBRID_BEGIN_ALLOW_THREADS (self->conn);
+  res = cci_next_result (self->handle, &error);
+  CUBRID_END_ALLOW_THREADS (self->conn);
+  if (res == CAS_ER_NO_MORE_RESULT_SET)
+    {
+      goto RETURN_NEXT_RESULT;
+    }
+  if (res < 0)
+    {
+      return handle_error (res, &error);
+    }
+
+  res_col_info =
+    cci_get_result_info (self->handle, &res_sql_type, &col_count);
+  if (res_sql_type == SQLX_CMD_SELECT && !res_col_info)
+    {
+      return handle_error (CUBRID_ER_CANNOT_GET_COLUMN_INFO, NULL);
+    }
+
+  self->col_info = res_col_info;
+  self->sql_type = res_sql_type;
+  self->col_count = col_count;
+
+  switch (res_sql_type)
+    {
+    case SQLX_CMD_SELECT:
+    case SQLX_CMD_INSERT:
+    case SQLX_CMD_UPDATE:
+    case SQLX_CMD_DELETE:
+    case SQLX_CMD_CALL:
+      self->row_count = res;
+      break;
+    default:
+      self->row_count = -1;
+      break;
+    }
+
+  if (res_sql_type == SQLX_CMD_SELECT)
+    {
+      if (_cubrid_CursorObject_update_columns (self) < 0)
+        {
+          return NULL;
+        }
+      CUBRID_BEGIN_ALLOW_THREADS (self->conn);
+      res = cci_cursor (self->handle, 1, CCI_CURSOR_CURRENT, &error);
+      CUBRID_END_ALLOW_THREADS (self->conn);
+      if (res < 0 && res != CCI_ER_NO_MORE_DATA)
+        {
+          return handle_error (res, &error);
+        }
+    }
+
+RETURN_NEXT_RESULT:
+  Py_INCREF (Py_None);
+  return Py_None;
+}
+
+static char _cubrid_CursorObject_close__doc__[] =
+  "close() -- Close the current cursor object.";
+
+static PyObject *
+_cubrid_CursorObject_close (_cubrid_CursorObject * self, PyObject * args)
+{
+  if (self->state == CURSOR_STATE_CLOSED)
+    {
+      return handle_error (CUBRID_ER_INVALID_CURSOR, NULL);
+    }
+  if (!PyArg_ParseTuple (args, ""))
+    {
+      return NULL;
+    }
+
+  _cubrid_CursorObject_reset (self);
+  Py_CLEAR (self->description);
+  self->desc_handle = 0;
+  self->state = CURSOR_STATE_CLOSED;
+  Py_INCREF (Py_None);
+  return Py_None;
+}
+
+static void
+_cubrid_CursorObject_dealloc (_cubrid_CursorObject * self)
+{
+  _cubrid_CursorObject_reset (self);
+  Py_CLEAR (self->description);
+  Py_CLEAR (self->col_names);
+  Py_CLEAR (self->desc_sql);
+  Py_CLEAR (self->row_type);
+  Py_CLEAR (self->decoder);
+  _cubrid_arena_free (&self->arena);
+  Py_XDECREF (self->conn);
+  Py_TYPE (self)->tp_free ((PyObject *) self);
+}
+
+static PyObject *
+_cubrid_LobObject_new (PyTypeObject * type, PyObject * args,
+                       PyObject * kwargs)
+{
+  _cubrid_LobObject *self;
+
+  self = (_cubrid_LobObject *) type->tp_alloc (type, 0);
+  if (!self)
+    {
+      return NULL;
+    }
+
+  return (PyObject *) self;
+}
+
+static int
+_cubrid_LobObject_init (_cubrid_LobObject * self, PyObject * args,
+                        PyObject * kwargs)
+{
+  _cubrid_ConnectionObject *conn;
+
+  if (!PyArg_ParseTuple (args, "O!", &_cubrid_ConnectionObject_type, &conn))
+    {
+      return -1;
+    }
+
+  Py_INCREF (conn);
+
+  self->connection = conn->handle;
+  self->conn = conn;
+  self->blob = NULL;
+  self->clob = NULL;
+  self->pos = 0;
+  self->type = CUBRID_BLOB;
+  self->chunk_size = CUBRID_LOB_CHUNK_SIZE;
+
+  return 0;
+}
+
+static char _cubrid_LobObject_close__doc__[] = "close() -- Close the lob";
+
+static PyObject *
+_cubrid_LobObject_close (_cubrid_LobObject * self, PyObject * args)
+{
+  if (self->blob)
+    {
+      cci_blob_free (self->blob);
+      self->blob = NULL;
+    }
+  if (self->clob)
+    {
+      cci_blob_free (self->clob);
+      self->clob = NULL;
+    }
+  Py_INCREF (Py_None);
+  return Py_None;
+}
+
+static PyObject *
+_cubrid_LobObject_create (_cubrid_LobObject * self, char type)
+{
+  int res;
+  T_CCI_ERROR error;
+
+  if (type == 'B' || type == 'b')
+    {
+      CUBRID_BEGIN_ALLOW_THREADS (self->conn);
+      res = cci_blob_new (self->connection, &self->blob, &error);
+      CUBRID_END_ALLOW_THREADS (self->conn);
+      if (res < 0)
+        {
+          return handle_error (res, &error);
+        }
+      self->type = CUBRID_BLOB;
+    }
+  else if (type == 'C' || type == 'c')
+    {
+      CUBRID_BEGIN_ALLOW_THREADS (self->conn);
+      res = cci_clob_new (self->connection, &self->clob, &error);
+      CUBRID_END_ALLOW_THREADS (self->conn);
+      if (res < 0)
+        {
+          return handle_error (res, &error);
+        }
+      self->type = CUBRID_CLOB;
+    }
+  else
+    {
+      return handle_error (CUBRID_ER_UNKNOWN_TYPE, NULL);
+    }
+
+  Py_INCREF (Py_None);
+  return Py_None;
+}
+
+static int
+_cubrid_LobObject_cci_write (_cubrid_LobObject * self, CUBRID_LONG_LONG pos,
+                             int size, char *buf, T_CCI_ERROR * error)
+{
+  return (self->type == CUBRID_BLOB) ?
+    cci_blob_write (self->connection, self->blob, pos, size, buf, error) :
+    cci_clob_write (self->connection, self->clob, pos, size, buf, error);
+}
+
+static CUBRID_LONG_LONG
+_cubrid_LobObject_cci_lob_size (_cubrid_LobObject * self)
+{
+  return (self->type == CUBRID_BLOB) ?
+    cci_blob_size (self->blob) : cci_clob_size (self->clob);
+}
+
+static int
+_cubrid_LobObject_cci_read (_cubrid_LobObject * self, CUBRID_LONG_LONG pos,
+                            int size, char *buf, T_CCI_ERROR * error)
+{
+  return (self->type == CUBRID_BLOB) ?
+    cci_blob_read (self->connection, self->blob, pos, size, buf, error) :
+    cci_clob_read (self->connection, self->clob, pos, size, buf, error);
+}
+
+/* Create the large object of the given type ('B' when type is NULL). */
+static PyObject *
+_cubrid_LobObject_create_type (_cubrid_LobObject * self, const char *type)
+{
+  if (type == NULL)
+    {
+      return _cubrid_LobObject_create (self, CUBRID_BLOB);
+    }
+
+  if (strlen (type) > 1)
+    {
+      return handle_error (CUBRID_ER_INVALID_PARAM, NULL);
+    }
+
+  return _cubrid_LobObject_create (self, *type);
+}
+
+/* Write len bytes at *pos, chunk_size bytes per request, without the GIL.
+   *pos is advanced past the data written. */
+static int
+_cubrid_LobObject_write_chunks (_cubrid_LobObject * self,
+                                CUBRID_LONG_LONG * pos, const char *buf,
+                                Py_ssize_t len, T_CCI_ERROR * error)
+{
+  int res = 0, size;
+
+  CUBRID_BEGIN_ALLOW_THREADS (self->conn);
+  while (len > 0)
+    {
+      size = (len > self->chunk_size) ? self->chunk_size : (int) len;
+      res = _cubrid_LobObject_cci_write (self, *pos, size, (char *) buf,
+                                         error);
+      if (res < 0)
+        {
+          break;
+        }
+
+      *pos += size;
+      buf += size;
+      len -= size;
+    }
+  CUBRID_END_ALLOW_THREADS (self->conn);
+
+  return (res < 0) ? res : 0;
+}
+
+/* Read up to len bytes at pos, chunk_size bytes per request, without the
+   GIL. Returns the number of bytes read, less than len at the end of the
+   large object, or a CCI error code. */
+static CUBRID_LONG_LONG
+_cubrid_LobObject_read_chunks (_cubrid_LobObject * self,
+                               CUBRID_LONG_LONG pos, char *buf,
+                               CUBRID_LONG_LONG len, T_CCI_ERROR * error)
+{
+  CUBRID_LONG_LONG total = 0, remaining;
+  int res = 0, size;
+
+  CUBRID_BEGIN_ALLOW_THREADS (self->conn);
+  remaining = _cubrid_LobObject_cci_lob_size (self) - pos;
+  if (len > remaining)
+    {
+      len = (remaining > 0) ? remaining : 0;
+    }
+
+  while (total < len)
+    {
+      size = (len - total > self->chunk_size) ?
+        self->chunk_size : (int) (len - total);
+      res = _cubrid_LobObject_cci_read (self, pos + total, size, buf + total,
+                                        error);
+      if (res <= 0)
+        {
+          break;
+        }
+
+      total += res;
+    }
+  CUBRID_END_ALLOW_THREADS (self->conn);
+
+  return (res < 0) ? res : total;
+}
+
+static PyObject *
+_cubrid_LobObject_import_file (_cubrid_LobObject * self,
+                               const char *filename)
+{
+  char *buf;
+  int fd, size = 0, res = 0, chunk_size = self->chunk_size;
+  CUBRID_LONG_LONG pos = 0;
+  T_CCI_ERROR error;
+
+  fd = open (filename, O_RDONLY, 0400);
+  if (fd < 0)
+    {
+      return handle_error (CUBRID_ER_OPEN_FILE, NULL);
+    }
+
+  buf = PyMem_RawMalloc (chunk_size);
+  if (!buf)
+    {
+      close (fd);
+      return handle_error (CUBRID_ER_NO_MORE_MEMORY, NULL);
+    }
+  CUBRID_COUNT_ALLOC ();
+
+  CUBRID_BEGIN_ALLOW_THREADS (self->conn);
+  while ((size = read (fd, buf, chunk_size)) > 0)
+    {
+      res = _cubrid_LobObject_cci_write (self, pos, size, buf, &error);
+      if (res < 0)
+        {
+          break;
+        }
+
+      pos += size;
+    }
+  CUBRID_END_ALLOW_THREADS (self->conn);
+
+  PyMem_RawFree (buf);
+  close (fd);
+
+  if (size < 0)
+    {
+      _cubrid_LobObject_close (self, NULL);
+      return handle_error (CUBRID_ER_READ_FILE, NULL);
+    }
+  if (res < 0)
+    {
+      _cubrid_LobObject_close (self, NULL);
+      return handle_error (res, &error);
+    }
+
+  return PyLong_FromLongLong (pos);
 }
 
-/*
- * Collection(set)                        -> Set,
- * Collection(multiset, sequence)         -> List,
- * Collection' item  -> String
- */
-
 static PyObject *
-_cubrid_CursorObject_dbset_to_pyvalue (_cubrid_CursorObject * self, int type, int index)
+_cubrid_LobObject_import_buffer (_cubrid_LobObject * self, PyObject * src)
 {
-  int i, res, ind;
-  PyObject *val;
-  T_CCI_SET set = NULL;
-  int set_size;
-  PyObject *e;
-  char *buffer;
+  Py_buffer data;
+  CUBRID_LONG_LONG pos = 0;
+  int res;
+  T_CCI_ERROR error;
 
-  if (self->state == CURSOR_STATE_CLOSED)
+  if (PyObject_GetBuffer (src, &data, PyBUF_SIMPLE) < 0)
     {
-      return handle_error (CUBRID_ER_INVALID_CURSOR, NULL);
+      _cubrid_LobObject_close (self, NULL);
+      return NULL;
     }
-  res = cci_get_data (self->handle, index, CCI_A_TYPE_SET, &set, &ind);
+
+  res = _cubrid_LobObject_write_chunks (self, &pos, data.buf, data.len,
+                                        &error);
+  PyBuffer_Release (&data);
   if (res < 0)
     {
-      return handle_error (res, NULL);
+      _cubrid_LobObject_close (self, NULL);
+      return handle_error (res, &error);
     }
 
-  if (ind < 0)
-    {
-      Py_INCREF (Py_None);
-      return Py_None;
-    }
+  return PyLong_FromLongLong (pos);
+}
 
-  set_size = cci_set_size (set);
+/* Copy a file object into the large object. Objects with readinto() fill
+   one reused chunk; otherwise read() is called, and str results (text
+   files) are encoded to UTF-8. */
+static PyObject *
+_cubrid_LobObject_import_stream (_cubrid_LobObject * self, PyObject * src)
+{
+  PyObject *chunk = NULL, *ret, *tmp;
+  Py_buffer data;
+  Py_ssize_t size;
+  CUBRID_LONG_LONG pos = 0;
+  int res;
+  T_CCI_ERROR error;
 
-  // Initialize val as a set or list based on the type argument
-  if (CCI_IS_SET_TYPE (type))
+  if (PyObject_HasAttrString (src, "readinto"))
     {
-      val = PySet_New (NULL);
+      chunk = PyByteArray_FromStringAndSize (NULL, self->chunk_size);
+      if (!chunk)
+        {
+          goto error;
+        }
     }
-  else
+  else if (!PyObject_HasAttrString (src, "read"))
     {
-      val = PyList_New (set_size);
+      PyErr_SetString (PyExc_TypeError,
+                       "expected a file name, a file object or a "
+                       "bytes-like object");
+      goto error;
     }
 
-  for (i = 0; i < set_size; i++)
+  while (1)
     {
-      res = cci_set_get (set, i + 1, CCI_A_TYPE_STR, &buffer, &ind);
-      if (res < 0)
+      size = -1;
+      if (chunk)
         {
-          cci_set_free (set);
-          return handle_error (res, NULL);
-        }
+          ret = PyObject_CallMethod (src, "readinto", "O", chunk);
+          if (!ret)
+            {
+              goto error;
+            }
 
-      if (buffer == NULL)
-        {
-          e = PyUnicode_FromString ("");
+          size = PyLong_AsSsize_t (ret);
+          Py_DECREF (ret);
+          if (size < 0)
+            {
+              goto error;
+            }
+
+          ret = chunk;
+          Py_INCREF (ret);
         }
       else
         {
-          e = PyUnicode_Decode (buffer, strlen (buffer), self->charset, NULL);
-          if (e == NULL)
+          ret = PyObject_CallMethod (src, "read", "i", self->chunk_size);
+          if (!ret)
             {
-              PyErr_SetString (PyExc_ValueError, "String decoding failed");
-              cci_set_free (set);
-              return handle_error (res, NULL);
+              goto error;
+            }
+
+          if (PyUnicode_Check (ret))
+            {
+              tmp = PyUnicode_AsUTF8String (ret);
+              Py_DECREF (ret);
+              if (!tmp)
+                {
+                  goto error;
+                }
+              ret = tmp;
             }
         }
 
-      if (CCI_IS_SET_TYPE (type))
+      if (PyObject_GetBuffer (ret, &data, PyBUF_SIMPLE) < 0)
         {
-          PySet_Add (val, e);
-          Py_DECREF (e); // Decrement the reference count
+          Py_DECREF (ret);
+          goto error;
         }
-      else
+
+      if (size < 0 || size > data.len)
         {
-          PyList_SetItem (val, i, e);
+          size = data.len;
+        }
+
+      res = 0;
+      if (size > 0)
+        {
+          res = _cubrid_LobObject_write_chunks (self, &pos, data.buf, size,
+                                                &error);
+        }
+      PyBuffer_Release (&data);
+      Py_DECREF (ret);
+
+      if (res < 0)
+        {
+          Py_XDECREF (chunk);
+          _cubrid_LobObject_close (self, NULL);
+          return handle_error (res, &error);
+        }
+
+      if (size == 0)
+        {
+          break;
         }
     }
 
-  cci_set_free (set);
-  return val;
+  Py_XDECREF (chunk);
+  return PyLong_FromLongLong (pos);
+
+error:
+  Py_XDECREF (chunk);
+  _cubrid_LobObject_close (self, NULL);
+  return NULL;
+}
+
+/* Filenames are str or os.PathLike objects */
+static int
+_cubrid_LobObject_is_path (PyObject * obj)
+{
+  return PyUnicode_Check (obj) || PyObject_HasAttrString (obj, "__fspath__");
 }
 
+static char _cubrid_LobObject_import__doc__[] = "imports(file[, type])\n\
+imports file in CUBRID server.\n\
+If not give the type, it will be processed as BLOB.\n\
+\n\
+file can be a file name, a file object opened for reading, or a bytes-like\n\
+object such as bytes or memoryview. The data is sent chunk_size bytes per\n\
+request, with the GIL released.\n\
+\n\
+Return the number of bytes imported.";
+
 static PyObject *
-_cubrid_row_to_tuple (_cubrid_CursorObject * self)
+_cubrid_LobObject_import (_cubrid_LobObject * self, PyObject * args)
 {
-  int i, type;
-  PyObject *row, *val;
+  PyObject *src, *path = NULL, *ret;
+  char *type = NULL;
 
-  if (self->state == CURSOR_STATE_CLOSED)
+  if (!PyArg_ParseTuple (args, "O|s", &src, &type))
     {
-      return handle_error (CUBRID_ER_INVALID_CURSOR, NULL);
+      return NULL;
     }
-  row = PyTuple_New (self->col_count);
 
-  for (i = 0; i < self->col_count; i++)
+  _cubrid_LobObject_close (self, NULL);
+  ret = _cubrid_LobObject_create_type (self, type);
+  if (!ret)
     {
-      type = CCI_GET_RESULT_INFO_TYPE (self->col_info, i + 1);
+      return NULL;
+    }
+  Py_DECREF (ret);
 
-      if (CCI_IS_COLLECTION_TYPE (type))
-        {
-          val = _cubrid_CursorObject_dbset_to_pyvalue (self, type, i + 1);
-        }
-      else
+  if (_cubrid_LobObject_is_path (src))
+    {
+      if (!PyUnicode_FSConverter (src, &path))
         {
-          val = _cubrid_CursorObject_dbval_to_pyvalue (self, type, i + 1);
+          _cubrid_LobObject_close (self, NULL);
+          return NULL;
         }
-      PyTuple_SetItem (row, i, val);
+
+      ret = _cubrid_LobObject_import_file (self, PyBytes_AS_STRING (path));
+      Py_DECREF (path);
+      return ret;
     }
 
-  return row;
+  if (PyObject_CheckBuffer (src))
+    {
+      return _cubrid_LobObject_import_buffer (self, src);
+    }
+
+  return _cubrid_LobObject_import_stream (self, src);
 }
 
+
+static char _cubrid_LobObject_write__doc__[] = "write(string)\n\
+writes a string to the large object.If LOB object does not exist.\n\
+It will be create a BLOB object as default.\n\
+string can also be any bytes-like object; it is sent chunk_size bytes\n\
+per request, with the GIL released.\n\
+\n\
+Example 1::\n\
+  import _cubrid\n\
+  con = _cubrid.connect('CUBRID:localhost:33000:demodb:::', 'public')\n\
+  cur = con.cursor()\n\
+  cur.prepare('insert into test_clob(content) values (?)')\n\
+  lob = con.lob()\n\
+  content = 'CUBRID is a very powerful RDBMS'\n\
+  lob.write(content, 'C')\n\
+  cur.bind_lob(1, lob)\n\
+  cur.execute()\n\
+  lob.close()\n\
+  cur.close()\n\
+  con.close()\n\
+\n\
+Example 2::\n\
+  import _cubrid\n\
+  con = _cubrid.connect('CUBRID:localhost:33000:demodb:::', 'public')\n\
+  cur = con.cursor()\n\
+  cur.prepare('select * from test_blob')\n\
+  cur.execute()\n\
+  lob = con.lob()\n\
+  cur.fetch_lob(1, lob)\n\
+  lob.seek(50, SEEK_CUR)\n\
+  lob.write('CUBRID a powerfer database')\n\
+  lob.close()\n\
+  cur.close()\n\
+  con.close()";
+
 static PyObject *
-_cubrid_row_to_dict (_cubrid_CursorObject * self)
+_cubrid_LobObject_write (_cubrid_LobObject * self, PyObject * args)
 {
-  PyObject *row, *val;
-  int i, type;
+  Py_buffer data;
+  char *type = NULL;
+  int res;
+  PyObject *ret;
+  T_CCI_ERROR error;
 
-  if (self->state == CURSOR_STATE_CLOSED)
+  if (!PyArg_ParseTuple (args, "s*|s", &data, &type))
     {
-      return handle_error (CUBRID_ER_INVALID_CURSOR, NULL);
+      return NULL;
     }
-  if (!(row = PyDict_New ()))
+
+  if (self->blob == NULL && self->clob == NULL)
     {
-      return NULL;
+      ret = _cubrid_LobObject_create_type (self, type);
+      if (!ret)
+        {
+          PyBuffer_Release (&data);
+          return NULL;
+        }
+      Py_DECREF (ret);
     }
 
-  for (i = 0; i < self->col_count; i++)
+  res = _cubrid_LobObject_write_chunks (self, &self->pos, data.buf, data.len,
+                                        &error);
+  PyBuffer_Release (&data);
+  if (res < 0)
     {
-      char *col_name = CCI_GET_RESULT_INFO_NAME (self->col_info, i + 1);
+      return handle_error (res, &error);
+    }
 
-      type = CCI_GET_RESULT_INFO_TYPE (self->col_info, i + 1);
+  Py_INCREF (Py_None);
+  return Py_None;
+}
 
-      if (CCI_IS_COLLECTION_TYPE (type))
+static PyObject *
+_cubrid_LobObject_export_file (_cubrid_LobObject * self,
+                               const char *filename)
+{
+  char *buf;
+  int fd, size = 0, write_failed = 0, chunk_size = self->chunk_size;
+  CUBRID_LONG_LONG pos = 0, lob_size;
+  T_CCI_ERROR error;
+
+  fd = open (filename, O_CREAT | O_WRONLY | O_TRUNC, 0666);
+  if (fd < 0)
+    {
+      return handle_error (CUBRID_ER_OPEN_FILE, NULL);
+    }
+
+  buf = PyMem_RawMalloc (chunk_size);
+  if (!buf)
+    {
+      close (fd);
+      unlink (filename);
+      return handle_error (CUBRID_ER_NO_MORE_MEMORY, NULL);
+    }
+  CUBRID_COUNT_ALLOC ();
+
+  lob_size = _cubrid_LobObject_cci_lob_size (self);
+
+  CUBRID_BEGIN_ALLOW_THREADS (self->conn);
+  while (pos < lob_size)
+    {
+      size = (lob_size - pos > chunk_size) ?
+        chunk_size : (int) (lob_size - pos);
+      size = _cubrid_LobObject_cci_read (self, pos, size, buf, &error);
+      if (size <= 0)
         {
-          val = _cubrid_CursorObject_dbset_to_pyvalue (self, type, i + 1);
+          break;
         }
-      else
+
+      if (write (fd, buf, size) != size)
         {
-          val = _cubrid_CursorObject_dbval_to_pyvalue (self, type, i + 1);
+          write_failed = 1;
+          break;
         }
-      PyMapping_SetItemString (row, col_name, val);
+
+      pos += size;
     }
+  CUBRID_END_ALLOW_THREADS (self->conn);
 
-  return row;
-}
+  PyMem_RawFree (buf);
+  close (fd);
 
-static char _cubrid_CursorObject_fetch__doc__[] = "fetch_row()\n\
-get a single row from the query result. The cursor automatically moves\n\
-to the next row after getting the result.\n\
-\n\
-Example::\n\
-  import _cubrid\n\
-  con = _cubrid.connect('CUBRID:localhost:33000:demodb:::', 'public')\n\
-  cur = con.cursor()\n\
-  cur.prepare('select * from test_cubrid')\n\
-  cur.execute()\n\
-  row = cur.fetch_row()\n\
-  while row:\n\
-    print row\n\
-    row = cur.fetch_row()\n\
-  cur.close()\n\
-  con.close()";
+  if (size < 0)
+    {
+      unlink (filename);
+      return handle_error (size, &error);
+    }
+  if (write_failed)
+    {
+      unlink (filename);
+      return handle_error (CUBRID_ER_WRITE_FILE, NULL);
+    }
+
+  return PyLong_FromLongLong (pos);
+}
 
+/* Copy the large object to a file object, chunk_size bytes per write()
+   call. Each chunk is passed as a memoryview of one reused bytearray;
+   short writes are retried with the remainder. */
 static PyObject *
-_cubrid_CursorObject_fetch (_cubrid_CursorObject * self, PyObject * args)
+_cubrid_LobObject_export_stream (_cubrid_LobObject * self, PyObject * dst)
 {
-  int res, how = 0;
+  PyObject *chunk, *view = NULL, *part, *ret;
+  CUBRID_LONG_LONG pos = 0, lob_size, size;
+  Py_ssize_t off, written;
   T_CCI_ERROR error;
-  PyObject *row;
 
-  if (self->state == CURSOR_STATE_CLOSED)
+  chunk = PyByteArray_FromStringAndSize (NULL, self->chunk_size);
+  if (!chunk)
     {
-      return handle_error (CUBRID_ER_INVALID_CURSOR, NULL);
+      return NULL;
     }
-  if (!PyArg_ParseTuple (args, "|i", &how))
+
+  view = PyMemoryView_FromObject (chunk);
+  if (!view)
     {
+      Py_DECREF (chunk);
       return NULL;
     }
 
-  if (how < 0 || how > 1)
-    {
-      return handle_error (CUBRID_ER_INVALID_PARAM, NULL);
+  lob_size = _cubrid_LobObject_cci_lob_size (self);
+
+  while (pos < lob_size)
+    {
+      size = _cubrid_LobObject_read_chunks (self, pos,
+                                            PyByteArray_AS_STRING (chunk),
+                                            PyByteArray_GET_SIZE (chunk),
+                                            &error);
+      if (size < 0)
+        {
+          Py_DECREF (view);
+          Py_DECREF (chunk);
+          return handle_error ((int) size, &error);
+        }
+      if (size == 0)
+        {
+          break;
+        }
+
+      for (off = 0; off < size; off += written)
+        {
+          part = PySequence_GetSlice (view, off, (Py_ssize_t) size);
+          if (!part)
+            {
+              goto error;
+            }
+
+          ret = PyObject_CallMethod (dst, "write", "O", part);
+          Py_DECREF (part);
+          if (!ret)
+            {
+              goto error;
+            }
+
+          /* Buffered writers return None or the full length */
+          written = (ret == Py_None) ? (Py_ssize_t) size - off :
+            PyLong_AsSsize_t (ret);
+          Py_DECREF (ret);
+          if (written < 0 && PyErr_Occurred ())
+            {
+              goto error;
+            }
+          if (written <= 0)
+            {
+              Py_DECREF (view);
+              Py_DECREF (chunk);
+              return handle_error (CUBRID_ER_WRITE_FILE, NULL);
+            }
+        }
+
+      pos += size;
     }
 
-  res = cci_cursor (self->handle, 0, CCI_CURSOR_CURRENT, &error);
-  if (res == CCI_ER_NO_MORE_DATA)
-    {
-      Py_INCREF (Py_None);
-      return Py_None;
-    }
-  else if (res < 0)
-    {
-      return handle_error (res, &error);
-    }
+  Py_DECREF (view);
+  Py_DECREF (chunk);
+  return PyLong_FromLongLong (pos);
 
-  res = cci_fetch (self->handle, &error);
-  if (res < 0)
-    {
-      return handle_error (res, &error);
-    }
+error:
+  Py_DECREF (view);
+  Py_DECREF (chunk);
+  return NULL;
+}
 
-  if (how == 0)
-    {
-      row = _cubrid_row_to_tuple (self);
-    }
-  else
+static PyObject *
+_cubrid_LobObject_export_buffer (_cubrid_LobObject * self, PyObject * dst)
+{
+  Py_buffer data;
+  CUBRID_LONG_LONG size;
+  T_CCI_ERROR error;
+
+  if (PyObject_GetBuffer (dst, &data, PyBUF_WRITABLE) < 0)
     {
-      row = _cubrid_row_to_dict (self);
+      return NULL;
     }
 
-  res = cci_cursor (self->handle, 1, CCI_CURSOR_CURRENT, &error);
-  if (res < 0 && res != CCI_ER_NO_MORE_DATA)
+  size = _cubrid_LobObject_read_chunks (self, 0, data.buf, data.len, &error);
+  PyBuffer_Release (&data);
+  if (size < 0)
     {
-      return handle_error (res, &error);
+      return handle_error ((int) size, &error);
     }
 
-  self->cursor_pos += 1;
-
-  return row;
+  return PyLong_FromLongLong (size);
 }
 
-static char _cubrid_CursorObject_fetch_lob__doc__[] = "fetch_lob(col, lob)\n\
-get BLOB/CLOB data out from the database server. You need to specify\n\
-which column is lob type.\n\
+static char _cubrid_LobObject_export__doc__[] = "export(file)\n\
+export BLOB/CLOB data to the specified file. To use this function, you must\n\
+use fetch_lob() in cursor class first to get BLOB/CLOB info from CUBRID.\n\
 \n\
-Parameters::\n\
-  col: int, the column of LOB\n\
-  lob: LOB object, to process LOB data.\n\
+file: a file name, a file object opened for writing in binary mode, or a\n\
+writable bytes-like object such as bytearray or memoryview, which receives\n\
+at most len(file) bytes. The data is read chunk_size bytes per request,\n\
+with the GIL released.\n\
+\n\
+Return the number of bytes exported.\n\
 \n\
 Example::\n\
   import _cubrid\n\
@@ -2784,1156 +7716,1568 @@ Example::\n\
   cur.execute()\n\
   lob = con.lob()\n\
   cur.fetch_lob(1, lob)\n\
+  lob.export('out')\n\
   lob.close()\n\
   cur.close()\n\
   con.close()";
 
 static PyObject *
-_cubrid_CursorObject_fetch_lob (_cubrid_CursorObject * self, PyObject * args)
+_cubrid_LobObject_export (_cubrid_LobObject * self, PyObject * args)
 {
-  _cubrid_LobObject *lob;
-  int col = 1, res, ind;
-  T_CCI_ERROR error;
+  PyObject *dst, *path = NULL, *ret;
 
-  if (self->state == CURSOR_STATE_CLOSED)
-    {
-      return handle_error (CUBRID_ER_INVALID_CURSOR, NULL);
-    }
-  if (!PyArg_ParseTuple (args, "iO!", &col, &_cubrid_LobObject_type, &lob))
+  if (!PyArg_ParseTuple (args, "O", &dst))
     {
       return NULL;
     }
 
-  res = cci_cursor (self->handle, 0, CCI_CURSOR_CURRENT, &error);
-  if (res == CCI_ER_NO_MORE_DATA)
+  if (self->blob == NULL && self->clob == NULL)
     {
-      Py_INCREF (Py_None);
-      return Py_None;
+      return handle_error (CUBRID_ER_LOB_NOT_EXIST, NULL);
     }
-  else if (res < 0)
+
+  if (_cubrid_LobObject_is_path (dst))
     {
-      return handle_error (res, &error);
+      if (!PyUnicode_FSConverter (dst, &path))
+        {
+          return NULL;
+        }
+
+      ret = _cubrid_LobObject_export_file (self, PyBytes_AS_STRING (path));
+      Py_DECREF (path);
+      return ret;
     }
 
-  res = cci_fetch (self->handle, &error);
-  if (res < 0)
+  if (PyObject_HasAttrString (dst, "write"))
     {
-      return handle_error (res, &error);
+      return _cubrid_LobObject_export_stream (self, dst);
     }
 
-  if (CCI_GET_RESULT_INFO_TYPE (self->col_info, 1) == CCI_U_TYPE_BLOB)
+  return _cubrid_LobObject_export_buffer (self, dst);
+}
+
+static char _cubrid_LobObject_readinto__doc__[] = "readinto(buffer)\n\
+read data from the current position into a writable bytes-like object,\n\
+such as bytearray or memoryview, without creating an intermediate\n\
+string. The data is read chunk_size bytes per request, with the GIL\n\
+released.\n\
+\n\
+Return the number of bytes read, 0 at the end of the large object.";
+
+static PyObject *
+_cubrid_LobObject_readinto (_cubrid_LobObject * self, PyObject * args)
+{
+  Py_buffer data;
+  CUBRID_LONG_LONG size;
+  T_CCI_ERROR error;
+
+  if (!PyArg_ParseTuple (args, "w*", &data))
     {
-      lob->type = CUBRID_BLOB;
-      res =
-        cci_get_data (self->handle, col, CCI_A_TYPE_BLOB,
-                      (void *) &lob->blob, &ind);
-      if (res < 0)
-        {
-          return handle_error (res, NULL);
-        }
+      return NULL;
     }
-  else
+
+  if (self->blob == NULL && self->clob == NULL)
     {
-      lob->type = CUBRID_CLOB;
-      res =
-        cci_get_data (self->handle, col, CCI_A_TYPE_CLOB,
-                      (void *) &lob->clob, &ind);
-      if (res < 0)
-        {
-          return handle_error (res, NULL);
-        }
+      PyBuffer_Release (&data);
+      return handle_error (CUBRID_ER_LOB_NOT_EXIST, NULL);
     }
 
-  res = cci_cursor (self->handle, 1, CCI_CURSOR_CURRENT, &error);
-  if (res < 0 && res != CCI_ER_NO_MORE_DATA)
+  size = _cubrid_LobObject_read_chunks (self, self->pos, data.buf, data.len,
+                                        &error);
+  PyBuffer_Release (&data);
+  if (size < 0)
     {
-      return handle_error (res, &error);
+      return handle_error ((int) size, &error);
     }
 
-  self->cursor_pos += 1;
+  self->pos += size;
 
-  Py_INCREF (Py_None);
-  return Py_None;
+  return PyLong_FromLongLong (size);
 }
 
-static char _cubrid_CursorObject_affected_rows__doc__[] = "affected_rows()\n\
-get the number of rows affected by the SQL sentence (INSERT,\n\
-DELETE, UPDATE).\n\
-\n\
-Return values::\n\
-  Success: Number of rows affected by the SQL sentence\n\
-  Failure: -1";
+static char _cubrid_LobObject_size__doc__[] = "size()\n\
+Return the size of the large object in bytes.";
 
 static PyObject *
-_cubrid_CursorObject_affected_rows (_cubrid_CursorObject * self,
-                                    PyObject * args)
+_cubrid_LobObject_size (_cubrid_LobObject * self, PyObject * args)
 {
-  int affected_rows;
-
-  if (self->state == CURSOR_STATE_CLOSED)
-    {
-      return handle_error (CUBRID_ER_INVALID_CURSOR, NULL);
-    }
   if (!PyArg_ParseTuple (args, ""))
     {
       return NULL;
     }
 
-  switch (self->sql_type)
+  if (self->blob == NULL && self->clob == NULL)
     {
-    case SQLX_CMD_INSERT:
-    case SQLX_CMD_UPDATE:
-    case SQLX_CMD_DELETE:
-      affected_rows = self->row_count;
-      break;
-    default:
-      affected_rows = -1;
-      break;
+      return handle_error (CUBRID_ER_LOB_NOT_EXIST, NULL);
     }
 
-  return PyLong_FromLong (affected_rows);
+  return PyLong_FromLongLong (_cubrid_LobObject_cci_lob_size (self));
 }
 
-static char _cubrid_CursorObject_data_seek__doc__[] = "data_seek(n)\n\
-move the cursor based on the original position.\n\
+static char _cubrid_LobObject_read__doc__[] = "read(len)\n\
+read a chunk of data from the current file position.\n\
+If not given the length, it will read all the remaining data.\n\
 \n\
-offset: int, number of units you want to move the cursor.";
+Return a string that contains the data read.\n\
+\n\
+Example 1::\n\
+  import _cubrid\n\
+  con = _cubrid.connect('CUBRID:localhost:33000:demodb:::', 'public')\n\
+  lob = con.lob()\n\
+  lob.imports('README', 'C')\n\
+  str = lob.read(32)\n\
+  print str\n\
+  lob.close()\n\
+  con.clsoe()\n\
+\n\
+Example 2::\n\
+  import _cubrid\n\
+  con = _cubrid.connect('CUBRID:localhost:33000:demodb:::', 'public')\n\
+  cur = con.cursor()\n\
+  cur.prepare('select * from test_lob')\n\
+  cur.execute()\n\
+  lob = con.lob()\n\
+  cur.fetch_lob(1, lob)\n\
+  print lob.read(32)\n\
+  lob.close()\n\
+  cur.close()\n\
+  con.close()";
 
 static PyObject *
-_cubrid_CursorObject_data_seek (_cubrid_CursorObject * self, PyObject * args)
+_cubrid_LobObject_read (_cubrid_LobObject * self, PyObject * args)
 {
-  int res;
+  char *buf;
   T_CCI_ERROR error;
-  int row;
+  PyObject *ret;
+  CUBRID_LONG_LONG size, len = 0, res;
 
-  if (self->state == CURSOR_STATE_CLOSED)
-    {
-      return handle_error (CUBRID_ER_INVALID_CURSOR, NULL);
-    }
-  if (!PyArg_ParseTuple (args, "i", &row))
+  if (!PyArg_ParseTuple (args, "|L", &len))
     {
       return NULL;
     }
 
-  if (row < 1 || row > self->row_count)
+  if (len < 0)
     {
-      return handle_error (CUBRID_ER_INVALID_PARAM, &error);
+      return handle_error (CUBRID_ER_INVALID_PARAM, NULL);
     }
 
-  res = cci_cursor (self->handle, row, CCI_CURSOR_FIRST, &error);
-  if (res < 0 || res == CCI_ER_NO_MORE_DATA)
+  if (self->blob == NULL && self->clob == NULL)
     {
-      return handle_error (res, &error);
+      return handle_error (CUBRID_ER_LOB_NOT_EXIST, NULL);
     }
 
-  self->cursor_pos = row;
-
-  Py_INCREF (Py_None);
-  return Py_None;
-}
-
-static char _cubrid_CursorObject_num_fields__doc__[] = "num_fields()\n\
-get the number of columns from the query result. It can\n\
-only be used when the query executed is a select sentence.\n";
-
-static PyObject *
-_cubrid_CursorObject_num_fields (_cubrid_CursorObject * self, PyObject * args)
-{
-  if (self->state == CURSOR_STATE_CLOSED)
+  if (!len)
     {
-      return handle_error (CUBRID_ER_INVALID_CURSOR, NULL);
+      size = _cubrid_LobObject_cci_lob_size (self);
+      len = size - self->pos;
     }
-  if (!PyArg_ParseTuple (args, ""))
+
+  buf = PyMem_Malloc ((int) len);
+  if (!buf)
     {
-      return NULL;
+      return handle_error (CUBRID_ER_NO_MORE_MEMORY, NULL);
     }
+  CUBRID_COUNT_ALLOC ();
 
-  if (self->sql_type == SQLX_CMD_SELECT)
+  res = _cubrid_LobObject_read_chunks (self, self->pos, buf, len, &error);
+  if (res < 0)
     {
-      return PyLong_FromLong (self->col_count);
+      PyMem_Free (buf);
+      return handle_error ((int) res, &error);
     }
 
-  Py_INCREF (Py_None);
-  return Py_None;
+  self->pos += res;
+
+  ret = PyUnicode_FromStringAndSize (buf, (Py_ssize_t) res);
+
+  PyMem_Free (buf);
+  return ret;
 }
 
-static char _cubrid_CursorObject_num_rows__doc__[] = "num_rows()\n\
-get the number of rows from the query result. It can\n\
-only be used when the query executed is a select sentence.\n";
+static char _cubrid_LobObject_seek__doc__[] = "seek(offset[, whence])\n\
+move the LOB object current position to the direction LOB object\n\
+according to the mode whence giving.\n\
+The argument whence can be the following values:\n\
+ - SEKK_SET: means move the cursor based on the original position,\n\
+   offset must be positive number, the cursor will be moved forward\n\
+   offset units relative to the original position.\n\
+ - SEEK_CUR: means move the cursor based on the current position.\n\
+   If offset is positive number, means move the cursor forward offset\n\
+   units. If offset is negative number, means move back offset units.\n\
+   This is the default value.\n\
+ - SEEK_END: means move the cursor based on the end position, offset\n\
+   must be positive number, the cursor will be moved back offset units\n\
+   relative to the end position.\n\
+\n\
+Return the current position of the cursor.";
 
 static PyObject *
-_cubrid_CursorObject_num_rows (_cubrid_CursorObject * self, PyObject * args)
+_cubrid_LobObject_seek (_cubrid_LobObject * self, PyObject * args)
 {
-  if (self->state == CURSOR_STATE_CLOSED)
+  int whence = SEEK_CUR;
+  CUBRID_LONG_LONG size, offset;
+
+  if (!PyArg_ParseTuple (args, "L|i", &offset, &whence))
     {
-      return handle_error (CUBRID_ER_INVALID_CURSOR, NULL);
+      return NULL;
+    }
+
+  if (whence == SEEK_CUR)
+    {
+      self->pos += offset;
+    }
+  else if (whence == SEEK_SET)
+    {
+      self->pos = offset;
     }
-  if (!PyArg_ParseTuple (args, ""))
+  else if (whence == SEEK_END)
     {
-      return NULL;
+      size = _cubrid_LobObject_cci_lob_size (self);
+      self->pos = size - offset;
     }
-
-  if (self->sql_type == SQLX_CMD_SELECT)
+  else
     {
-      return PyLong_FromLong (self->row_count);
+      return handle_error (CUBRID_ER_INVALID_PARAM, NULL);
     }
 
-  Py_INCREF (Py_None);
-  return Py_None;
+  return PyLong_FromLongLong (self->pos);
 }
 
-static char _cubrid_CursorObject_row_tell__doc__[] =
-  "get the current position of the cursor.";
+static void
+_cubrid_LobObject_dealloc (_cubrid_LobObject * self)
+{
+  _cubrid_LobObject_close (self, NULL);
+  Py_XDECREF (self->conn);
+  Py_TYPE (self)->tp_free ((PyObject *) self);
+}
 
-static PyObject *
-_cubrid_CursorObject_row_tell (_cubrid_CursorObject * self, PyObject * args)
+static int
+_cubrid_SetObject_init (_cubrid_SetObject * self, PyObject * args,
+                        PyObject * kwargs)
 {
-  if (self->state == CURSOR_STATE_CLOSED)
-    {
-      return handle_error (CUBRID_ER_INVALID_CURSOR, NULL);
-    }
-  if (!PyArg_ParseTuple (args, ""))
-    {
-      return NULL;
-    }
+  _cubrid_ConnectionObject *conn;
 
-  if (self->cursor_pos > self->row_count)
+  if (!PyArg_ParseTuple (args, "O!", &_cubrid_ConnectionObject_type, &conn))
     {
-      return handle_error (CUBRID_ER_INVALID_CURSOR_POS, NULL);
+      return -1;
     }
 
-  return PyLong_FromLong (self->cursor_pos);
-}
+  self->connection = conn->handle;
+  self->data = NULL;
+  self->type = CCI_U_TYPE_STRING;
+  self->allocs = 0;
 
-static char _cubrid_CursorObject_row_seek__doc__[] = "row_seek(offset)\n\
-move the current cursor based on current cursor\n\
-position. If give a positive number, it will move forward.\n\
-If you give a negative number, it will move back.\n\
-\n\
-offset: int, relative location that you want to move.\n";
+  return 0;
+}
 
 static PyObject *
-_cubrid_CursorObject_row_seek (_cubrid_CursorObject * self, PyObject * args)
+_cubrid_SetObject_new (PyTypeObject * type, PyObject * args,
+                       PyObject * kwargs)
 {
-  int offset, res;
-  T_CCI_ERROR error;
+  _cubrid_SetObject *self;
 
-  if (self->state == CURSOR_STATE_CLOSED)
-    {
-      return handle_error (CUBRID_ER_INVALID_CURSOR, NULL);
-    }
-  if (!PyArg_ParseTuple (args, "i", &offset))
+  self = (_cubrid_SetObject *) type->tp_alloc (type, 0);
+  if (!self)
     {
       return NULL;
     }
 
-  res = cci_cursor (self->handle, offset, CCI_CURSOR_CURRENT, &error);
-  if (res < 0)
-    {
-      return handle_error (res, &error);
-    }
-
-  self->cursor_pos += offset;
-
-  Py_INCREF (Py_None);
-  return Py_None;
+  return (PyObject *) self;
 }
 
-static char _cubrid_CursorObject_next_result__doc__[] = "next_result()\n\
-get results of next query if CUBRID_EXEC_QUERY_ALL\n\
-flag is set upon execute(). If next result is executed successfully,\n\
-the database is updated with the information of the current query.";
+static void
+_cubrid_SetObject_dealloc (_cubrid_SetObject * self)
+{
+  cci_set_free (self->data);
+  Py_TYPE (self)->tp_free ((PyObject *) self);
+}
 
-static PyObject *
-_cubrid_CursorObject_next_result (_cubrid_CursorObject * self,
-                                  PyObject * args)
+static char *
+_cubrid_str2bit (char *str)
 {
-  int res, col_count;
-  T_CCI_ERROR error;
-  T_CCI_COL_INFO *res_col_info;
-  T_CCI_SQLX_CMD res_sql_type;
+  int i = 0, len = 0, t = 0;
+  char *buf = NULL;
+  int shift = 8;
 
-  if (self->state == CURSOR_STATE_CLOSED)
-    {
-      return handle_error (CUBRID_ER_INVALID_CURSOR, NULL);
-    }
-  if (!PyArg_ParseTuple (args, ""))
+  if (str == NULL)
+    return NULL;
+  len = strlen (str);
+
+  if (0 == len % shift)
+    t = 1;
+
+  buf = (char *) malloc (len / shift + 1 + 1);
+  if (!buf)
+    return NULL;
+  CUBRID_COUNT_ALLOC ();
+  memset (buf, 0, len / shift + 1 + 1);
+
+  for (i = 0; i < len; i++)
     {
-      return NULL;
+      if (str[len - i - 1] == '1')
+        {
+          buf[len / shift - i / shift - t] |= (1 << (i % shift));
+        }
+      else if (str[len - i - 1] == '0')
+        {
+          //nothing
+        }
+      else
+        {
+          free (buf);
+          return NULL;
+        }
     }
+  return buf;
+}
 
-  //_cubrid_CursorObject_reset (self);
-  if (self->description)
+static int
+_cubrid_set_number_rank (int u_type)
+{
+  switch (u_type)
     {
-      Py_DECREF (self->description);
-      self->description = NULL;
+    case CCI_U_TYPE_INT:
+      return 1;
+    case CCI_U_TYPE_BIGINT:
+      return 2;
+    case CCI_U_TYPE_DOUBLE:
+      return 3;
+    default:
+      return 0;
     }
+}
 
-  self->bind_num = -1;
-  self->col_count = -1;
-  self->sql_type = 0;
-  self->row_count = -1;
-  self->cursor_pos = 0;
+/*
+ * Make the set from Python values of the element types CCI can encode
+ * directly: int (INT, or BIGINT when one does not fit), float (DOUBLE,
+ * ints are widened when mixed with floats), date, time, datetime, bytes
+ * (VARBIT), Decimal (NUMERIC) and None (NULL). The values are not
+ * converted to strings, so sets with many numbers are cheap to build.
+ */
+static PyObject *
+_cubrid_SetObject_import_values (_cubrid_SetObject * self, PyObject * seq)
+{
+  Py_ssize_t i, num = PySequence_Fast_GET_SIZE (seq);
+  PyObject **items = PySequence_Fast_ITEMS (seq);
+  PyObject **strs = NULL;
+  int u_type = CCI_U_TYPE_NULL, kind, overflow, err_code;
+  int *indicator = NULL;
+  void *data = NULL;
+  size_t size;
+  T_CCI_SET set;
 
-  res = cci_next_result (self->handle, &error);
-  if (res == CAS_ER_NO_MORE_RESULT_SET)
+  if (num > INT_MAX)
     {
-      goto RETURN_NEXT_RESULT;
-    }
-  if (res < 0)
-    {
-      return handle_error (res, &error);
+      return handle_error (CUBRID_ER_INVALID_PARAM, NULL);
     }
 
-  res_col_info =
-    cci_get_result_info (self->handle, &res_sql_type, &col_count);
-  if (res_sql_type == SQLX_CMD_SELECT && !res_col_info)
+  for (i = 0; i < num; i++)
     {
-      return handle_error (CUBRID_ER_CANNOT_GET_COLUMN_INFO, NULL);
-    }
+      PyObject *item = items[i];
 
-  self->col_info = res_col_info;
-  self->sql_type = res_sql_type;
-  self->col_count = col_count;
+      if (item == Py_None)
+        {
+          continue;
+        }
+      else if (PyLong_Check (item))
+        {
+          CUBRID_LONG_LONG value = PyLong_AsLongLongAndOverflow (item,
+                                                                 &overflow);
+          if (overflow)
+            {
+              return handle_error (CUBRID_ER_INVALID_PARAM, NULL);
+            }
+          kind = (value >= INT_MIN && value <= INT_MAX) ?
+            CCI_U_TYPE_INT : CCI_U_TYPE_BIGINT;
+        }
+      else if (PyFloat_Check (item))
+        {
+          kind = CCI_U_TYPE_DOUBLE;
+        }
+      else if (PyDateTime_Check (item))
+        {
+          kind = CCI_U_TYPE_DATETIME;
+        }
+      else if (PyDate_Check (item))
+        {
+          kind = CCI_U_TYPE_DATE;
+        }
+      else if (PyTime_Check (item))
+        {
+          kind = CCI_U_TYPE_TIME;
+        }
+      else if (PyBytes_Check (item))
+        {
+          kind = CCI_U_TYPE_VARBIT;
+        }
+      else if (PyObject_IsInstance (item, DecimalType) == 1)
+        {
+          kind = CCI_U_TYPE_NUMERIC;
+        }
+      else
+        {
+          return handle_error (CUBRID_ER_INVALID_PARAM, NULL);
+        }
 
-  switch (res_sql_type)
+      if (u_type == CCI_U_TYPE_NULL || u_type == kind)
+        {
+          u_type = kind;
+        }
+      else if (_cubrid_set_number_rank (u_type)
+               && _cubrid_set_number_rank (kind))
+        {
+          /* Mixed numbers are widened: INT < BIGINT < DOUBLE */
+          if (_cubrid_set_number_rank (kind) > _cubrid_set_number_rank (u_type))
+            {
+              u_type = kind;
+            }
+        }
+      else if ((u_type == CCI_U_TYPE_DATE && kind == CCI_U_TYPE_DATETIME)
+               || (u_type == CCI_U_TYPE_DATETIME && kind == CCI_U_TYPE_DATE))
+        {
+          /* Dates mixed with datetimes are taken at midnight */
+          u_type = CCI_U_TYPE_DATETIME;
+        }
+      else
+        {
+          return handle_error (CUBRID_ER_INVALID_PARAM, NULL);
+        }
+    }
+
+  switch (u_type)
     {
-    case SQLX_CMD_SELECT:
-    case SQLX_CMD_INSERT:
-    case SQLX_CMD_UPDATE:
-    case SQLX_CMD_DELETE:
-    case SQLX_CMD_CALL:
-      self->row_count = res;
+    case CCI_U_TYPE_INT:
+      size = sizeof (int);
+      break;
+    case CCI_U_TYPE_BIGINT:
+      size = sizeof (CUBRID_LONG_LONG);
+      break;
+    case CCI_U_TYPE_DOUBLE:
+      size = sizeof (double);
+      break;
+    case CCI_U_TYPE_DATETIME:
+    case CCI_U_TYPE_DATE:
+    case CCI_U_TYPE_TIME:
+      size = sizeof (T_CCI_DATE);
+      break;
+    case CCI_U_TYPE_VARBIT:
+      size = sizeof (T_CCI_BIT);
       break;
     default:
-      self->row_count = -1;
+      /* NUMERIC, or only NULL elements: strings */
+      if (u_type == CCI_U_TYPE_NULL)
+        {
+          u_type = CCI_U_TYPE_STRING;
+        }
+      size = sizeof (char *);
       break;
     }
 
-  if (res_sql_type == SQLX_CMD_SELECT)
+  data = calloc (num + 1, size);
+  indicator = (int *) calloc (num + 1, sizeof (int));
+  if (u_type == CCI_U_TYPE_NUMERIC)
     {
-      _cubrid_CursorObject_set_description (self);
-      res = cci_cursor (self->handle, 1, CCI_CURSOR_CURRENT, &error);
-      if (res < 0 && res != CCI_ER_NO_MORE_DATA)
+      strs = (PyObject **) calloc (num + 1, sizeof (PyObject *));
+    }
+  if (!data || !indicator || (u_type == CCI_U_TYPE_NUMERIC && !strs))
+    {
+      free (data);
+      free (indicator);
+      free (strs);
+      return handle_error (CUBRID_ER_NO_MORE_MEMORY, NULL);
+    }
+  CUBRID_COUNT_ALLOC ();
+  CUBRID_COUNT_ALLOC ();
+  if (strs)
+    {
+      CUBRID_COUNT_ALLOC ();
+    }
+
+  for (i = 0; i < num; i++)
+    {
+      PyObject *item = items[i];
+
+      if (item == Py_None)
         {
-          return handle_error (res, &error);
+          indicator[i] = 1;
+          continue;
         }
-    }
 
-RETURN_NEXT_RESULT:
-  Py_INCREF (Py_None);
-  return Py_None;
-}
+      switch (u_type)
+        {
+        case CCI_U_TYPE_INT:
+          ((int *) data)[i] = (int) PyLong_AsLong (item);
+          break;
+        case CCI_U_TYPE_BIGINT:
+          ((CUBRID_LONG_LONG *) data)[i] = PyLong_AsLongLong (item);
+          break;
+        case CCI_U_TYPE_DOUBLE:
+          ((double *) data)[i] = PyFloat_AsDouble (item);
+          break;
+        case CCI_U_TYPE_DATETIME:
+        case CCI_U_TYPE_DATE:
+        case CCI_U_TYPE_TIME:
+          _cubrid_pydate_to_cci (item, &((T_CCI_DATE *) data)[i]);
+          break;
+        case CCI_U_TYPE_VARBIT:
+          ((T_CCI_BIT *) data)[i].buf = PyBytes_AS_STRING (item);
+          ((T_CCI_BIT *) data)[i].size = (int) PyBytes_GET_SIZE (item);
+          break;
+        case CCI_U_TYPE_NUMERIC:
+          strs[i] = PyObject_Str (item);
+          if (strs[i])
+            {
+              ((const char **) data)[i] = PyUnicode_AsUTF8 (strs[i]);
+            }
+          break;
+        }
+    }
 
-static char _cubrid_CursorObject_close__doc__[] =
-  "close() -- Close the current cursor object.";
+  err_code = PyErr_Occurred () ? 0 :
+    cci_set_make (&set, u_type, (int) num, data, indicator);
 
-static PyObject *
-_cubrid_CursorObject_close (_cubrid_CursorObject * self, PyObject * args)
-{
-  if (self->state == CURSOR_STATE_CLOSED)
+  if (strs)
     {
-      return handle_error (CUBRID_ER_INVALID_CURSOR, NULL);
+      for (i = 0; i < num; i++)
+        {
+          Py_XDECREF (strs[i]);
+        }
+      free (strs);
     }
-  if (!PyArg_ParseTuple (args, ""))
+  free (data);
+  free (indicator);
+
+  if (PyErr_Occurred ())
     {
       return NULL;
     }
+  if (err_code < 0)
+    {
+      return handle_error (err_code, NULL);
+    }
+
+  if (self->data)
+    {
+      cci_set_free (self->data);
+    }
+  self->data = set;
+  self->type = u_type;
 
-  _cubrid_CursorObject_reset (self);
-  self->state = CURSOR_STATE_CLOSED;
   Py_INCREF (Py_None);
   return Py_None;
 }
 
-static void
-_cubrid_CursorObject_dealloc (_cubrid_CursorObject * self)
-{
-  _cubrid_CursorObject_reset (self);
-  Py_TYPE (self)->tp_free ((PyObject *) self);
-}
-
 static PyObject *
-_cubrid_LobObject_new (PyTypeObject * type, PyObject * args,
-                       PyObject * kwargs)
+_cubrid_SetObject_import_strings (_cubrid_SetObject * self, PyObject * pTube,
+                                  int type)
 {
-  _cubrid_LobObject *self;
+  const char **data = NULL, **pointer = NULL;
+  int *indicator = NULL;
+  int i = 0, num = 1;
+  T_CCI_SET set;
+  int err_code = 0;
+  char *temp_data_char;
+  T_CCI_BIT *pBit = NULL;
 
-  self = (_cubrid_LobObject *) type->tp_alloc (type, 0);
-  if (!self)
-    {
-      return NULL;
-    }
+  PyObject *pValue;
 
-  return (PyObject *) self;
-}
+  num = PySequence_Fast_GET_SIZE (pTube);
+  data = (const char **) _cubrid_get_data_buf (type, num + 1);
+  pointer = (const char **) _cubrid_get_data_buf (type, num + 1);
+  indicator = (int *) _cubrid_dup_buf (NULL, sizeof (int) * (num + 1));
 
-static int
-_cubrid_LobObject_init (_cubrid_LobObject * self, PyObject * args,
-                        PyObject * kwargs)
-{
-  _cubrid_ConnectionObject *conn;
 
-  if (!PyArg_ParseTuple (args, "O!", &_cubrid_ConnectionObject_type, &conn))
+  for (i = 0; i < num; ++i)
     {
-      return -1;
+      pValue = PySequence_Fast_GET_ITEM (pTube, i);
+      pointer[i] = PyUnicode_AsUTF8 (pValue);
+
+      if (pointer[i] == NULL || (strlen (pointer[i]) == 0))
+        {
+          return handle_error (CUBRID_ER_INVALID_PARAM, NULL);
+        }
+
+      if (strcmp (pointer[i], "NULL") == 0)
+        {
+          indicator[i] = 1;
+        }
     }
 
-  self->connection = conn->handle;
-  self->blob = NULL;
-  self->clob = NULL;
-  self->pos = 0;
-  self->type = CUBRID_BLOB;
 
-  return 0;
-}
+  if (NULL == indicator || NULL == data)
+    {
+      return handle_error (CUBRID_ER_NO_MORE_MEMORY, NULL);
+    }
 
-static char _cubrid_LobObject_close__doc__[] = "close() -- Close the lob";
+  switch (type)
+    {
+    case CCI_U_TYPE_BIT:
+    case CCI_U_TYPE_VARBIT:
+      for (i = 0; i < num; i++)
+        {
+          if (indicator[i] == 1)
+            continue;
+          temp_data_char = _cubrid_str2bit ((char *) pointer[i]);
+          if (temp_data_char == NULL)
+            {
+              goto handle_error;
+            }
+          pBit = (T_CCI_BIT *) data;
+          pBit[i].buf = temp_data_char;
+          pBit[i].size = strlen ((char *) pointer[i]) / 8 + 1;
+        }
+      break;
+    default:
+      err_code =
+        cci_set_make (&set, CCI_U_TYPE_STRING, num, pointer,
+                      (int *) indicator);
+      if (err_code < 0)
+        {
+          goto handle_error;
+        }
+      self->data = set;
+      Py_INCREF (Py_None);
+      free (data);
+      free (indicator);
+      free (pointer);
+      return Py_None;
+    }
 
-static PyObject *
-_cubrid_LobObject_close (_cubrid_LobObject * self, PyObject * args)
-{
-  if (self->blob)
+  err_code = cci_set_make (&set, type, num, data, (int *) indicator);
+  if (err_code < 0)
     {
-      cci_blob_free (self->blob);
-      self->blob = NULL;
+      goto handle_error;
     }
-  if (self->clob)
+  self->data = set;
+
+  pBit = (T_CCI_BIT *) data;
+  switch (type)
     {
-      cci_blob_free (self->clob);
-      self->clob = NULL;
+    case CCI_U_TYPE_BIT:
+    case CCI_U_TYPE_VARBIT:
+      for (i = 0; i < num; i++)
+        {
+          if (indicator[i] == 1)
+            continue;
+          if (pBit != NULL && pBit[i].buf != NULL)
+            {
+              free (pBit[i].buf);
+            }
+        }
     }
+
   Py_INCREF (Py_None);
+  free (data);
+  free (indicator);
+  free (pointer);
   return Py_None;
+
+handle_error:
+  free (data);
+  free (indicator);
+  free (pointer);
+  return handle_error (CUBRID_ER_INVALID_PARAM, NULL);
 }
 
 static PyObject *
-_cubrid_LobObject_create (_cubrid_LobObject * self, char type)
+_cubrid_SetObject_import (_cubrid_SetObject * self, PyObject * args)
 {
-  int res;
-  T_CCI_ERROR error;
+  PyObject *pTube, *seq, *res;
+  T_CCI_SET old;
+  Py_ssize_t i;
+  int type, native = 0;
+  long heap_allocs = _cubrid_heap_allocs;
 
-  if (type == 'B' || type == 'b')
+  if (!PyArg_ParseTuple (args, "Oi", &pTube, &type))
     {
-      res = cci_blob_new (self->connection, &self->blob, &error);
-      if (res < 0)
-        {
-          return handle_error (res, &error);
-        }
-      self->type = CUBRID_BLOB;
+      return handle_error (CUBRID_ER_INVALID_PARAM, NULL);
     }
-  else if (type == 'C' || type == 'c')
+
+  if (!PySequence_Check (pTube) || PyUnicode_Check (pTube)
+      || PyBytes_Check (pTube))
     {
-      res = cci_clob_new (self->connection, &self->clob, &error);
-      if (res < 0)
+      return handle_error (CUBRID_ER_INVALID_PARAM, NULL);
+    }
+  if (!(seq = PySequence_Fast (pTube, "data must be a sequence")))
+    {
+      return NULL;
+    }
+
+  /* Strings are parsed by the server, other values are encoded by CCI */
+  for (i = 0; i < PySequence_Fast_GET_SIZE (seq); i++)
+    {
+      PyObject *item = PySequence_Fast_GET_ITEM (seq, i);
+
+      if (item != Py_None)
         {
-          return handle_error (res, &error);
+          native = !PyUnicode_Check (item);
+          break;
         }
-      self->type = CUBRID_CLOB;
+    }
+
+  if (native)
+    {
+      res = _cubrid_SetObject_import_values (self, seq);
     }
   else
     {
-      return handle_error (CUBRID_ER_UNKNOWN_TYPE, NULL);
+      old = self->data;
+      res = _cubrid_SetObject_import_strings (self, seq, type);
+      if (res && old && old != self->data)
+        {
+          cci_set_free (old);
+        }
     }
 
-  Py_INCREF (Py_None);
-  return Py_None;
+  /* Charged to the cursor the set is bound to, see bind_set() */
+  self->allocs += _cubrid_heap_allocs - heap_allocs;
+  Py_DECREF (seq);
+  return res;
 }
 
-static int
-_cubrid_LobObject_cci_write (_cubrid_LobObject * self, CUBRID_LONG_LONG pos,
-                             int size, char *buf, T_CCI_ERROR * error)
+static char _cubrid_SetObject_import__doc__[] = "imports(data,type)\n\
+imports LIST/SET/MULTISET data. To use this function.\n\
+data:sequence of str, parsed by the server as values of type, or of\n\
+  int, float, date, time, datetime, bytes, Decimal and None values,\n\
+  which are encoded natively (type is then ignored)\n\
+type:Element type of set,default type:string.\n\
+\n\
+    Example::\n\
+from cubrid_db import FIELD_TYPE\n\
+def one_para():\n\
+    con = cubrid_db.connect('CUBRID:localhost:33000:demodb:::', 'public')\n\
+    c = con.cursor()\n\
+    set_val=(('1','23','48'),)\n\
+    etype = FIELD_TYPE.INT\n\
+    c.execute(\"insert into set_tbl_int VALUES(?)\", set_val,etype)\n\
+    con.commit();\n\
+    c.close()\n\
+    con.close() \n\
+def two_para():\n\
+    con = cubrid_db.connect('CUBRID:localhost:33000:demodb:::', 'public')\n\
+    c = con.cursor()\n\
+    set_val=(('abc','def'),('1','23','48'))\n\
+    etype = (FIELD_TYPE.CHAR,FIELD_TYPE.INT)\n\
+    c.execute('CREATE TABLE set_tbl_char_int ( col_1 set(CHAR(5)),col_2  set(int));')\n\
+    c.execute('insert into set_tbl_int VALUES(?,?)', set_val,etype)\n\
+    c.close()\n\
+    con.close()";
+
+/*
+ * Method table entries: each method runs in a critical section on the
+ * connection that owns the object, see python_cubrid.h.
+ */
+#define CUBRID_LOCKED_METHOD(func, type, owner) \
+  static PyObject * \
+  func##_locked (type * self, PyObject * args) \
+  { \
+    PyObject *res; \
+    Py_BEGIN_CRITICAL_SECTION (owner); \
+    res = func (self, args); \
+    Py_END_CRITICAL_SECTION (); \
+    return res; \
+  }
+
+/* A cursor or lob made without __init__ has no connection */
+static PyObject *
+_cubrid_CursorObject_owner (_cubrid_CursorObject * self)
 {
-  return (self->type == CUBRID_BLOB) ?
-    cci_blob_write (self->connection, self->blob, pos, size, buf, error) :
-    cci_clob_write (self->connection, self->clob, pos, size, buf, error);
+  return self->conn ? (PyObject *) self->conn : (PyObject *) self;
 }
 
-static CUBRID_LONG_LONG
-_cubrid_LobObject_cci_lob_size (_cubrid_LobObject * self)
+/*
+ * Cursor methods also charge the heap allocations they make to the
+ * cursor, for its allocs member, see _cubrid_CursorObject_arena_done().
+ */
+#define CUBRID_CURSOR_METHOD(func) \
+  static PyObject * \
+  func##_locked (_cubrid_CursorObject * self, PyObject * args) \
+  { \
+    PyObject *res; \
+    long mark; \
+    Py_BEGIN_CRITICAL_SECTION (_cubrid_CursorObject_owner (self)); \
+    mark = _cubrid_heap_allocs_mark; \
+    _cubrid_heap_allocs_mark = _cubrid_heap_allocs; \
+    res = func (self, args); \
+    self->allocs_pending += _cubrid_heap_allocs - _cubrid_heap_allocs_mark; \
+    _cubrid_heap_allocs_mark = mark; \
+    Py_END_CRITICAL_SECTION (); \
+    return res; \
+  }
+
+static PyObject *
+_cubrid_LobObject_owner (_cubrid_LobObject * self)
 {
-  return (self->type == CUBRID_BLOB) ?
-    cci_blob_size (self->blob) : cci_clob_size (self->clob);
+  return self->conn ? (PyObject *) self->conn : (PyObject *) self;
 }
 
-static char _cubrid_LobObject_import__doc__[] = "imports(file[, type])\n\
-imports file in CUBRID server.\n\
-If not give the type, it will be processed as BLOB.\n";
+CUBRID_LOCKED_METHOD (_cubrid_SetObject_import, _cubrid_SetObject,
+                      self)
+
+CUBRID_LOCKED_METHOD (_cubrid_LobObject_export, _cubrid_LobObject,
+                      _cubrid_LobObject_owner (self))
+CUBRID_LOCKED_METHOD (_cubrid_LobObject_import, _cubrid_LobObject,
+                      _cubrid_LobObject_owner (self))
+CUBRID_LOCKED_METHOD (_cubrid_LobObject_write, _cubrid_LobObject,
+                      _cubrid_LobObject_owner (self))
+CUBRID_LOCKED_METHOD (_cubrid_LobObject_read, _cubrid_LobObject,
+                      _cubrid_LobObject_owner (self))
+CUBRID_LOCKED_METHOD (_cubrid_LobObject_readinto, _cubrid_LobObject,
+                      _cubrid_LobObject_owner (self))
+CUBRID_LOCKED_METHOD (_cubrid_LobObject_size, _cubrid_LobObject,
+                      _cubrid_LobObject_owner (self))
+CUBRID_LOCKED_METHOD (_cubrid_LobObject_seek, _cubrid_LobObject,
+                      _cubrid_LobObject_owner (self))
+CUBRID_LOCKED_METHOD (_cubrid_LobObject_close, _cubrid_LobObject,
+                      _cubrid_LobObject_owner (self))
+
+CUBRID_CURSOR_METHOD (_cubrid_CursorObject_close)
+CUBRID_CURSOR_METHOD (_cubrid_CursorObject_prepare)
+CUBRID_CURSOR_METHOD (_cubrid_CursorObject_set_charset)
+CUBRID_CURSOR_METHOD (_cubrid_CursorObject_set_fetch_size)
+CUBRID_CURSOR_METHOD (_cubrid_CursorObject_bind_param)
+CUBRID_CURSOR_METHOD (_cubrid_CursorObject_bind_params)
+CUBRID_CURSOR_METHOD (_cubrid_CursorObject_bind_param_array)
+CUBRID_CURSOR_METHOD (_cubrid_CursorObject_bind_lob)
+CUBRID_CURSOR_METHOD (_cubrid_CursorObject_bind_Set)
+CUBRID_CURSOR_METHOD (_cubrid_CursorObject_execute)
+CUBRID_CURSOR_METHOD (_cubrid_CursorObject_execute_array)
+CUBRID_CURSOR_METHOD (_cubrid_CursorObject_affected_rows)
+CUBRID_CURSOR_METHOD (_cubrid_CursorObject_fetch)
+CUBRID_CURSOR_METHOD (_cubrid_CursorObject_fetch_many)
+CUBRID_CURSOR_METHOD (_cubrid_CursorObject_fetch_all)
+CUBRID_CURSOR_METHOD (_cubrid_CursorObject_fetch_block)
+CUBRID_CURSOR_METHOD (_cubrid_CursorObject_fetch_columns)
+CUBRID_CURSOR_METHOD (_cubrid_CursorObject_fetch_lob)
+CUBRID_CURSOR_METHOD (_cubrid_CursorObject_data_seek)
+CUBRID_CURSOR_METHOD (_cubrid_CursorObject_num_fields)
+CUBRID_CURSOR_METHOD (_cubrid_CursorObject_num_rows)
+CUBRID_CURSOR_METHOD (_cubrid_CursorObject_row_tell)
+CUBRID_CURSOR_METHOD (_cubrid_CursorObject_row_seek)
+CUBRID_CURSOR_METHOD (_cubrid_CursorObject_result_info)
+CUBRID_CURSOR_METHOD (_cubrid_CursorObject_next_result)
+
+CUBRID_LOCKED_METHOD (_cubrid_ConnectionObject_close, _cubrid_ConnectionObject,
+                      self)
+CUBRID_LOCKED_METHOD (_cubrid_ConnectionObject_cursor, _cubrid_ConnectionObject,
+                      self)
+CUBRID_LOCKED_METHOD (_cubrid_ConnectionObject_lob, _cubrid_ConnectionObject,
+                      self)
+CUBRID_LOCKED_METHOD (_cubrid_ConnectionObject_set, _cubrid_ConnectionObject,
+                      self)
+CUBRID_LOCKED_METHOD (_cubrid_ConnectionObject_commit, _cubrid_ConnectionObject,
+                      self)
+CUBRID_LOCKED_METHOD (_cubrid_ConnectionObject_rollback, _cubrid_ConnectionObject,
+                      self)
+CUBRID_LOCKED_METHOD (_cubrid_ConnectionObject_stmt_cache_clear, _cubrid_ConnectionObject,
+                      self)
+CUBRID_LOCKED_METHOD (_cubrid_ConnectionObject_stats, _cubrid_ConnectionObject,
+                      self)
+CUBRID_LOCKED_METHOD (_cubrid_ConnectionObject_reset_stats, _cubrid_ConnectionObject,
+                      self)
+CUBRID_LOCKED_METHOD (_cubrid_ConnectionObject_set_trace_callback, _cubrid_ConnectionObject,
+                      self)
+CUBRID_LOCKED_METHOD (_cubrid_ConnectionObject_set_meta_cache, _cubrid_ConnectionObject,
+                      self)
+CUBRID_LOCKED_METHOD (_cubrid_ConnectionObject_meta_cache_clear, _cubrid_ConnectionObject,
+                      self)
+CUBRID_LOCKED_METHOD (_cubrid_ConnectionObject_ping, _cubrid_ConnectionObject,
+                      self)
+CUBRID_LOCKED_METHOD (_cubrid_ConnectionObject_server_version, _cubrid_ConnectionObject,
+                      self)
+CUBRID_LOCKED_METHOD (_cubrid_ConnectionObject_client_version, _cubrid_ConnectionObject,
+                      self)
+CUBRID_LOCKED_METHOD (_cubrid_ConnectionObject_set_autocommit, _cubrid_ConnectionObject,
+                      self)
+CUBRID_LOCKED_METHOD (_cubrid_ConnectionObject_set_isolation_level, _cubrid_ConnectionObject,
+                      self)
+CUBRID_LOCKED_METHOD (_cubrid_ConnectionObject_last_insert_id, _cubrid_ConnectionObject,
+                      self)
+CUBRID_LOCKED_METHOD (_cubrid_ConnectionObject_schema_info, _cubrid_ConnectionObject,
+                      self)
+CUBRID_LOCKED_METHOD (_cubrid_ConnectionObject_escape_string, _cubrid_ConnectionObject,
+                      self)
+CUBRID_LOCKED_METHOD (_cubrid_ConnectionObject_batch_execute, _cubrid_ConnectionObject,
+                      self)
+
+static PyMethodDef _cubrid_SetObject_methods[] = {
+  {
+   "imports",
+   (PyCFunction) _cubrid_SetObject_import_locked,
+   METH_VARARGS,
+   _cubrid_SetObject_import__doc__},
+  {NULL, NULL}
+};
+
+static char _cubrid_SetObject__doc__[] = "Set class.\n\
+Process Set,MULTISET and LIST/SEQUENCE type\n\
+The class is support by version 9.1.0.0003 and later";
+
+PyTypeObject _cubrid_SetObject_type = {
+  PyVarObject_HEAD_INIT (NULL, 0)
+  "_cubrid.cubrid_set",                /* tp_name */
+  sizeof (_cubrid_SetObject),        /* tp_basicsize */
+  0,                                /* tp_itemsize */
+  (destructor) _cubrid_SetObject_dealloc,        /* tp_dealloc */
+  0,                                /* tp_print */
+  0,                                /* tp_getattr */
+  0,                                /* tp_setattr */
+  0,                                /* tp_compare */
+  0,                                /* tp_repr */
+  0,                                /* tp_as_number */
+  0,                                /* tp_as_sequence */
+  0,                                /* tp_as_mapping */
+  0,                                /* tp_hash */
+  0,                                /* tp_call */
+  0,                                /* tp_str */
+  0,                                /* tp_getattro */
+  0,                                /* tp_setattro */
+  0,                                /* tp_as_buffer */
+  Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE,        /* tp_flags */
+  _cubrid_SetObject__doc__,        /* tp_doc */
+  0,                                /* tp_traverse */
+  0,                                /* tp_clear */
+  0,                                /* tp_richcompare */
+  0,                                /* tp_weaklistoffset */
+  0,                                /* tp_iter */
+  0,                                /* tp_iternext */
+  _cubrid_SetObject_methods,        /* tp_methods */
+  0,                                /* tp_members */
+  0,                                /* tp_getset */
+  0,                                /* tp_base */
+  0,                                /* tp_dict */
+  0,                                /* tp_descr_get */
+  0,                                /* tp_descr_set */
+  0,                                /* tp_dictoffset */
+  (initproc) _cubrid_SetObject_init,        /* tp_init */
+  0,                                /* tp_alloc */
+  (newfunc) _cubrid_SetObject_new,        /* tp_new */
+  0,                                /* tp_free */
+};
 
 static PyObject *
-_cubrid_LobObject_import (_cubrid_LobObject * self, PyObject * args)
+_cubrid_RowObject_subscript (PyObject * self, PyObject * key)
 {
-  char *filename = NULL, buf[CUBRID_LOB_BUF_SIZE] = { '\0' }, *type = NULL;
-  int fd;
-  CUBRID_LONG_LONG pos = 0;
-  int res, type_size, size;
-  T_CCI_ERROR error;
+  PyObject *index, *pos, *item;
+  Py_ssize_t i;
 
-  if (!PyArg_ParseTuple (args, "s|s", &filename, &type))
+  if (!PyUnicode_Check (key))
     {
-      return NULL;
+      return PyTuple_Type.tp_as_mapping->mp_subscript (self, key);
     }
 
-  if (type == NULL)
+  index = PyObject_GetAttr ((PyObject *) Py_TYPE (self),
+                            _cubrid_row_index_key);
+  if (!index)
     {
-      _cubrid_LobObject_create (self, CUBRID_BLOB);
+      return NULL;
     }
-  else
+
+  pos = PyDict_GetItemWithError (index, key);
+  if (!pos)
     {
-      type_size = (int) strlen (type);
-      if (type_size > 1)
+      if (!PyErr_Occurred ())
         {
-          return handle_error (CUBRID_ER_INVALID_PARAM, NULL);
+          PyErr_SetObject (PyExc_KeyError, key);
         }
-
-      _cubrid_LobObject_create (self, *type);
-    }
-
-  fd = open (filename, O_RDONLY, 0400);
-  if (fd < 0)
-    {
-      return handle_error (CUBRID_ER_OPEN_FILE, NULL);
+      Py_DECREF (index);
+      return NULL;
     }
 
-  while (1)
+  i = PyLong_AsSsize_t (pos);
+  Py_DECREF (index);
+  if (i < 0 || i >= PyTuple_GET_SIZE (self))
     {
-      size = read (fd, buf, CUBRID_LOB_BUF_SIZE);
-      if (size < 0)
-        {
-          close (fd);
-          _cubrid_LobObject_close (self, NULL);
-          return handle_error (CUBRID_ER_READ_FILE, NULL);
-        }
-
-      if (size == 0)
-        {
-          break;
-        }
-
-      res = _cubrid_LobObject_cci_write (self, pos, size, buf, &error);
-      if (res < 0)
-        {
-          close (fd);
-          _cubrid_LobObject_close (self, NULL);
-          return handle_error (res, &error);
-        }
-
-      pos += size;
+      PyErr_SetObject (PyExc_KeyError, key);
+      return NULL;
     }
 
-  Py_INCREF (Py_None);
-  return Py_None;
+  item = PyTuple_GET_ITEM (self, i);
+  Py_INCREF (item);
+  return item;
 }
 
-
-static char _cubrid_LobObject_write__doc__[] = "write(string)\n\
-writes a string to the large object.If LOB object does not exist.\n\
-It will be create a BLOB object as default.\n\
-\n\
-Example 1::\n\
-  import _cubrid\n\
-  con = _cubrid.connect('CUBRID:localhost:33000:demodb:::', 'public')\n\
-  cur = con.cursor()\n\
-  cur.prepare('insert into test_clob(content) values (?)')\n\
-  lob = con.lob()\n\
-  content = 'CUBRID is a very powerful RDBMS'\n\
-  lob.write(content, 'C')\n\
-  cur.bind_lob(1, lob)\n\
-  cur.execute()\n\
-  lob.close()\n\
-  cur.close()\n\
-  con.close()\n\
-\n\
-Example 2::\n\
-  import _cubrid\n\
-  con = _cubrid.connect('CUBRID:localhost:33000:demodb:::', 'public')\n\
-  cur = con.cursor()\n\
-  cur.prepare('select * from test_blob')\n\
-  cur.execute()\n\
-  lob = con.lob()\n\
-  cur.fetch_lob(1, lob)\n\
-  lob.seek(50, SEEK_CUR)\n\
-  lob.write('CUBRID a powerfer database')\n\
-  lob.close()\n\
-  cur.close()\n\
-  con.close()";
+static char _cubrid_RowObject_keys__doc__[] = "keys()\n\
+Return a list of the column names of the row.";
 
 static PyObject *
-_cubrid_LobObject_write (_cubrid_LobObject * self, PyObject * args)
+_cubrid_RowObject_keys (PyObject * self, PyObject * args)
 {
-  char *buf = NULL, *type = NULL;
-  Py_ssize_t len = -1;
-  Py_ssize_t type_len = 0;
-  int res;
-  T_CCI_ERROR error;
+  PyObject *fields, *keys;
 
-  if (!PyArg_ParseTuple (args, "s#|s", &buf, &len, &type))
+  if (!PyArg_ParseTuple (args, ""))
     {
       return NULL;
     }
 
-  if (self->blob == NULL && self->clob == NULL)
-    {
-      if (type == NULL)
-        {
-          _cubrid_LobObject_create (self, CUBRID_BLOB);
-        }
-      else
-        {
-          type_len = (int) strlen (type);
-          if (type_len > 1)
-            {
-              return handle_error (CUBRID_ER_INVALID_PARAM, NULL);
-            }
-
-          _cubrid_LobObject_create (self, *type);
-        }
-    }
-
-  res = _cubrid_LobObject_cci_write (self, self->pos, len, buf, &error);
-  if (res < 0)
+  fields = PyObject_GetAttrString ((PyObject *) Py_TYPE (self), "_fields");
+  if (!fields)
     {
-      return handle_error (res, &error);
+      return NULL;
     }
 
-  self->pos += len;
-
-  Py_INCREF (Py_None);
-  return Py_None;
-}
-
-static int
-_cubrid_LobObject_cci_read (_cubrid_LobObject * self, CUBRID_LONG_LONG pos,
-                            int size, char *buf, T_CCI_ERROR * error)
-{
-  return (self->type == CUBRID_BLOB) ?
-    cci_blob_read (self->connection, self->blob, pos, size, buf, error) :
-    cci_clob_read (self->connection, self->clob, pos, size, buf, error);
+  keys = PySequence_List (fields);
+  Py_DECREF (fields);
+  return keys;
 }
 
-static char _cubrid_LobObject_export__doc__[] = "export(file)\n\
-export BLOB/CLOB data to the specified file. To use this function, you must\n\
-use fetch_lob() in cursor class first to get BLOB/CLOB info from CUBRID.\n\
-\n\
-file: string, support filepath/file\n\
-\n\
-Example::\n\
-  import _cubrid\n\
-  con = _cubrid.connect('CUBRID:localhost:33000:demodb:::', 'public')\n\
-  cur = con.cursor()\n\
-  cur.prepare('select * from test_lob')\n\
-  cur.execute()\n\
-  lob = con.lob()\n\
-  cur.fetch_lob(1, lob)\n\
-  lob.export('out')\n\
-  lob.close()\n\
-  cur.close()\n\
-  con.close()";
+static PyMappingMethods _cubrid_RowObject_as_mapping = {
+  0,                                /* mp_length */
+  _cubrid_RowObject_subscript,        /* mp_subscript */
+  0,                                /* mp_ass_subscript */
+};
 
+/*
+ * Rows are pickled as their column names and values, and unpickled with
+ * _cubrid._row(): the Row types are made at run time and cannot be found
+ * by name.
+ */
 static PyObject *
-_cubrid_LobObject_export (_cubrid_LobObject * self, PyObject * args)
+_cubrid_RowObject_reduce (PyObject * self, PyObject * args)
 {
-  char *filename = NULL, buf[CUBRID_LOB_BUF_SIZE] = { '\0' };
-  int fp, res, size;
-  CUBRID_LONG_LONG pos = 0, lob_size;
-  T_CCI_ERROR error;
-  if (!PyArg_ParseTuple (args, "s", &filename))
+  PyObject *fields, *values, *module, *make_row = NULL;
+
+  fields = PyObject_GetAttrString ((PyObject *) Py_TYPE (self), "_fields");
+  if (!fields)
     {
       return NULL;
     }
-
-  if (self->blob == NULL && self->clob == NULL)
+  values = PySequence_Tuple (self);
+  if ((module = PyImport_ImportModule ("_cubrid")))
     {
-      return handle_error (CUBRID_ER_LOB_NOT_EXIST, NULL);
+      make_row = PyObject_GetAttrString (module, "_row");
+      Py_DECREF (module);
     }
-
-  fp = open (filename, O_CREAT | O_WRONLY | O_TRUNC, 0666);
-  if (fp < 0)
+  if (!values || !make_row)
     {
-      return handle_error (CUBRID_ER_OPEN_FILE, NULL);
+      Py_DECREF (fields);
+      Py_XDECREF (values);
+      Py_XDECREF (make_row);
+      return NULL;
     }
 
-  lob_size = _cubrid_LobObject_cci_lob_size (self);
+  return Py_BuildValue ("(N(NN))", make_row, fields, values);
+}
 
-  while (1)
-    {
-      size =
-        _cubrid_LobObject_cci_read (self, pos, CUBRID_LOB_BUF_SIZE, buf,
-                                    &error);
-      if (size < 0)
-        {
-          close (fp);
-          unlink (filename);
-          return handle_error (size, &error);
-        }
+static char _cubrid_row__doc__[] = "_row(fields, values)\n\
+Return a Row with the column names in the tuple fields and the values\n\
+in the sequence values. Used to unpickle rows.";
 
-      res = write (fp, buf, size);
-      if (res < 0)
-        {
-          close (fp);
-          unlink (filename);
-          return handle_error (CUBRID_ER_WRITE_FILE, NULL);
-        }
+static PyObject *
+_cubrid_row (PyObject * self, PyObject * args)
+{
+  PyObject *fields, *values, *row_type, *row;
 
-      pos += size;
-      if (pos == lob_size)
-        {
-          break;
-        }
+  if (!PyArg_ParseTuple (args, "O!O", &PyTuple_Type, &fields, &values))
+    {
+      return NULL;
     }
 
-  Py_INCREF (Py_None);
-  return Py_None;
+  if (!(row_type = _cubrid_make_row_type (fields)))
+    {
+      return NULL;
+    }
+  row = PyObject_CallFunctionObjArgs (row_type, values, NULL);
+  Py_DECREF (row_type);
+  return row;
 }
 
-static char _cubrid_LobObject_read__doc__[] = "read(len)\n\
-read a chunk of data from the current file position.\n\
-If not given the length, it will read all the remaining data.\n\
-\n\
-Return a string that contains the data read.\n\
-\n\
-Example 1::\n\
-  import _cubrid\n\
-  con = _cubrid.connect('CUBRID:localhost:33000:demodb:::', 'public')\n\
-  lob = con.lob()\n\
-  lob.imports('README', 'C')\n\
-  str = lob.read(32)\n\
-  print str\n\
-  lob.close()\n\
-  con.clsoe()\n\
-\n\
-Example 2::\n\
-  import _cubrid\n\
-  con = _cubrid.connect('CUBRID:localhost:33000:demodb:::', 'public')\n\
-  cur = con.cursor()\n\
-  cur.prepare('select * from test_lob')\n\
-  cur.execute()\n\
-  lob = con.lob()\n\
-  cur.fetch_lob(1, lob)\n\
-  print lob.read(32)\n\
-  lob.close()\n\
-  cur.close()\n\
-  con.close()";
+static PyMethodDef _cubrid_RowObject_methods[] = {
+  {
+   "keys",
+   (PyCFunction) _cubrid_RowObject_keys,
+   METH_VARARGS,
+   _cubrid_RowObject_keys__doc__},
+  {
+   "__reduce__",
+   (PyCFunction) _cubrid_RowObject_reduce,
+   METH_NOARGS,
+   NULL},
+  {NULL, NULL}
+};
+
+static char _cubrid_RowObject__doc__[] = "Row class.\n\
+A tuple of column values that can also be indexed by column name, like\n\
+sqlite3.Row. keys() returns the column names, so dict(row) works.\n\
+The rows of a result share one subclass, holding the column names in\n\
+_fields and the name -> index map in _index.";
+
+PyTypeObject _cubrid_RowObject_type = {
+  PyVarObject_HEAD_INIT (NULL, 0)
+  "_cubrid.Row",                /* tp_name */
+  0,                                /* tp_basicsize, from tuple */
+  0,                                /* tp_itemsize, from tuple */
+  0,                                /* tp_dealloc */
+  0,                                /* tp_print */
+  0,                                /* tp_getattr */
+  0,                                /* tp_setattr */
+  0,                                /* tp_compare */
+  0,                                /* tp_repr */
+  0,                                /* tp_as_number */
+  0,                                /* tp_as_sequence */
+  &_cubrid_RowObject_as_mapping,        /* tp_as_mapping */
+  0,                                /* tp_hash */
+  0,                                /* tp_call */
+  0,                                /* tp_str */
+  0,                                /* tp_getattro */
+  0,                                /* tp_setattro */
+  0,                                /* tp_as_buffer */
+  Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE,        /* tp_flags */
+  _cubrid_RowObject__doc__,        /* tp_doc */
+  0,                                /* tp_traverse */
+  0,                                /* tp_clear */
+  0,                                /* tp_richcompare */
+  0,                                /* tp_weaklistoffset */
+  0,                                /* tp_iter */
+  0,                                /* tp_iternext */
+  _cubrid_RowObject_methods,        /* tp_methods */
+  0,                                /* tp_members */
+  0,                                /* tp_getset */
+  0,                                /* tp_base, set to tuple at init */
+  0,                                /* tp_dict */
+  0,                                /* tp_descr_get */
+  0,                                /* tp_descr_set */
+  0,                                /* tp_dictoffset */
+  0,                                /* tp_init */
+  0,                                /* tp_alloc */
+  0,                                /* tp_new */
+  0,                                /* tp_free */
+};
 
+/*
+ * Convert column i of a lazy row on first access, then keep it. The row is
+ * fetched again by position from the CCI buffer of its cursor, which CCI
+ * fills from the server if it moved on to other rows meanwhile, so this
+ * works as long as the result set of the row is open. Runs in a critical
+ * section on the owner of the cursor.
+ */
 static PyObject *
-_cubrid_LobObject_read (_cubrid_LobObject * self, PyObject * args)
+_cubrid_LazyRowObject_value (_cubrid_LazyRowObject * self, Py_ssize_t i)
 {
-  int res;
-  char *buf;
+  _cubrid_CursorObject *cur = self->cursor;
   T_CCI_ERROR error;
-  PyObject *ret;
-  CUBRID_LONG_LONG size, len = 0;
+  CUBRID_LONG_LONG start;
+  PyObject *value;
+  int res = 0;
 
-  if (!PyArg_ParseTuple (args, "|L", &len))
+  if (self->values[i])
     {
-      return NULL;
+      Py_INCREF (self->values[i]);
+      return self->values[i];
     }
 
-  if (len < 0)
+  if (cur->state == CURSOR_STATE_CLOSED
+      || cur->result_gen != self->result_gen)
     {
-      return handle_error (CUBRID_ER_INVALID_PARAM, NULL);
+      return handle_error (CUBRID_ER_INVALID_CURSOR, NULL);
     }
 
-  if (self->blob == NULL && self->clob == NULL)
-    {
-      return handle_error (CUBRID_ER_LOB_NOT_EXIST, NULL);
-    }
+  start = cur->conn->stats_enabled ? _cubrid_monotonic_ns () : 0;
 
-  if (!len)
+  if (cur->lazy_pos != self->position)
     {
-      size = _cubrid_LobObject_cci_lob_size (self);
-      len = size - self->pos;
+      CUBRID_BEGIN_ALLOW_THREADS (cur->conn);
+      res = cci_cursor (cur->handle, self->position, CCI_CURSOR_FIRST,
+                        &error);
+      if (res >= 0)
+        {
+          res = cci_fetch (cur->handle, &error);
+        }
+      CUBRID_END_ALLOW_THREADS (cur->conn);
+      cur->lazy_pos = res < 0 ? -1 : self->position;
+      if (res < 0)
+        {
+          return handle_error (res, &error);
+        }
     }
 
-  buf = PyMem_Malloc ((int) len);
-  if (!buf)
+  value = _cubrid_CursorObject_col_value (cur, (int) i + 1);
+  if (!value)
     {
-      return handle_error (CUBRID_ER_NO_MORE_MEMORY, NULL);
+      return NULL;
     }
-
-  res = _cubrid_LobObject_cci_read (self, self->pos, (int) len, buf, &error);
-  if (res < 0)
+  if (start)
     {
-      PyMem_Free (buf);
-      return handle_error (res, &error);
+      cur->conn->stats.convert_ns += _cubrid_monotonic_ns () - start;
     }
 
-  self->pos += len;
-
-  ret = PyUnicode_FromStringAndSize (buf, (int) len);
-
-  PyMem_Free (buf);
-  return ret;
+  Py_INCREF (value);
+  self->values[i] = value;
+  return value;
 }
 
-static char _cubrid_LobObject_seek__doc__[] = "seek(offset[, whence])\n\
-move the LOB object current position to the direction LOB object\n\
-according to the mode whence giving.\n\
-The argument whence can be the following values:\n\
- - SEKK_SET: means move the cursor based on the original position,\n\
-   offset must be positive number, the cursor will be moved forward\n\
-   offset units relative to the original position.\n\
- - SEEK_CUR: means move the cursor based on the current position.\n\
-   If offset is positive number, means move the cursor forward offset\n\
-   units. If offset is negative number, means move back offset units.\n\
-   This is the default value.\n\
- - SEEK_END: means move the cursor based on the end position, offset\n\
-   must be positive number, the cursor will be moved back offset units\n\
-   relative to the end position.\n\
-\n\
-Return the current position of the cursor.";
-
 static PyObject *
-_cubrid_LobObject_seek (_cubrid_LobObject * self, PyObject * args)
+_cubrid_LazyRowObject_item (_cubrid_LazyRowObject * self, Py_ssize_t i)
 {
-  int whence = SEEK_CUR;
-  CUBRID_LONG_LONG size, offset;
+  PyObject *value;
 
-  if (!PyArg_ParseTuple (args, "L|i", &offset, &whence))
+  if (i < 0 || i >= Py_SIZE (self))
     {
+      PyErr_SetString (PyExc_IndexError, "row index out of range");
       return NULL;
     }
 
-  if (whence == SEEK_CUR)
-    {
-      self->pos += offset;
-    }
-  else if (whence == SEEK_SET)
-    {
-      self->pos = offset;
-    }
-  else if (whence == SEEK_END)
-    {
-      size = _cubrid_LobObject_cci_lob_size (self);
-      self->pos = size - offset;
-    }
-  else
-    {
-      return handle_error (CUBRID_ER_INVALID_PARAM, NULL);
-    }
-
-  return PyLong_FromLongLong (self->pos);
-}
+  Py_BEGIN_CRITICAL_SECTION (_cubrid_CursorObject_owner (self->cursor));
+  value = _cubrid_LazyRowObject_value (self, i);
+  Py_END_CRITICAL_SECTION ();
 
-static void
-_cubrid_LobObject_dealloc (_cubrid_LobObject * self)
-{
-  _cubrid_LobObject_close (self, NULL);
-  Py_TYPE (self)->tp_free ((PyObject *) self);
+  return value;
 }
 
-static int
-_cubrid_SetObject_init (_cubrid_SetObject * self, PyObject * args,
-                        PyObject * kwargs)
+/* The values of the columns start, start + step, ... as a tuple */
+static PyObject *
+_cubrid_LazyRowObject_slice (_cubrid_LazyRowObject * self, Py_ssize_t start,
+                             Py_ssize_t step, Py_ssize_t count)
 {
-  _cubrid_ConnectionObject *conn;
+  PyObject *values, *value;
+  Py_ssize_t i;
 
-  if (!PyArg_ParseTuple (args, "O!", &_cubrid_ConnectionObject_type, &conn))
+  if (!(values = PyTuple_New (count)))
     {
-      return -1;
+      return NULL;
     }
 
-  self->connection = conn->handle;
-  self->data = NULL;
-  self->type = CCI_U_TYPE_STRING;
+  Py_BEGIN_CRITICAL_SECTION (_cubrid_CursorObject_owner (self->cursor));
+  for (i = 0; i < count; i++)
+    {
+      value = _cubrid_LazyRowObject_value (self, start + i * step);
+      if (!value)
+        {
+          Py_CLEAR (values);
+          break;
+        }
+      PyTuple_SET_ITEM (values, i, value);
+    }
+  Py_END_CRITICAL_SECTION ();
 
-  return 0;
+  return values;
 }
 
 static PyObject *
-_cubrid_SetObject_new (PyTypeObject * type, PyObject * args,
-                       PyObject * kwargs)
+_cubrid_LazyRowObject_tuple (_cubrid_LazyRowObject * self)
 {
-  _cubrid_SetObject *self;
-
-  self = (_cubrid_SetObject *) type->tp_alloc (type, 0);
-  if (!self)
-    {
-      return NULL;
-    }
-
-  return (PyObject *) self;
+  return _cubrid_LazyRowObject_slice (self, 0, 1, Py_SIZE (self));
 }
 
-static void
-_cubrid_SetObject_dealloc (_cubrid_SetObject * self)
+static Py_ssize_t
+_cubrid_LazyRowObject_length (_cubrid_LazyRowObject * self)
 {
-  cci_set_free (self->data);
-  Py_TYPE (self)->tp_free ((PyObject *) self);
+  return Py_SIZE (self);
 }
 
-static char *
-_cubrid_str2bit (char *str)
+static PyObject *
+_cubrid_LazyRowObject_subscript (_cubrid_LazyRowObject * self, PyObject * key)
 {
-  int i = 0, len = 0, t = 0;
-  char *buf = NULL;
-  int shift = 8;
-
-  if (str == NULL)
-    return NULL;
-  len = strlen (str);
-
-  if (0 == len % shift)
-    t = 1;
-
-  buf = (char *) malloc (len / shift + 1 + 1);
-  memset (buf, 0, len / shift + 1 + 1);
+  Py_ssize_t i, start, stop, step;
+  int res;
 
-  for (i = 0; i < len; i++)
+  if (PyUnicode_Check (key))
     {
-      if (str[len - i - 1] == '1')
-        {
-          buf[len / shift - i / shift - t] |= (1 << (i % shift));
-        }
-      else if (str[len - i - 1] == '0')
+      /* On duplicate names, the first column wins */
+      for (i = 0; i < PyTuple_GET_SIZE (self->names); i++)
         {
-          //nothing
+          res = PyUnicode_Compare (PyTuple_GET_ITEM (self->names, i), key);
+          if (res == 0)
+            {
+              return _cubrid_LazyRowObject_item (self, i);
+            }
+          if (res == -1 && PyErr_Occurred ())
+            {
+              return NULL;
+            }
         }
-      else
+      PyErr_SetObject (PyExc_KeyError, key);
+      return NULL;
+    }
+
+  if (PySlice_Check (key))
+    {
+      if (PySlice_Unpack (key, &start, &stop, &step) < 0)
         {
           return NULL;
         }
+      return _cubrid_LazyRowObject_slice (self, start, step,
+                                          PySlice_AdjustIndices (Py_SIZE
+                                                                 (self),
+                                                                 &start,
+                                                                 &stop,
+                                                                 step));
     }
-  return buf;
-}
-
-static PyObject *
-_cubrid_SetObject_import (_cubrid_SetObject * self, PyObject * args)
-{
-  const char **data = NULL, **pointer = NULL;
-  int *indicator = NULL;
-  int i = 0, type, num = 1;
-  T_CCI_SET set;
-  int err_code = 0;
-  char *temp_data_char;
-  T_CCI_BIT *pBit = NULL;
-
-  PyObject *pTube;
-  PyObject *pValue;
 
-  if (!PyArg_ParseTuple (args, "Oi", &pTube, &type))
+  i = PyNumber_AsSsize_t (key, PyExc_IndexError);
+  if (i == -1 && PyErr_Occurred ())
     {
-      return handle_error (CUBRID_ER_INVALID_PARAM, NULL);
+      return NULL;
     }
-
-  if (!PyTuple_Check (pTube))
+  if (i < 0)
     {
-      return handle_error (CUBRID_ER_INVALID_PARAM, NULL);
+      i += Py_SIZE (self);
     }
-  num = PyTuple_GET_SIZE (pTube);
-  data = (const char **) _cubrid_get_data_buf (type, num + 1);
-  pointer = (const char **) _cubrid_get_data_buf (type, num + 1);
-  indicator = (int *) _cubrid_dup_buf (NULL, sizeof (int) * (num + 1));
 
+  return _cubrid_LazyRowObject_item (self, i);
+}
 
-  for (i = 0; i < num; ++i)
-    {
-      pValue = PyTuple_GET_ITEM (pTube, i);
-      pointer[i] = PyUnicode_AsUTF8 (pValue);
+static PyObject *
+_cubrid_LazyRowObject_richcompare (PyObject * self, PyObject * other, int op)
+{
+  PyObject *values, *other_values, *res;
 
-      if (pointer[i] == NULL || (strlen (pointer[i]) == 0))
-        {
-          return handle_error (CUBRID_ER_INVALID_PARAM, NULL);
-        }
+  if (!(values = _cubrid_LazyRowObject_tuple ((_cubrid_LazyRowObject *) self)))
+    {
+      return NULL;
+    }
 
-      if (strcmp (pointer[i], "NULL") == 0)
+  if (PyObject_TypeCheck (other, &_cubrid_LazyRowObject_type))
+    {
+      other_values =
+        _cubrid_LazyRowObject_tuple ((_cubrid_LazyRowObject *) other);
+      if (!other_values)
         {
-          indicator[i] = 1;
+          Py_DECREF (values);
+          return NULL;
         }
     }
+  else
+    {
+      Py_INCREF (other);
+      other_values = other;
+    }
 
+  res = PyObject_RichCompare (values, other_values, op);
+  Py_DECREF (values);
+  Py_DECREF (other_values);
+  return res;
+}
 
-  if (NULL == indicator || NULL == data)
+static Py_hash_t
+_cubrid_LazyRowObject_hash (_cubrid_LazyRowObject * self)
+{
+  PyObject *values;
+  Py_hash_t hash;
+
+  if (!(values = _cubrid_LazyRowObject_tuple (self)))
     {
-      return handle_error (CUBRID_ER_NO_MORE_MEMORY, NULL);
+      return -1;
     }
 
-  switch (type)
+  hash = PyObject_Hash (values);
+  Py_DECREF (values);
+  return hash;
+}
+
+static PyObject *
+_cubrid_LazyRowObject_repr (_cubrid_LazyRowObject * self)
+{
+  PyObject *values, *repr;
+
+  if (!(values = _cubrid_LazyRowObject_tuple (self)))
     {
-    case CCI_U_TYPE_BIT:
-    case CCI_U_TYPE_VARBIT:
-      for (i = 0; i < num; i++)
-        {
-          if (indicator[i] == 1)
-            continue;
-          temp_data_char = _cubrid_str2bit ((char *) pointer[i]);
-          if (temp_data_char == NULL)
-            {
-              goto handle_error;
-            }
-          pBit = (T_CCI_BIT *) data;
-          pBit[i].buf = temp_data_char;
-          pBit[i].size = strlen ((char *) pointer[i]) / 8 + 1;
-        }
-      break;
-    default:
-      err_code =
-        cci_set_make (&set, CCI_U_TYPE_STRING, num, pointer,
-                      (int *) indicator);
-      if (err_code < 0)
-        {
-          goto handle_error;
-        }
-      self->data = set;
-      Py_INCREF (Py_None);
-      free (data);
-      free (indicator);
-      free (pointer);
-      return Py_None;
+      return NULL;
     }
 
-  err_code = cci_set_make (&set, type, num, data, (int *) indicator);
-  if (err_code < 0)
+  repr = PyUnicode_FromFormat ("LazyRow%R", values);
+  Py_DECREF (values);
+  return repr;
+}
+
+static void
+_cubrid_LazyRowObject_dealloc (_cubrid_LazyRowObject * self)
+{
+  Py_ssize_t i;
+
+  for (i = 0; i < Py_SIZE (self); i++)
     {
-      goto handle_error;
+      Py_XDECREF (self->values[i]);
     }
-  self->data = set;
+  Py_DECREF (self->names);
+  Py_DECREF (self->cursor);
+  Py_TYPE (self)->tp_free ((PyObject *) self);
+}
 
-  pBit = (T_CCI_BIT *) data;
-  switch (type)
-    {
-    case CCI_U_TYPE_BIT:
-    case CCI_U_TYPE_VARBIT:
-      for (i = 0; i < num; i++)
-        {
-          if (indicator[i] == 1)
-            continue;
-          if (pBit != NULL && pBit[i].buf != NULL)
-            {
-              free (pBit[i].buf);
-            }
-        }
+static char _cubrid_LazyRowObject_keys__doc__[] = "keys()\n\
+Return a list of the column names of the row.";
+
+static PyObject *
+_cubrid_LazyRowObject_keys (_cubrid_LazyRowObject * self, PyObject * args)
+{
+  if (!PyArg_ParseTuple (args, ""))
+    {
+      return NULL;
     }
 
-  Py_INCREF (Py_None);
-  free (data);
-  free (indicator);
-  free (pointer);
-  return Py_None;
+  return PySequence_List (self->names);
+}
 
-handle_error:
-  free (data);
-  free (indicator);
-  free (pointer);
-  return handle_error (CUBRID_ER_INVALID_PARAM, NULL);
+static char _cubrid_LazyRowObject_values__doc__[] = "values()\n\
+Return the values of all the columns as a tuple, converting those not\n\
+read yet.";
+
+static PyObject *
+_cubrid_LazyRowObject_values (_cubrid_LazyRowObject * self, PyObject * args)
+{
+  if (!PyArg_ParseTuple (args, ""))
+    {
+      return NULL;
+    }
+
+  return _cubrid_LazyRowObject_tuple (self);
 }
 
-static char _cubrid_SetObject_import__doc__[] = "imports(data,type)\n\
-imports LIST/SET/MULTISET data. To use this function.\n\
-data:tuple object\n\
-type:Element type of set,default type:string.\n\
-\n\
-    Example::\n\
-from cubrid_db import FIELD_TYPE\n\
-def one_para():\n\
-    con = cubrid_db.connect('CUBRID:localhost:33000:demodb:::', 'public')\n\
-    c = con.cursor()\n\
-    set_val=(('1','23','48'),)\n\
-    etype = FIELD_TYPE.INT\n\
-    c.execute(\"insert into set_tbl_int VALUES(?)\", set_val,etype)\n\
-    con.commit();\n\
-    c.close()\n\
-    con.close() \n\
-def two_para():\n\
-    con = cubrid_db.connect('CUBRID:localhost:33000:demodb:::', 'public')\n\
-    c = con.cursor()\n\
-    set_val=(('abc','def'),('1','23','48'))\n\
-    etype = (FIELD_TYPE.CHAR,FIELD_TYPE.INT)\n\
-    c.execute('CREATE TABLE set_tbl_char_int ( col_1 set(CHAR(5)),col_2  set(int));')\n\
-    c.execute('insert into set_tbl_int VALUES(?,?)', set_val,etype)\n\
-    c.close()\n\
-    con.close()";
+static PySequenceMethods _cubrid_LazyRowObject_as_sequence = {
+  (lenfunc) _cubrid_LazyRowObject_length,        /* sq_length */
+  0,                                /* sq_concat */
+  0,                                /* sq_repeat */
+  (ssizeargfunc) _cubrid_LazyRowObject_item,        /* sq_item */
+};
 
-static PyMethodDef _cubrid_SetObject_methods[] = {
+static PyMappingMethods _cubrid_LazyRowObject_as_mapping = {
+  (lenfunc) _cubrid_LazyRowObject_length,        /* mp_length */
+  (binaryfunc) _cubrid_LazyRowObject_subscript,        /* mp_subscript */
+  0,                                /* mp_ass_subscript */
+};
+
+static PyMethodDef _cubrid_LazyRowObject_methods[] = {
   {
-   "imports",
-   (PyCFunction) _cubrid_SetObject_import,
+   "keys",
+   (PyCFunction) _cubrid_LazyRowObject_keys,
    METH_VARARGS,
-   _cubrid_SetObject_import__doc__},
+   _cubrid_LazyRowObject_keys__doc__},
+  {
+   "values",
+   (PyCFunction) _cubrid_LazyRowObject_values,
+   METH_VARARGS,
+   _cubrid_LazyRowObject_values__doc__},
   {NULL, NULL}
 };
 
-static char _cubrid_SetObject__doc__[] = "Set class.\n\
-Process Set,MULTISET and LIST/SEQUENCE type\n\
-The class is support by version 9.1.0.0003 and later";
+static char _cubrid_LazyRowObject__doc__[] = "LazyRow class.\n\
+A row that converts each column value on first access and keeps it,\n\
+indexed like _cubrid.Row by position, slice or column name. It compares\n\
+and hashes like the tuple of its values. The row reads its values from\n\
+the result set of its cursor, so the columns not accessed yet can no\n\
+longer be read after the cursor executes again or is closed.";
 
-PyTypeObject _cubrid_SetObject_type = {
+PyTypeObject _cubrid_LazyRowObject_type = {
   PyVarObject_HEAD_INIT (NULL, 0)
-  "_cubrid.cubrid_set",                /* tp_name */
-  sizeof (_cubrid_SetObject),        /* tp_basicsize */
-  0,                                /* tp_itemsize */
-  (destructor) _cubrid_SetObject_dealloc,        /* tp_dealloc */
+  "_cubrid.LazyRow",                /* tp_name */
+  offsetof (_cubrid_LazyRowObject, values),        /* tp_basicsize */
+  sizeof (PyObject *),                /* tp_itemsize */
+  (destructor) _cubrid_LazyRowObject_dealloc,        /* tp_dealloc */
   0,                                /* tp_print */
   0,                                /* tp_getattr */
   0,                                /* tp_setattr */
   0,                                /* tp_compare */
-  0,                                /* tp_repr */
+  (reprfunc) _cubrid_LazyRowObject_repr,        /* tp_repr */
   0,                                /* tp_as_number */
-  0,                                /* tp_as_sequence */
-  0,                                /* tp_as_mapping */
-  0,                                /* tp_hash */
+  &_cubrid_LazyRowObject_as_sequence,        /* tp_as_sequence */
+  &_cubrid_LazyRowObject_as_mapping,        /* tp_as_mapping */
+  (hashfunc) _cubrid_LazyRowObject_hash,        /* tp_hash */
   0,                                /* tp_call */
   0,                                /* tp_str */
   0,                                /* tp_getattro */
   0,                                /* tp_setattro */
   0,                                /* tp_as_buffer */
-  Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE,        /* tp_flags */
-  _cubrid_SetObject__doc__,        /* tp_doc */
+  Py_TPFLAGS_DEFAULT,                /* tp_flags */
+  _cubrid_LazyRowObject__doc__,        /* tp_doc */
   0,                                /* tp_traverse */
   0,                                /* tp_clear */
-  0,                                /* tp_richcompare */
+  _cubrid_LazyRowObject_richcompare,        /* tp_richcompare */
   0,                                /* tp_weaklistoffset */
   0,                                /* tp_iter */
   0,                                /* tp_iternext */
-  _cubrid_SetObject_methods,        /* tp_methods */
-  0,                                /* tp_members */
-  0,                                /* tp_getset */
-  0,                                /* tp_base */
-  0,                                /* tp_dict */
-  0,                                /* tp_descr_get */
-  0,                                /* tp_descr_set */
-  0,                                /* tp_dictoffset */
-  (initproc) _cubrid_SetObject_init,        /* tp_init */
-  0,                                /* tp_alloc */
-  (newfunc) _cubrid_SetObject_new,        /* tp_new */
-  0,                                /* tp_free */
+  _cubrid_LazyRowObject_methods,        /* tp_methods */
 };
 
 static PyMethodDef _cubrid_LobObject_methods[] = {
   {
    "export",
-   (PyCFunction) _cubrid_LobObject_export,
+   (PyCFunction) _cubrid_LobObject_export_locked,
    METH_VARARGS,
    _cubrid_LobObject_export__doc__},
   {
    "imports",
-   (PyCFunction) _cubrid_LobObject_import,
+   (PyCFunction) _cubrid_LobObject_import_locked,
    METH_VARARGS,
    _cubrid_LobObject_import__doc__},
   {
    "write",
-   (PyCFunction) _cubrid_LobObject_write,
+   (PyCFunction) _cubrid_LobObject_write_locked,
    METH_VARARGS,
    _cubrid_LobObject_write__doc__},
   {
    "read",
-   (PyCFunction) _cubrid_LobObject_read,
+   (PyCFunction) _cubrid_LobObject_read_locked,
    METH_VARARGS,
    _cubrid_LobObject_read__doc__},
+  {
+   "readinto",
+   (PyCFunction) _cubrid_LobObject_readinto_locked,
+   METH_VARARGS,
+   _cubrid_LobObject_readinto__doc__},
+  {
+   "size",
+   (PyCFunction) _cubrid_LobObject_size_locked,
+   METH_VARARGS,
+   _cubrid_LobObject_size__doc__},
   {
    "seek",
-   (PyCFunction) _cubrid_LobObject_seek,
+   (PyCFunction) _cubrid_LobObject_seek_locked,
    METH_VARARGS,
    _cubrid_LobObject_seek__doc__},
 
   {
    "close",
-   (PyCFunction) _cubrid_LobObject_close,
+   (PyCFunction) _cubrid_LobObject_close_locked,
    METH_VARARGS,
    _cubrid_LobObject_close__doc__},
   {NULL, NULL}
 };
 
+static PyObject *
+_cubrid_LobObject_get_chunk_size (_cubrid_LobObject * self, void *closure)
+{
+  return PyLong_FromLong (self->chunk_size);
+}
+
+static int
+_cubrid_LobObject_set_chunk_size (_cubrid_LobObject * self, PyObject * value,
+                                  void *closure)
+{
+  long size;
+
+  if (value == NULL)
+    {
+      PyErr_SetString (PyExc_AttributeError, "cannot delete chunk_size");
+      return -1;
+    }
+
+  size = PyLong_AsLong (value);
+  if (size == -1 && PyErr_Occurred ())
+    {
+      return -1;
+    }
+
+  if (size <= 0 || size > INT_MAX)
+    {
+      handle_error (CUBRID_ER_INVALID_PARAM, NULL);
+      return -1;
+    }
+
+  self->chunk_size = (int) size;
+  return 0;
+}
+
+static PyGetSetDef _cubrid_LobObject_getset[] = {
+  {
+   "chunk_size",
+   (getter) _cubrid_LobObject_get_chunk_size,
+   (setter) _cubrid_LobObject_set_chunk_size,
+   "number of bytes transferred per request by imports(), export(),\n\
+read(), readinto() and write()",
+   NULL},
+  {NULL}
+};
+
 static char _cubrid_LobObject__doc__[] = "Lob class.\n\
 Process BLOB/CLOB type";
 
@@ -3967,7 +9311,7 @@ PyTypeObject _cubrid_LobObject_type = {
   0,                                /* tp_iternext */
   _cubrid_LobObject_methods,        /* tp_methods */
   0,                                /* tp_members */
-  0,                                /* tp_getset */
+  _cubrid_LobObject_getset,        /* tp_getset */
   0,                                /* tp_base */
   0,                                /* tp_dict */
   0,                                /* tp_descr_get */
@@ -3982,87 +9326,127 @@ PyTypeObject _cubrid_LobObject_type = {
 static PyMethodDef _cubrid_CursorObject_methods[] = {
   {
    "close",
-   (PyCFunction) _cubrid_CursorObject_close,
+   (PyCFunction) _cubrid_CursorObject_close_locked,
    METH_VARARGS,
    _cubrid_CursorObject_close__doc__},
   {
    "prepare",
-   (PyCFunction) _cubrid_CursorObject_prepare,
+   (PyCFunction) _cubrid_CursorObject_prepare_locked,
    METH_VARARGS,
    _cubrid_CursorObject_prepare__doc__},
   {
    "set_charset",
-   (PyCFunction) _cubrid_CursorObject_set_charset,
+   (PyCFunction) _cubrid_CursorObject_set_charset_locked,
    METH_VARARGS,
    _cubrid_CursorObject_set_charset__doc__},
+  {
+   "set_fetch_size",
+   (PyCFunction) _cubrid_CursorObject_set_fetch_size_locked,
+   METH_VARARGS,
+   _cubrid_CursorObject_set_fetch_size__doc__},
   {
    "bind_param",
-   (PyCFunction) _cubrid_CursorObject_bind_param,
+   (PyCFunction) _cubrid_CursorObject_bind_param_locked,
    METH_VARARGS,
    _cubrid_CursorObject_bind_param__doc__},
+  {
+   "bind_params",
+   (PyCFunction) _cubrid_CursorObject_bind_params_locked,
+   METH_VARARGS,
+   _cubrid_CursorObject_bind_params__doc__},
+  {
+   "bind_param_array",
+   (PyCFunction) _cubrid_CursorObject_bind_param_array_locked,
+   METH_VARARGS,
+   _cubrid_CursorObject_bind_param_array__doc__},
   {
    "bind_lob",
-   (PyCFunction) _cubrid_CursorObject_bind_lob,
+   (PyCFunction) _cubrid_CursorObject_bind_lob_locked,
    METH_VARARGS,
    _cubrid_CursorObject_bind_lob__doc__},
   {
    "bind_set",
-   (PyCFunction) _cubrid_CursorObject_bind_Set,
+   (PyCFunction) _cubrid_CursorObject_bind_Set_locked,
    METH_VARARGS,
    _cubrid_CursorObject_bind_set__doc__},
   {
    "execute",
-   (PyCFunction) _cubrid_CursorObject_execute,
+   (PyCFunction) _cubrid_CursorObject_execute_locked,
    METH_VARARGS,
    _cubrid_CursorObject_execute__doc__},
+  {
+   "execute_array",
+   (PyCFunction) _cubrid_CursorObject_execute_array_locked,
+   METH_VARARGS,
+   _cubrid_CursorObject_execute_array__doc__},
   {
    "affected_rows",
-   (PyCFunction) _cubrid_CursorObject_affected_rows,
+   (PyCFunction) _cubrid_CursorObject_affected_rows_locked,
    METH_VARARGS,
    _cubrid_CursorObject_affected_rows__doc__},
   {
    "fetch_row",
-   (PyCFunction) _cubrid_CursorObject_fetch,
+   (PyCFunction) _cubrid_CursorObject_fetch_locked,
    METH_VARARGS,
    _cubrid_CursorObject_fetch__doc__},
+  {
+   "fetch_many",
+   (PyCFunction) _cubrid_CursorObject_fetch_many_locked,
+   METH_VARARGS,
+   _cubrid_CursorObject_fetch_many__doc__},
+  {
+   "fetch_all",
+   (PyCFunction) _cubrid_CursorObject_fetch_all_locked,
+   METH_VARARGS,
+   _cubrid_CursorObject_fetch_all__doc__},
+  {
+   "fetch_block",
+   (PyCFunction) _cubrid_CursorObject_fetch_block_locked,
+   METH_VARARGS,
+   _cubrid_CursorObject_fetch_block__doc__},
+  {
+   "fetch_columns",
+   (PyCFunction) _cubrid_CursorObject_fetch_columns_locked,
+   METH_VARARGS,
+   _cubrid_CursorObject_fetch_columns__doc__},
   {
    "fetch_lob",
-   (PyCFunction) _cubrid_CursorObject_fetch_lob,
+   (PyCFunction) _cubrid_CursorObject_fetch_lob_locked,
    METH_VARARGS,
    _cubrid_CursorObject_fetch_lob__doc__},
   {
    "data_seek",
-   (PyCFunction) _cubrid_CursorObject_data_seek,
+   (PyCFunction) _cubrid_CursorObject_data_seek_locked,
    METH_VARARGS,
    _cubrid_CursorObject_data_seek__doc__},
   {
    "num_fields",
-   (PyCFunction) _cubrid_CursorObject_num_fields,
+   (PyCFunction) _cubrid_CursorObject_num_fields_locked,
    METH_VARARGS,
    _cubrid_CursorObject_num_fields__doc__},
   {
    "num_rows",
-   (PyCFunction) _cubrid_CursorObject_num_rows,
+   (PyCFunction) _cubrid_CursorObject_num_rows_locked,
    METH_VARARGS,
    _cubrid_CursorObject_num_rows__doc__},
   {
    "row_tell",
-   (PyCFunction) _cubrid_CursorObject_row_tell,
+   (PyCFunction) _cubrid_CursorObject_row_tell_locked,
    METH_VARARGS,
    _cubrid_CursorObject_row_tell__doc__},
   {
    "row_seek",
-   (PyCFunction) _cubrid_CursorObject_row_seek,
+   (PyCFunction) _cubrid_CursorObject_row_seek_locked,
    METH_VARARGS,
    _cubrid_CursorObject_row_seek__doc__},
   {
    "result_info",
-   (PyCFunction) _cubrid_CursorObject_result_info,
+   (PyCFunction) _cubrid_CursorObject_result_info_locked,
    METH_VARARGS,
    _cubrid_CursorObject_result_info__doc__},
   {
    "next_result",
-   (PyCFunction) _cubrid_CursorObject_next_result,
+   (PyCFunction) _cubrid_CursorObject_next_result_locked,
    METH_VARARGS,
    _cubrid_CursorObject_next_result__doc__},
   {NULL, NULL}
@@ -4071,77 +9455,112 @@ static PyMethodDef _cubrid_CursorObject_methods[] = {
 static PyMethodDef _cubrid_ConnectionObject_methods[] = {
   {
    "close",
-   (PyCFunction) _cubrid_ConnectionObject_close,
+   (PyCFunction) _cubrid_ConnectionObject_close_locked,
    METH_VARARGS,
    _cubrid_ConnectionObject_close__doc__},
   {
    "cursor",
-   (PyCFunction) _cubrid_ConnectionObject_cursor,
+   (PyCFunction) _cubrid_ConnectionObject_cursor_locked,
    METH_VARARGS,
    _cubrid_ConnectionObject_cursor__doc__},
   {
    "lob",
-   (PyCFunction) _cubrid_ConnectionObject_lob,
+   (PyCFunction) _cubrid_ConnectionObject_lob_locked,
    METH_VARARGS,
    _cubrid_ConnectionObject_lob__doc__},
   {
    "set",
-   (PyCFunction) _cubrid_ConnectionObject_set,
+   (PyCFunction) _cubrid_ConnectionObject_set_locked,
    METH_VARARGS,
    _cubrid_ConnectionObject_set__doc__},
   {
    "commit",
-   (PyCFunction) _cubrid_ConnectionObject_commit,
+   (PyCFunction) _cubrid_ConnectionObject_commit_locked,
    METH_VARARGS,
    _cubrid_ConnectionObject_commit__doc__},
   {
    "rollback",
-   (PyCFunction) _cubrid_ConnectionObject_rollback,
+   (PyCFunction) _cubrid_ConnectionObject_rollback_locked,
    METH_VARARGS,
    _cubrid_ConnectionObject_rollback__doc__},
+  {
+   "stmt_cache_clear",
+   (PyCFunction) _cubrid_ConnectionObject_stmt_cache_clear_locked,
+   METH_VARARGS,
+   _cubrid_ConnectionObject_stmt_cache_clear__doc__},
+  {
+   "stats",
+   (PyCFunction) _cubrid_ConnectionObject_stats_locked,
+   METH_VARARGS,
+   _cubrid_ConnectionObject_stats__doc__},
+  {
+   "reset_stats",
+   (PyCFunction) _cubrid_ConnectionObject_reset_stats_locked,
+   METH_VARARGS,
+   _cubrid_ConnectionObject_reset_stats__doc__},
+  {
+   "set_trace_callback",
+   (PyCFunction) _cubrid_ConnectionObject_set_trace_callback_locked,
+   METH_VARARGS,
+   _cubrid_ConnectionObject_set_trace_callback__doc__},
+  {
+   "set_meta_cache",
+   (PyCFunction) _cubrid_ConnectionObject_set_meta_cache_locked,
+   METH_VARARGS,
+   _cubrid_ConnectionObject_set_meta_cache__doc__},
+  {
+   "meta_cache_clear",
+   (PyCFunction) _cubrid_ConnectionObject_meta_cache_clear_locked,
+   METH_VARARGS,
+   _cubrid_ConnectionObject_meta_cache_clear__doc__},
+  {
+   "cancel",
+   (PyCFunction) _cubrid_ConnectionObject_cancel,
+   METH_VARARGS,
+   _cubrid_ConnectionObject_cancel__doc__},
   {
    "ping",
-   (PyCFunction) _cubrid_ConnectionObject_ping,
+   (PyCFunction) _cubrid_ConnectionObject_ping_locked,
    METH_VARARGS,
    _cubrid_ConnectionObject_ping__doc__},
   {
    "server_version",
-   (PyCFunction) _cubrid_ConnectionObject_server_version,
+   (PyCFunction) _cubrid_ConnectionObject_server_version_locked,
    METH_VARARGS,
    _cubrid_ConnectionObject_server_version__doc__},
   {
    "client_version",
-   (PyCFunction) _cubrid_ConnectionObject_client_version,
+   (PyCFunction) _cubrid_ConnectionObject_client_version_locked,
    METH_VARARGS,
    _cubrid_ConnectionObject_client_version__doc__},
   {
    "set_autocommit",
-   (PyCFunction) _cubrid_ConnectionObject_set_autocommit,
+   (PyCFunction) _cubrid_ConnectionObject_set_autocommit_locked,
    METH_VARARGS,
    _cubrid_ConnectionObject_set_autocommit__doc__},
   {
    "set_isolation_level",
-   (PyCFunction) _cubrid_ConnectionObject_set_isolation_level,
+   (PyCFunction) _cubrid_ConnectionObject_set_isolation_level_locked,
    METH_VARARGS,
    _cubrid_ConnectionObject_set_isolation_level__doc__},
   {
    "insert_id",
-   (PyCFunction) _cubrid_ConnectionObject_last_insert_id,
+   (PyCFunction) _cubrid_ConnectionObject_last_insert_id_locked,
    METH_VARARGS,
    _cubrid_ConnectionObject_last_insert_id__doc__},
   {
    "schema_info",
-   (PyCFunction) _cubrid_ConnectionObject_schema_info,
+   (PyCFunction) _cubrid_ConnectionObject_schema_info_locked,
    METH_VARARGS,
    _cubrid_ConnectionObject_schema_info__doc__},
   {
    "escape_string",
-   (PyCFunction) _cubrid_ConnectionObject_escape_string,
+   (PyCFunction) _cubrid_ConnectionObject_escape_string_locked,
    METH_VARARGS,
    _cubrid_ConnectionObject_escape_string__doc__},
   {
    "batch_execute",
-   (PyCFunction) _cubrid_ConnectionObject_batch_execute,
+   (PyCFunction) _cubrid_ConnectionObject_batch_execute_locked,
    METH_VARARGS,
    _cubrid_ConnectionObject_batch_execute__doc__},
   {NULL, NULL}
@@ -4177,6 +9596,60 @@ static struct PyMemberDef _cubrid_ConnectionObject_members[] = {
    offsetof (_cubrid_ConnectionObject, lock_timeout),
    0,
    "lock time out"},
+  {
+   "fetch_size",
+   T_INT,
+   offsetof (_cubrid_ConnectionObject, fetch_size),
+   0,
+   "default fetch size of new cursors"},
+  {
+   "stmt_cache_size",
+   T_INT,
+   offsetof (_cubrid_ConnectionObject, stmt_cache_size),
+   0,
+   "number of idle prepared statements kept for reuse, 0 disables it"},
+  {
+   "stats_enabled",
+   T_INT,
+   offsetof (_cubrid_ConnectionObject, stats_enabled),
+   0,
+   "collect the client-side metrics returned by stats()"},
+  {
+   "native_collections",
+   T_INT,
+   offsetof (_cubrid_ConnectionObject, native_collections),
+   0,
+   "decode SET/MULTISET/SEQUENCE elements to their Python type, not str"},
+  {
+   "stmt_cache_hits",
+   T_LONG,
+   offsetof (_cubrid_ConnectionObject, stmt_cache_hits),
+   READONLY,
+   "prepares served from the statement cache"},
+  {
+   "stmt_cache_misses",
+   T_LONG,
+   offsetof (_cubrid_ConnectionObject, stmt_cache_misses),
+   READONLY,
+   "prepares not found in the statement cache"},
+  {
+   "meta_cache_ttl",
+   T_DOUBLE,
+   offsetof (_cubrid_ConnectionObject, meta_cache_ttl),
+   0,
+   "seconds schema_info() results and descriptions are cached, 0 disables it"},
+  {
+   "meta_cache_hits",
+   T_LONG,
+   offsetof (_cubrid_ConnectionObject, meta_cache_hits),
+   READONLY,
+   "lookups served from the metadata cache"},
+  {
+   "meta_cache_misses",
+   T_LONG,
+   offsetof (_cubrid_ConnectionObject, meta_cache_misses),
+   READONLY,
+   "lookups not found in the metadata cache"},
   {NULL}
 };
 
@@ -4206,19 +9679,109 @@ _cubrid_CursorObject_repr (_cubrid_CursorObject * self)
   return PyUnicode_FromString (buf);
 }
 
-static struct PyMemberDef _cubrid_CursorObject_members[] = {
+/* Build the description, or take the one cached for the statement text */
+static int
+_cubrid_CursorObject_load_description (_cubrid_CursorObject * self)
+{
+  if (self->query
+      && (self->description = _cubrid_meta_cache_get (self->conn, self->query)))
+    {
+      return 0;
+    }
+  if (_cubrid_CursorObject_set_description (self) < 0)
+    {
+      return -1;
+    }
+  if (self->query && self->description)
+    {
+      _cubrid_meta_cache_put (self->conn, self->query, self->description);
+    }
+
+  return 0;
+}
+
+static PyObject *
+_cubrid_CursorObject_get_description (_cubrid_CursorObject * self,
+                                      void *closure)
+{
+  PyObject *description = Py_None;
+
+  Py_BEGIN_CRITICAL_SECTION (_cubrid_CursorObject_owner (self));
+  if (self->state != CURSOR_STATE_CLOSED && self->handle
+      && self->sql_type == SQLX_CMD_SELECT
+      && self->desc_handle == self->handle)
+    {
+      if (!self->description
+          && _cubrid_CursorObject_load_description (self) < 0)
+        {
+          description = NULL;
+        }
+      else
+        {
+          description = self->description;
+        }
+    }
+  Py_XINCREF (description);
+  Py_END_CRITICAL_SECTION ();
+
+  return description;
+}
+
+static PyGetSetDef _cubrid_CursorObject_getset[] = {
   {
    "description",
-   T_OBJECT,
-   offsetof (_cubrid_CursorObject, description),
-   0,
-   "description"},
+   (getter) _cubrid_CursorObject_get_description,
+   NULL,
+   "a tuple with a DB API 7-item sequence for each result column, or\n\
+None; it is built on first access and reused while the cursor executes\n\
+the same statement. Read-only, cubrid_db cursors can override it",
+   NULL},
+  {NULL}
+};
+
+static struct PyMemberDef _cubrid_CursorObject_members[] = {
   {
    "rowcount",
    T_INT,
    offsetof (_cubrid_CursorObject, row_count),
    0,
    "row count"},
+  {
+   "fetch_size",
+   T_INT,
+   offsetof (_cubrid_CursorObject, fetch_size),
+   READONLY,
+   "rows per fetch packet"},
+  {
+   "intern_strings",
+   T_INT,
+   offsetof (_cubrid_CursorObject, intern_strings),
+   0,
+   "intern fetched strings of up to 64 bytes"},
+  {
+   "epoch_datetimes",
+   T_INT,
+   offsetof (_cubrid_CursorObject, epoch_datetimes),
+   0,
+   "fetch datetime and timestamp values as int microseconds since the epoch"},
+  {
+   "query_timeout",
+   T_INT,
+   offsetof (_cubrid_CursorObject, query_timeout),
+   0,
+   "execution timeout in milliseconds, 0 for none, -1 for the connection default"},
+  {
+   "allocs",
+   T_LONG,
+   offsetof (_cubrid_CursorObject, allocs),
+   READONLY,
+   "driver heap allocations of the calls of the cursor for its last execute"},
+  {
+   "arena_cap",
+   T_PYSSIZET,
+   offsetof (_cubrid_CursorObject, arena.cap),
+   0,
+   "bytes of bind buffer memory kept between executes"},
   {NULL}
 };
 
@@ -4233,6 +9796,11 @@ static struct PyMethodDef _cubrid_methods[] = {
    (PyCFunction) _cubrid_escape_string,
    METH_VARARGS | METH_KEYWORDS,
    _cubrid_escape_string__doc__},
+  {
+   "_row",
+   (PyCFunction) _cubrid_row,
+   METH_VARARGS,
+   _cubrid_row__doc__},
   {NULL, NULL}
 };
 
@@ -4308,7 +9876,7 @@ PyTypeObject _cubrid_CursorObject_type = {
   0,                                /* tp_iternext */
   _cubrid_CursorObject_methods,        /* tp_methods */
   _cubrid_CursorObject_members,        /* tp_members */
-  0,                                /* tp_getset */
+  _cubrid_CursorObject_getset,        /* tp_getset */
   0,                                /* tp_base */
   0,                                /* tp_dict */
   0,                                /* tp_descr_get */
@@ -4356,6 +9924,7 @@ static struct PyModuleDef cubriddef = {
  *     |__DatabaseError
  *        |__DataError
  *        |__OperationalError
+ *        |  |__QueryCanceledError
  *        |__IntegrityError
  *        |__InternalError
  *        |__ProgrammingError
@@ -4385,6 +9954,12 @@ init_exceptions (PyObject * dict)
                         NULL);
   PyDict_SetItemString (dict, "OperationalError", _cubrid_operational_error);
 
+  _cubrid_query_canceled_error =
+    PyErr_NewException ("_cubrid.QueryCanceledError",
+                        _cubrid_operational_error, NULL);
+  PyDict_SetItemString (dict, "QueryCanceledError",
+                        _cubrid_query_canceled_error);
+
   _cubrid_integrity_error =
     PyErr_NewException ("_cubrid.IntegrityError", _cubrid_database_error,
                         NULL);
@@ -4525,9 +10100,17 @@ all_ins (PyObject * d)
 PyObject *
 PyInit__cubrid (void)
 {
-  PyObject *dict, *module;
+  PyObject *dict, *module, *tmp;
 
   module = PyModule_Create (&cubriddef);
+  if (module == NULL)
+    {
+      return NULL;
+    }
+#ifdef Py_GIL_DISABLED
+  /* State shared between threads is guarded, see python_cubrid.h */
+  PyUnstable_Module_SetGIL (module, Py_MOD_GIL_NOT_USED);
+#endif
 
   if (!(dict = PyModule_GetDict (module)))
     {
@@ -4588,6 +10171,40 @@ PyInit__cubrid (void)
       goto Error;
     }
 
+  _cubrid_RowObject_type.tp_base = &PyTuple_Type;
+  if (PyType_Ready (&_cubrid_RowObject_type) < 0)
+    {
+      goto Error;
+    }
+  if (!_cubrid_row_types && !(_cubrid_row_types = PyDict_New ()))
+    {
+      goto Error;
+    }
+
+  Py_INCREF (&_cubrid_RowObject_type);
+  if (PyModule_AddObject
+      (module, "Row", (PyObject *) & _cubrid_RowObject_type) < 0)
+    {
+      goto Error;
+    }
+
+  if (PyType_Ready (&_cubrid_LazyRowObject_type) < 0)
+    {
+      goto Error;
+    }
+
+  Py_INCREF (&_cubrid_LazyRowObject_type);
+  if (PyModule_AddObject
+      (module, "LazyRow", (PyObject *) & _cubrid_LazyRowObject_type) < 0)
+    {
+      goto Error;
+    }
+
+  if (!(_cubrid_row_index_key = PyUnicode_InternFromString ("_index")))
+    {
+      goto Error;
+    }
+
   if (import_decimal_type() != 0)
     {
       goto Error;
@@ -4595,6 +10212,28 @@ PyInit__cubrid (void)
 
   /* invoke PyDateTime_IMPORT macro to use functions from datetime.h */
   PyDateTime_IMPORT;
+  if (PyDateTimeAPI == NULL)
+    {
+      goto Error;
+    }
+
+  if (!(_cubrid_tzinfo_cache = PyDict_New ()))
+    {
+      goto Error;
+    }
+
+  /* Resolved once here, so the fetch paths never import (3.9+) */
+  if ((tmp = PyImport_ImportModule ("zoneinfo")) != NULL)
+    {
+      _cubrid_zoneinfo = PyObject_GetAttrString (tmp, "ZoneInfo");
+      Py_DECREF (tmp);
+    }
+  if (_cubrid_zoneinfo == NULL)
+    {
+      PyErr_Clear ();
+      Py_INCREF (Py_None);
+      _cubrid_zoneinfo = Py_None;
+    }
 
   return module;
 
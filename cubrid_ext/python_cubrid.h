@@ -26,6 +26,7 @@
 #define CUBRID_ER_WRITE_FILE                -30017
 #define CUBRID_ER_LOB_NOT_EXIST             -30018
 #define CUBRID_ER_INVALID_CURSOR            -30019
+#define CUBRID_ER_QUERY_CANCELED            -30020
 #define CUBRID_ER_END                       -31000
 
 #define CUBRID_EXEC_ASYNC           CCI_EXEC_ASYNC
@@ -46,6 +47,33 @@
 #define FLT_MIN_STR         "1.175494351e-38F"        /* min positive value */
 
 
+/*
+ * Blocking CCI calls are made with the GIL released, so that other Python
+ * threads keep running while this one waits on the broker. The connection
+ * lock serializes threads sharing one connection, as the GIL used to.
+ * Nothing between the two macros may touch Python objects.
+ */
+#define CUBRID_BEGIN_ALLOW_THREADS(con) \
+  Py_BEGIN_ALLOW_THREADS \
+  PyThread_acquire_lock ((con)->lock, WAIT_LOCK)
+
+#define CUBRID_END_ALLOW_THREADS(con) \
+  PyThread_release_lock ((con)->lock); \
+  Py_END_ALLOW_THREADS
+
+/*
+ * The free-threaded build (3.13t) has no GIL to keep the state of a
+ * connection consistent, so its methods, and those of its cursors and
+ * lobs, run in a critical section on the connection object. Like the
+ * GIL, it is suspended while a thread waits in a CCI call, and the
+ * connection lock above still serializes the calls. Before 3.13 the GIL
+ * is the critical section.
+ */
+#ifndef Py_BEGIN_CRITICAL_SECTION
+#define Py_BEGIN_CRITICAL_SECTION(op) {
+#define Py_END_CRITICAL_SECTION() }
+#endif
+
 #ifdef MS_WINDOWS
 #define CUBRID_LONG_LONG _int64
 #else
@@ -58,10 +86,45 @@ typedef enum
   CURSOR_STATE_OPENED
 } CURSOR_STATE;
 
+/* Client-side counters of a connection, see connection.stats() */
+typedef struct
+{
+  CUBRID_LONG_LONG prepare_count;
+  CUBRID_LONG_LONG prepare_ns;
+  CUBRID_LONG_LONG execute_count;
+  CUBRID_LONG_LONG execute_ns;
+  CUBRID_LONG_LONG fetch_calls;
+  CUBRID_LONG_LONG fetch_ns;
+  CUBRID_LONG_LONG convert_ns;
+  CUBRID_LONG_LONG rows_fetched;
+  CUBRID_LONG_LONG bytes_converted;
+  CUBRID_LONG_LONG bind_count;
+} _cubrid_Stats;
+
+/*
+ * Bump allocator for the bind and conversion buffers that only live until
+ * the next execute, see _cubrid_arena_alloc(). blocks is the list of heap
+ * blocks, the one allocated from first; cap bounds the memory kept when
+ * the arena is reset.
+ */
+typedef struct _cubrid_ArenaBlock
+{
+  struct _cubrid_ArenaBlock *next;
+  size_t size;
+  size_t used;
+} _cubrid_ArenaBlock;
+
+typedef struct
+{
+  _cubrid_ArenaBlock *blocks;
+  Py_ssize_t cap;
+} _cubrid_Arena;
+
 typedef struct
 {
   PyObject_HEAD
   int handle;
+  PyThread_type_lock lock;
   char *url;
   char *user;
   char *passwd;
@@ -69,6 +132,27 @@ typedef struct
   PyObject *isolation_level;
   PyObject *max_string_len;
   PyObject *lock_timeout;
+  int fetch_size;
+  PyObject *stmt_cache;
+  int stmt_cache_size;
+  int stmt_cache_gen;
+  long stmt_cache_hits;
+  long stmt_cache_misses;
+  int stats_enabled;
+  int native_collections;
+  PyThread_type_lock cancel_lock;
+  long exec_gen;
+  long running_gen;
+  long cancel_gen;
+  int query_timeout_default;
+  _cubrid_Arena arena;
+  int arena_busy;
+  PyObject *meta_cache;
+  double meta_cache_ttl;
+  long meta_cache_hits;
+  long meta_cache_misses;
+  _cubrid_Stats stats;
+  PyObject *trace_callback;
 } _cubrid_ConnectionObject;
 
 typedef struct
@@ -77,24 +161,65 @@ typedef struct
   CURSOR_STATE state;
   int handle;
   int connection;
+  _cubrid_ConnectionObject *conn;
   int col_count;
   int row_count;
   int bind_num;
   int cursor_pos;
+  int row_pos;
+  int lazy_pos;
+  int result_gen;
+  int fetch_size;
+  int array_size;
+  PyObject *array_binds;
+  _cubrid_Arena arena;
+  long allocs;
+  long allocs_pending;
+  PyObject *sql;
+  int stmt_cache_gen;
   char charset[128];
+  int utf8;
+  PyObject *decoder;
+  int intern_strings;
+  int epoch_datetimes;
+  int query_timeout;
   T_CCI_CUBRID_STMT sql_type;
   T_CCI_COL_INFO *col_info;
   PyObject *description;
+  int desc_handle;
+  int desc_gen;
+  T_CCI_COL_INFO *desc_col_info;
+  PyObject *desc_sql;
+  PyObject *col_names;
+  PyObject *row_type;
+  PyObject *query;
 } _cubrid_CursorObject;
 
+/*
+ * A row of a result that converts each column on first access. position
+ * is the row of the cursor's result set it reads, result_gen the result
+ * set it belongs to; values holds the columns converted so far.
+ */
+typedef struct
+{
+  PyObject_VAR_HEAD
+  _cubrid_CursorObject *cursor;
+  PyObject *names;
+  int position;
+  int result_gen;
+  PyObject *values[1];
+} _cubrid_LazyRowObject;
+
 typedef struct
 {
   PyObject_HEAD
   int connection;
+  _cubrid_ConnectionObject *conn;
   T_CCI_BLOB blob;
   T_CCI_CLOB clob;
   char type;
   CUBRID_LONG_LONG pos;
+  int chunk_size;
 } _cubrid_LobObject;
 
 typedef struct
@@ -104,6 +229,7 @@ typedef struct
   T_CCI_SET data;
   char type;
   CUBRID_LONG_LONG pos;
+  long allocs;
 } _cubrid_SetObject;
 
 
@@ -111,6 +237,8 @@ extern PyTypeObject _cubrid_ConnectionObject_type;
 extern PyTypeObject _cubrid_CursorObject_type;
 extern PyTypeObject _cubrid_LobObject_type;
 extern PyTypeObject _cubrid_SetObject_type;
+extern PyTypeObject _cubrid_RowObject_type;
+extern PyTypeObject _cubrid_LazyRowObject_type;
 
 extern int ut_str_to_bigint (char *str, CUBRID_LONG_LONG * value);
 extern int ut_str_to_int (char *str, int *value);
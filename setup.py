@@ -2,6 +2,7 @@
 
 import os
 import platform
+import shutil
 import subprocess
 import sys
 
@@ -38,6 +39,44 @@ def get_platform():
 
 OS_TYPE, ARCH_TYPE = get_platform()
 
+# Optimized builds, set with CUBRID_DB_OPTIMIZE (GCC only):
+#   lto          -- CCI and the extension are linked as one LTO unit
+#   pgo-generate -- lto, instrumented to write a profile when run
+#   pgo-use      -- lto, optimized with the profile of a pgo-generate build
+# The profile is kept in CUBRID_DB_PROFILE_DIR, see benchmarks/pgo_build.sh.
+OPTIMIZE_MODES = ('', 'lto', 'pgo-generate', 'pgo-use')
+
+
+def has_profile(profile_dir):
+    """Tell if a pgo-generate build wrote profile data in profile_dir."""
+    for _, _, files in os.walk(profile_dir):
+        if any(name.endswith('.gcda') for name in files):
+            return True
+    return False
+
+
+def get_optimize_flags(mode, profile_dir):
+    """Return the compile and link flags of an optimized build mode."""
+    if mode not in OPTIMIZE_MODES:
+        raise ValueError(f'Unknown CUBRID_DB_OPTIMIZE mode: "{mode}"')
+    if not mode:
+        return [], []
+
+    compile_flags = ['-O3', '-flto=auto', '-ffat-lto-objects']
+    link_flags = ['-O3', '-flto=auto']
+    if mode == 'pgo-generate':
+        pgo_flags = [f'-fprofile-generate={profile_dir}', '-fprofile-update=atomic']
+        compile_flags += pgo_flags
+        link_flags += pgo_flags
+    elif mode == 'pgo-use':
+        if not has_profile(profile_dir):
+            print(f'No PGO profile in {profile_dir}, building with lto only')
+            return compile_flags, link_flags
+        pgo_flags = [f'-fprofile-use={profile_dir}', '-fprofile-correction']
+        compile_flags += pgo_flags
+        link_flags += pgo_flags
+    return compile_flags, link_flags
+
 
 cwd = os.getcwd()
 script_dir = get_script_dir()
@@ -45,6 +84,15 @@ cci_dir = os.path.join(script_dir, "cci-src")
 print ('script directory:', script_dir)
 print ('CCI directory:', cci_dir)
 
+optimize_mode = os.environ.get('CUBRID_DB_OPTIMIZE', '').strip().lower()
+profile_dir = os.path.abspath(os.environ.get('CUBRID_DB_PROFILE_DIR',
+                                             os.path.join(script_dir, 'build', 'pgo')))
+if optimize_mode and OS_TYPE == 'Windows':
+    print(f'CUBRID_DB_OPTIMIZE={optimize_mode} is ignored: it needs GCC')
+    optimize_mode = ''
+opt_compile_flags, opt_link_flags = get_optimize_flags(optimize_mode, profile_dir)
+print('optimized build:', optimize_mode or 'no')
+
 
 if OS_TYPE == 'Windows':
     VCOMTOOLS_ENV = 'VS140COMNTOOLS'
@@ -103,19 +151,44 @@ if OS_TYPE == 'Windows':
         raise FileNotFoundError(f"CCI static lib not found at {cci_static_lib}")
 
 else:
+    cci_build_dir = os.path.join(cci_dir, 'build_x86_64_release')
+    cci_flags_stamp = os.path.join(cci_build_dir, '.cubrid_db_flags')
+
+    # CMake keeps the flags of the first configuration: start over when
+    # the optimize mode changed since the last CCI build
+    cci_flags = ' '.join(opt_compile_flags)
+    old_cci_flags = ''
+    if os.path.isfile(cci_flags_stamp):
+        with open(cci_flags_stamp, 'r', encoding='utf-8') as stamp_file:
+            old_cci_flags = stamp_file.read().strip()
+    if old_cci_flags != cci_flags and os.path.isdir(cci_build_dir):
+        print('CCI build flags changed, removing', cci_build_dir)
+        shutil.rmtree(cci_build_dir)
+
+    cci_env = dict(os.environ)
+    if optimize_mode:
+        for var, flags in (('CFLAGS', opt_compile_flags),
+                           ('CXXFLAGS', opt_compile_flags),
+                           ('LDFLAGS', opt_link_flags)):
+            cci_env[var] = ' '.join([cci_env.get(var, '')] + flags).strip()
+
     # Build CCI
     os.chdir(cci_dir)
     try:
-        result = subprocess.run(['bash', "build.sh"], check=True)
+        result = subprocess.run(['bash', "build.sh"], check=True, env=cci_env)
         print("CCI build script executed successfully")
     except subprocess.CalledProcessError as e:
         raise RuntimeError(f"Error in CCI build script execution: {e}") from e
     finally:
         os.chdir(cwd)
 
+    if os.path.isdir(cci_build_dir):
+        with open(cci_flags_stamp, 'w', encoding='utf-8') as stamp_file:
+            stamp_file.write(cci_flags)
+
     inc_dir_base = os.path.join(cci_dir, "src/base")
     inc_dir_cci = os.path.join(cci_dir, "src/cci")
-    cci_static_lib = os.path.join(cci_dir, 'build_x86_64_release/cci/libcascci.a')
+    cci_static_lib = os.path.join(cci_build_dir, 'cci/libcascci.a')
     openssl_lib = os.path.join(cci_dir, 'external/openssl/lib')
     ssl_static_lib = os.path.join(openssl_lib, 'libssl.a')
     crypto_static_lib = os.path.join(openssl_lib, 'libcrypto.a')
@@ -131,6 +204,8 @@ else:
                 include_dirs=[inc_dir_base, inc_dir_cci],
                 sources=['cubrid_ext/python_cubrid.c'],
                 libraries=["pthread", "stdc++"],
+                extra_compile_args=opt_compile_flags,
+                extra_link_args=opt_link_flags,
                 extra_objects=[
                     cci_static_lib,
                     ssl_static_lib,
@@ -164,10 +239,15 @@ setup(
     long_description=readme,
     long_description_content_type='text/markdown',
     py_modules=[
+        "cubrid_db.aio",
+        "cubrid_db.bulk",
         "cubrid_db.connections",
         "cubrid_db.cursors",
         "cubrid_db.exceptions",
         "cubrid_db.field_type",
+        "cubrid_db.lob",
+        "cubrid_db.parallel",
+        "cubrid_db.pool",
     ],
     author="Casian Andrei",
     author_email="casian@zco.ro",
@@ -0,0 +1,126 @@
+# pylint: disable=missing-function-docstring,missing-module-docstring
+import asyncio
+import time
+from concurrent.futures import ThreadPoolExecutor
+
+from conftest import (
+    TABLE_PREFIX,
+    _get_connect_args,
+)
+
+from cubrid_db import aio
+
+
+def _run(coro):
+    loop = asyncio.new_event_loop()
+    try:
+        return loop.run_until_complete(coro)
+    finally:
+        loop.close()
+
+
+def test_aio_execute_fetch():
+    async def main():
+        async with await aio.connect(**_get_connect_args()) as con:
+            async with con.cursor() as cur:
+                await cur.execute('select 1 + 1 from db_root')
+                assert cur.description is not None
+                return await cur.fetchone()
+
+    assert _run(main()) == (2,)
+
+
+def test_aio_iteration_and_fetchmany():
+    table_name = f'{TABLE_PREFIX}aio'
+
+    async def main():
+        con = await aio.connect(**_get_connect_args())
+        cur = con.cursor()
+        await cur.execute(f'drop table if exists {table_name}')
+        await cur.execute(f'create table {table_name} (a int)')
+        try:
+            await cur.executemany(f'insert into {table_name} values (?)',
+                                  [(i,) for i in range(25)])
+            await cur.execute(f'select a from {table_name} order by a')
+            cur.iter_batch_size = 10
+            first = []
+            async for row in cur:
+                first.append(row[0])
+                if len(first) == 3:
+                    break
+            # The rest of the iteration batch is not lost
+            many = await cur.fetchmany(5)
+            rest = await cur.fetchall()
+            return first, many, rest
+        finally:
+            await cur.execute(f'drop table if exists {table_name}')
+            await cur.close()
+            await con.close()
+
+    first, many, rest = _run(main())
+    assert first == [0, 1, 2]
+    assert many == [(i,) for i in range(3, 8)]
+    assert rest == [(i,) for i in range(8, 25)]
+
+
+def test_aio_concurrent_connections():
+    count = 4
+
+    async def one():
+        con = await aio.connect(**_get_connect_args())
+        cur = con.cursor()
+        await cur.execute('select sleep(1)')
+        await cur.fetchall()
+        await cur.close()
+        await con.close()
+
+    async def main():
+        await asyncio.gather(*(one() for _ in range(count)))
+
+    start = time.monotonic()
+    _run(main())
+    assert time.monotonic() - start < count
+
+
+def test_aio_wait_for_cancels_statement():
+    async def main():
+        con = await aio.connect(**_get_connect_args())
+        cur = con.cursor()
+        try:
+            await asyncio.wait_for(cur.execute('select sleep(10) from db_root'), 0.5)
+        except asyncio.TimeoutError:
+            pass
+        await cur.execute('select 1 + 1 from db_root')
+        row = await cur.fetchone()
+        await cur.close()
+        await con.close()
+        return row
+
+    start = time.monotonic()
+    assert _run(main()) == (2,)
+    assert time.monotonic() - start < 5
+
+
+def test_aio_cancel_with_busy_executor():
+    executor = ThreadPoolExecutor(max_workers=1)
+
+    async def main():
+        # The only executor thread runs the statement, not the cancel
+        con = await aio.connect(executor=executor, **_get_connect_args())
+        cur = con.cursor()
+        try:
+            await asyncio.wait_for(cur.execute('select sleep(10) from db_root'), 0.5)
+        except asyncio.TimeoutError:
+            pass
+        await cur.execute('select 1 + 1 from db_root')
+        row = await cur.fetchone()
+        await cur.close()
+        await con.close()
+        return row
+
+    start = time.monotonic()
+    try:
+        assert _run(main()) == (2,)
+    finally:
+        executor.shutdown()
+    assert time.monotonic() - start < 5
@@ -0,0 +1,105 @@
+# pylint: disable=missing-function-docstring,missing-module-docstring
+import pytest
+
+import _cubrid
+import cubrid_db.cursors
+
+
+@pytest.fixture
+def batch_tables(cubrid_db_cursor):
+    cur, _ = cubrid_db_cursor
+    cur.execute('drop table if exists batch_child')
+    cur.execute('drop table if exists batch_parent')
+    cur.execute('create table batch_parent (id int primary key, name varchar(20), '
+                'children int default 0)')
+    cur.execute('create table batch_child (parent_id int, name varchar(20))')
+    yield cur
+    cur.execute('drop table if exists batch_child')
+    cur.execute('drop table if exists batch_parent')
+
+
+def test_execute_batch_mixed(cubrid_db_connection, batch_tables):
+    cur = batch_tables
+    results = cubrid_db_connection.execute_batch([
+        ('insert into batch_parent (id, name) values (?, ?)', (1, 'a')),
+        ('insert into batch_child values (?, ?)', (1, 'x')),
+        ('insert into batch_child values (?, ?)', (1, 'y')),
+        ('insert into batch_child values (?, ?)', (1, 'z')),
+        ('update batch_parent set children = children + ? where id = ?', (3, 1)),
+        "insert into batch_parent (id, name) values (2, 'b')",
+        ('delete from batch_child where name = ?', ['none']),
+    ])
+    assert results == [1, 1, 1, 1, 1, 1, 0]
+
+    cur.execute('select id, name, children from batch_parent order by id')
+    assert cur.fetchall() == [(1, 'a', 3), (2, 'b', 0)]
+    cur.execute('select count(*) from batch_child where parent_id = 1')
+    assert cur.fetchone() == (3,)
+
+
+def test_execute_batch_errors(cubrid_db_connection, batch_tables):
+    cur = batch_tables
+    results = cubrid_db_connection.execute_batch(iter([
+        ('insert into batch_parent (id, name) values (?, ?)', (1, 'a')),
+        ('insert into batch_parent (id, name) values (?, ?)', (1, 'dup')),
+        ('insert into batch_parent (id, name) values (?, ?)', (2, 'b')),
+        ('insert into no_such_table values (?)', (1,)),
+        'insert into no_such_table values (1)',
+        "insert into batch_parent (id, name) values (3, 'c')",
+    ]))
+    assert len(results) == 6
+    assert results[0] == 1 and results[2] == 1 and results[5] == 1
+    assert results[1] < 0 and results[3] < 0 and results[4] < 0
+
+    cur.execute('select id from batch_parent order by id')
+    assert cur.fetchall() == [(1,), (2,), (3,)]
+
+
+def test_execute_batch_interface_errors(cubrid_db_connection, batch_tables):
+    cur = batch_tables
+    # A value the driver cannot bind fails its statement, not the batch
+    results = cubrid_db_connection.execute_batch([
+        ('insert into batch_parent (id, name) values (?, ?)', (1, object())),
+        ('insert into batch_parent (id, name) values (?, ?)', (2, 'b')),
+        "insert into batch_parent (id, name) values (3, 'c')",
+    ])
+    assert results[0] < 0 and results[1:] == [1, 1]
+
+    cur.execute('select id from batch_parent order by id')
+    assert cur.fetchall() == [(2,), (3,)]
+
+
+def test_execute_batch_array_failure(cubrid_db_connection, batch_tables, monkeypatch):
+    cur = batch_tables
+    # An array request the driver cannot bind fails its rows only
+    monkeypatch.setattr(cubrid_db.cursors, 'get_array_columns',
+                        lambda rows: [((1, 2 ** 70), 0), (('a', 'b'), 0)])
+    sql = 'insert into batch_parent (id, name) values (?, ?)'
+    results = cubrid_db_connection.execute_batch([
+        (sql, (1, 'a')),
+        (sql, (2 ** 70, 'b')),
+        "insert into batch_parent (id, name) values (3, 'c')",
+    ])
+    assert results == [-1, -1, 1]
+
+    cur.execute('select id from batch_parent order by id')
+    assert cur.fetchall() == [(3,)]
+
+
+def test_execute_batch_empty(cubrid_db_connection):
+    assert cubrid_db_connection.execute_batch([]) == []
+
+
+def test_batch_execute_compact(cubrid_connection, batch_tables):
+    sql = ["insert into batch_child values (1, 'a')",
+           "insert into batch_child values (2, 'b')",
+           "update batch_child set name = 'c'"]
+    assert cubrid_connection.batch_execute(sql, True) == [1, 1, 2]
+
+    results = cubrid_connection.batch_execute(tuple(sql[:1]))
+    assert results == ({'err_no': 0, 'err_msg': 'success'},)
+
+    with pytest.raises(_cubrid.InterfaceError):
+        cubrid_connection.batch_execute("insert into batch_child values (1, 'a')")
+    with pytest.raises(_cubrid.InterfaceError):
+        cubrid_connection.batch_execute([1, 2])
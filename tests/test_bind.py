@@ -1,9 +1,14 @@
 # pylint: disable=missing-function-docstring,missing-module-docstring
+import array
 import datetime
 
 from decimal import Decimal
 
-from conftest import TABLE_PREFIX
+import pytest
+
+from conftest import TABLE_PREFIX, _get_connect_args
+
+import cubrid_db
 
 
 def _test_binding(cur, columns_sql, samples):
@@ -91,6 +96,40 @@ def test_bind_timestamp(cubrid_db_cursor):
     assert inserted == ts_objects
 
 
+def test_bind_datetimetz(cubrid_db_cursor):
+    tz = datetime.timezone(datetime.timedelta(hours=9))
+    samples = [
+        datetime.datetime(2024, 2, 6, 14, 1, 20, 123000, tzinfo=tz),
+        datetime.datetime(1999, 12, 31, 23, 59, 59, tzinfo=datetime.timezone.utc),
+    ]
+    inserted = _test_binding(cubrid_db_cursor[0], 'xdt datetimetz', samples)
+    assert inserted == samples
+    assert inserted[0].utcoffset() == datetime.timedelta(hours=9)
+    assert inserted[1].tzinfo is datetime.timezone.utc
+
+
+def test_fetch_epoch_datetimes():
+    conn = cubrid_db.connect(**_get_connect_args(), epoch_datetimes=True)
+    cur = conn.cursor()
+    table_name = f'{TABLE_PREFIX}bindings'
+    cur.execute(f'drop table if exists {table_name}')
+    try:
+        cur.execute(f"create table {table_name} (a datetime, b timestamp, "
+                    "c datetimetz, d date)")
+        cur.execute(f"insert into {table_name} values ('2024-02-06 14:01:20.123', "
+                    "'2024-02-06 14:01:20', datetimetz'2024-02-06 14:01:20 +02:00', "
+                    "'2024-02-06')")
+        cur.execute(f"select * from {table_name}")
+        epoch = int(datetime.datetime(2024, 2, 6, 14, 1, 20,
+                                      tzinfo=datetime.timezone.utc).timestamp()) * 10 ** 6
+        assert cur.fetchone() == (epoch + 123000, epoch, epoch - 2 * 3600 * 10 ** 6,
+                                  datetime.date(2024, 2, 6))
+    finally:
+        cur.execute(f'drop table if exists {table_name}')
+        cur.close()
+        conn.close()
+
+
 def test_bind_binary(cubrid_db_cursor):
     samples_bin = ['0100', '01010101010101', '111111111', '1111100000010101010110111111']
 
@@ -108,3 +147,46 @@ def test_bind_binary(cubrid_db_cursor):
 
     inserted = _test_binding(cubrid_db_cursor[0], 'xbit BIT VARYING(256)', samples_bytes)
     assert inserted == samples_bytes
+
+
+def test_bind_binary_buffers(cubrid_db_cursor):
+    samples = [memoryview(b'\x12\x34'), bytearray(b'\x56')]
+    inserted = _test_binding(cubrid_db_cursor[0], 'xbit BIT VARYING(256)', samples)
+    assert inserted == [b'\x12\x34', b'\x56']
+
+    # Typed buffers are no bit strings
+    with pytest.raises(cubrid_db.InterfaceError):
+        _test_binding(cubrid_db_cursor[0], 'xbit BIT VARYING(256)', [array.array('i', [1])])
+
+
+def test_bind_params_mixed(cubrid_db_cursor):
+    cur, _ = cubrid_db_cursor
+    table_name = f'{TABLE_PREFIX}bindings'
+    cur.execute(f'drop table if exists {table_name}')
+    try:
+        cur.execute(f"create table {table_name} (a int, b bigint, c varchar(20), "
+                    "d int, e numeric(10,2), f bit varying(64), g double)")
+        row = (True, 2 ** 40, 'Cerveza á', None, Decimal('3.25'),
+               bytearray(b'\x0f\xf0'), 2.5)
+        cur.execute(f"insert into {table_name} values (?, ?, ?, ?, ?, ?, ?)", row)
+        assert cur.rowcount == 1
+
+        cur.execute(f"select * from {table_name} where b = ? and c = ?",
+                    (2 ** 40, 'Cerveza á'))
+        assert cur.fetchone() == (1, 2 ** 40, 'Cerveza á', None,
+                                  Decimal('3.25'), b'\x0f\xf0', 2.5)
+    finally:
+        cur.execute(f'drop table if exists {table_name}')
+
+
+def test_bind_params_set(cubrid_db_cursor):
+    cur, _ = cubrid_db_cursor
+    table_name = f'{TABLE_PREFIX}bindings'
+    cur.execute(f'drop table if exists {table_name}')
+    try:
+        cur.execute(f"create table {table_name} (id int, s set(int))")
+        cur.execute(f"insert into {table_name} values (?, ?)", (1, {1, 2, 3}))
+        cur.execute(f"select s from {table_name} where id = ?", 1)
+        assert set(cur.fetchone()[0]) == {'1', '2', '3'}
+    finally:
+        cur.execute(f'drop table if exists {table_name}')
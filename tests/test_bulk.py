@@ -0,0 +1,93 @@
+# pylint: disable=missing-function-docstring,missing-module-docstring
+import datetime
+import io
+
+import pytest
+
+from conftest import _create_table, _drop_table
+
+import cubrid_db
+
+
+@pytest.fixture
+def bulk_table(cubrid_db_cursor):
+    table_name = _create_table(cubrid_db_cursor, 'bulk',
+                               'id int, name varchar(20), created datetime')
+    yield table_name
+    _drop_table(cubrid_db_cursor, table_name)
+
+
+def _count(cur, table):
+    cur.execute(f'select count(*) from {table}')
+    return cur.fetchone()[0]
+
+
+def test_bulk_load_rows(cubrid_db_cursor, bulk_table):
+    cur, con = cubrid_db_cursor
+    created = datetime.datetime(2024, 2, 6, 14, 1, 20)
+    reports = []
+
+    stats = con.bulk_load(bulk_table, ['id', 'name', 'created'],
+                          ((i, f'name {i}', created) for i in range(2500)),
+                          batch_rows=1000, progress=reports.append)
+
+    assert stats['rows'] == 2500 and stats['batches'] == 3
+    assert [r['rows'] for r in reports] == [1000, 2000, 2500]
+    assert all(r['rows_per_sec'] > 0 for r in reports)
+    assert _count(cur, bulk_table) == 2500
+    cur.execute(f'select * from {bulk_table} where id = 1234')
+    assert cur.fetchone() == (1234, 'name 1234', created)
+
+
+def test_bulk_load_csv(cubrid_db_cursor, bulk_table):
+    cur, con = cubrid_db_cursor
+    data = io.StringIO('1,Tooheys,2024-02-06 14:01:20\n'
+                       '2,,2024-02-07 00:00:00\n'
+                       '3,Coopers,\n')
+
+    stats = con.bulk_load(bulk_table, None, data, batch_rows=2)
+
+    assert stats['rows'] == 3
+    cur.execute(f'select * from {bulk_table} order by id')
+    assert cur.fetchall() == [
+        (1, 'Tooheys', datetime.datetime(2024, 2, 6, 14, 1, 20)),
+        (2, None, datetime.datetime(2024, 2, 7)),
+        (3, 'Coopers', None),
+    ]
+
+
+def test_bulk_load_sessions(cubrid_db_cursor, bulk_table):
+    cur, con = cubrid_db_cursor
+
+    stats = con.bulk_load(bulk_table, ['id', 'name'],
+                          [(i, str(i)) for i in range(5000)],
+                          batch_rows=500, sessions=3)
+
+    assert stats['rows'] == 5000 and stats['batches'] == 10
+    cur.execute(f'select count(*), count(distinct id) from {bulk_table}')
+    assert cur.fetchone() == (5000, 5000)
+
+
+def test_bulk_load_quoted_names(cubrid_db_cursor):
+    cur, con = cubrid_db_cursor
+    table_name = _create_table(cubrid_db_cursor, 'bulk_quoted',
+                               '`order` int, `my name` varchar(20)')
+    try:
+        stats = con.bulk_load(table_name, ['order', 'my name'], [(1, 'a'), (2, 'b')])
+        assert stats['rows'] == 2
+        assert _count(cur, table_name) == 2
+    finally:
+        _drop_table(cubrid_db_cursor, table_name)
+
+
+def test_bulk_load_errors(cubrid_db_cursor, bulk_table):
+    _, con = cubrid_db_cursor
+
+    with pytest.raises(ValueError):
+        con.bulk_load(bulk_table, ['id'], [(1,)], batch_rows=0)
+    with pytest.raises(TypeError):
+        con.bulk_load(bulk_table, ['id'], [(1,)], delimiter=';')
+    with pytest.raises(cubrid_db.InterfaceError):
+        con.bulk_load(bulk_table, ['id'], [(1,)], sessions=2, commit=False)
+    with pytest.raises(cubrid_db.InterfaceError):
+        con.bulk_load(bulk_table, ['i`d'], [(1,)])
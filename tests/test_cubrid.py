@@ -34,6 +34,7 @@ To generate a coverage report, add the `--cov=_cubrid` option.
 
 import datetime
 import os
+import pickle
 import re
 
 import pytest
@@ -217,6 +218,58 @@ def test_cursor_no_charset(cubrid_connection):
         cur.close()
 
 
+def test_cursor_charset(cubrid_connection):
+    cur = cubrid_connection.cursor()
+    try:
+        with pytest.raises(LookupError):
+            cur.set_charset('no-such-charset')
+        cur.prepare('drop table if exists test_cubrid')
+        cur.execute()
+        cur.prepare('create table if not exists test_cubrid (name varchar(40))')
+        cur.execute()
+        cur.prepare("insert into test_cubrid values ('A long enough ASCII value'), ('Țărână')")
+        cur.execute()
+
+        for charset in ('UTF-8', 'utf_8'):
+            cur.set_charset(charset)
+            cur.prepare('select * from test_cubrid')
+            cur.execute()
+            assert _fetchall(cur) == [('A long enough ASCII value',), ('Țărână',)]
+
+        cur.set_charset('latin-1')
+        cur.prepare('select * from test_cubrid')
+        cur.execute()
+        assert _fetchall(cur) == [('A long enough ASCII value',),
+                                  ('Țărână'.encode().decode('latin-1'),)]
+    finally:
+        cur.prepare('drop table if exists test_cubrid')
+        cur.execute()
+        cur.close()
+
+
+def test_cursor_intern_strings(cubrid_connection):
+    cur = cubrid_connection.cursor()
+    try:
+        cur.prepare('drop table if exists test_cubrid')
+        cur.execute()
+        cur.prepare('create table if not exists test_cubrid (name varchar(20))')
+        cur.execute()
+        cur.prepare("insert into test_cubrid values ('Țărână'), ('Țărână')")
+        cur.execute()
+
+        assert cur.intern_strings == 0
+        cur.intern_strings = 1
+        cur.prepare('select * from test_cubrid')
+        cur.execute()
+        (first,), (second,) = _fetchall(cur)
+        assert first == 'Țărână'
+        assert first is second
+    finally:
+        cur.prepare('drop table if exists test_cubrid')
+        cur.execute()
+        cur.close()
+
+
 def test_cursor_isolation(cubrid_connection):
     # Ensure cursors are closed after the test
     cur1 = cur2 = None
@@ -447,6 +500,15 @@ def test_bind_bigint(cubrid_cursor):
     assert inserted == numbers_bigint
 
 
+def test_bind_memoryview_string(cubrid_cursor):
+    cursor, _ = cubrid_cursor
+    # A slice is not NUL terminated: only its own bytes are bound
+    samples = [memoryview(b'abcdef')[1:3]]
+    bt_string = 2
+    inserted = _test_bind(cursor, 'name varchar(20)', samples, bt_string)
+    assert inserted == ['bc']
+
+
 def test_bind_float(cubrid_cursor):
     cursor, _ = cubrid_cursor
     numbers = ['3.14']
@@ -568,6 +630,153 @@ def test_row_to_dict(cubrid_cursor, db_int_table):
                     {'id': 10, 'val': 9}]
 
 
+def test_fetch_many(cubrid_cursor, db_int_table):
+    cur, _ = cubrid_cursor
+
+    cur.prepare("select * from test_cubrid")
+    cur.execute()
+
+    assert cur.fetch_many(0) == []
+    assert cur.fetch_many(3) == [(1, 0), (2, 1), (3, 2)]
+    assert cur.fetch_row() == (4, 3)
+    assert cur.fetch_many(2, 1) == [{'id': 5, 'val': 4}, {'id': 6, 'val': 5}]
+    assert cur.row_tell() == 6
+    assert cur.fetch_many(10) == [(7, 6), (8, 7), (9, 8), (10, 9)]
+    assert cur.fetch_many(10) == []
+    assert cur.fetch_row() is None
+
+
+def test_fetch_all(cubrid_cursor, db_int_table):
+    cur, _ = cubrid_cursor
+
+    cur.prepare("select * from test_cubrid")
+    cur.execute()
+
+    assert cur.fetch_many(8) == _fetchall_expected()[:8]
+    assert cur.fetch_all() == _fetchall_expected()[8:]
+    assert cur.fetch_all() == []
+
+    cur.prepare("select * from test_cubrid")
+    cur.execute()
+    assert cur.fetch_many(-1) == _fetchall_expected()
+
+    with pytest.raises(_cubrid.InterfaceError):
+        cur.fetch_all(2)
+
+
+def _fetchall_expected():
+    return [(i + 1, i) for i in range(10)]
+
+
+def test_fetch_row_type(cubrid_cursor, db_int_table):
+    cur, _ = cubrid_cursor
+
+    cur.prepare("select * from test_cubrid")
+    cur.execute()
+
+    rows = cur.fetch_many(3, 2)
+    assert rows == [(1, 0), (2, 1), (3, 2)]
+    row = rows[1]
+    assert isinstance(row, tuple) and isinstance(row, _cubrid.Row)
+    assert row['id'] == 2 and row['val'] == 1
+    assert row[0] == 2 and row[-1] == 1 and row[:1] == (2,)
+    assert row.keys() == ['id', 'val']
+    assert dict(row) == {'id': 2, 'val': 1}
+    with pytest.raises(KeyError):
+        row['missing']
+
+    # The rows of a result share one type
+    assert type(rows[0]) is type(cur.fetch_row(2))
+    assert cur.fetch_all(1)[0] == {'id': 5, 'val': 4}
+
+    # Re-executing the statement keeps the column names
+    cur.prepare("select val, id from test_cubrid")
+    cur.execute()
+    assert dict(cur.fetch_row(2)) == {'val': 0, 'id': 1}
+
+
+def test_fetch_row_type_shared(cubrid_cursor, db_int_table):
+    cur, con = cubrid_cursor
+
+    cur.prepare("select * from test_cubrid")
+    cur.execute()
+    row = cur.fetch_row(2)
+
+    # Another cursor with the same columns reuses the cached type
+    other = con.cursor()
+    try:
+        other.prepare("select id, val from test_cubrid")
+        other.execute()
+        assert type(other.fetch_row(2)) is type(row)
+    finally:
+        other.close()
+
+    copy = pickle.loads(pickle.dumps(row))
+    assert type(copy) is type(row)
+    assert copy == (1, 0) and copy['val'] == 0
+
+
+def test_bind_params(cubrid_cursor):
+    cur, _ = cubrid_cursor
+    try:
+        _create_table(cur, 'a int, b bigint, c varchar(10), d bit varying(16), e int', [])
+        cur.prepare('insert into test_cubrid values (?, ?, ?, ?, ?)')
+        assert cur.bind_params([7, 2 ** 40, 'abc', b'\xab', None]) == []
+        assert cur.execute() == 1
+
+        cur.prepare('select * from test_cubrid where a = ? and c = ?')
+        assert cur.bind_params((7, 'abc')) == []
+        cur.execute()
+        assert cur.fetch_row() == (7, 2 ** 40, 'abc', b'\xab', None)
+
+        # Collections are left to the caller
+        cur.prepare('select * from test_cubrid where a = ? and c = ?')
+        assert cur.bind_params([7, {'abc'}]) == [2]
+
+        with pytest.raises(OverflowError):
+            cur.bind_params([2 ** 70])
+    finally:
+        _cleanup_table(cur)
+
+
+def test_execute_array(cubrid_cursor):
+    cur, _ = cubrid_cursor
+    try:
+        _create_table(cur, 'a int, b bigint, c double, d varchar(10), e date', [])
+        cur.prepare('insert into test_cubrid values (?, ?, ?, ?, ?)')
+        cur.bind_param_array(1, [1, None, 3])
+        cur.bind_param_array(2, [2 ** 40, 1, None])
+        cur.bind_param_array(3, [1.5, 2, None])
+        cur.bind_param_array(4, ['x', 'yy', None])
+        cur.bind_param_array(5, [datetime.date(2011, 2, 28), None, None])
+        assert cur.execute_array() == [1, 1, 1]
+
+        cur.prepare('select * from test_cubrid order by b')
+        cur.execute()
+        assert cur.fetch_all() == [
+            (None, 1, 2.0, 'yy', None),
+            (1, 2 ** 40, 1.5, 'x', datetime.date(2011, 2, 28)),
+            (3, None, None, None, None),
+        ]
+    finally:
+        _cleanup_table(cur)
+
+
+def test_execute_array_errors(cubrid_cursor):
+    cur, _ = cubrid_cursor
+    try:
+        _create_table(cur, 'a int', [])
+        cur.prepare('insert into test_cubrid values (?)')
+        with pytest.raises(_cubrid.InterfaceError):
+            cur.execute_array()
+        with pytest.raises(_cubrid.InterfaceError):
+            cur.bind_param_array(1, [1, 'a'])
+        with pytest.raises(_cubrid.InterfaceError):
+            cur.bind_param_array(1, [])
+    finally:
+        _cleanup_table(cur)
+
+
 def test_collection(cubrid_cursor, db_collection_table):
     cur, _ = cubrid_cursor
 
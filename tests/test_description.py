@@ -1,6 +1,6 @@
 # pylint: disable=missing-function-docstring,missing-module-docstring
 
-from conftest import TABLE_PREFIX
+from conftest import TABLE_PREFIX, _get_connect_args
 
 import cubrid_db
 
@@ -110,3 +110,55 @@ def test_description_multiset(cubrid_db_cursor, desc_table):
 
 def test_description_sequence(cubrid_db_cursor, desc_table):
     _test_description(cubrid_db_cursor, desc_table, ('c_sequence', 96, 0, 0, 0, 0, 1))
+
+
+def test_description_reused_same_handle(cubrid_cursor, booze_table):
+    cur, _ = cubrid_cursor
+    cur.prepare(f'select name from {booze_table}')
+    cur.execute()
+    first = cur.description
+    assert first[0][0] == 'name'
+    cur.execute()
+    assert cur.description is first
+
+    cur.prepare(f'select name as other from {booze_table}')
+    cur.execute()
+    assert cur.description[0][0] == 'other'
+
+
+def test_description_reused_stmt_cache(booze_table):
+    con = cubrid_db.connect(stmt_cache_size=4, **_get_connect_args())
+    cur = con.cursor()
+    try:
+        sql = f'select name from {booze_table}'
+        cur.execute(sql)
+        first = cur.description
+        cur.execute(sql)
+        assert cur.description is first
+
+        cur.execute(f'insert into {booze_table} values (?)', ('x',))
+        assert cur.description is None
+        cur.execute(sql)
+        assert cur.description is first
+    finally:
+        cur.close()
+        con.close()
+
+
+def test_description_after_close(cubrid_cursor, booze_table):
+    cur, _ = cubrid_cursor
+    cur.prepare(f'select name from {booze_table}')
+    cur.execute()
+    cur.close()
+    assert cur.description is None
+
+
+def test_description_assigned(cubrid_db_cursor, booze_table):
+    cur, _ = cubrid_db_cursor
+    cur.execute(f'select name from {booze_table}')
+    cur.description = (('renamed',) + cur.description[0][1:],)
+    assert cur.description[0][0] == 'renamed'
+
+    # The next execute describes its own result again
+    cur.execute(f'select name from {booze_table}')
+    assert cur.description[0][0] == 'name'
@@ -1,5 +1,7 @@
 # pylint: disable=missing-function-docstring,missing-module-docstring
 import re
+import threading
+import time
 
 import pytest
 
@@ -10,6 +12,7 @@ from conftest import (
 )
 
 import cubrid_db
+from cubrid_db.cursors import get_array_column
 
 
 def test_execute(cubrid_db_cursor, booze_table):
@@ -37,6 +40,76 @@ def test_execute(cubrid_db_cursor, booze_table):
         'cursor.fetchall retrieved incorrect data, or data inserted incorrectly'
 
 
+@pytest.fixture
+def exc_array_table(cubrid_db_cursor):
+    table_name = _create_table(cubrid_db_cursor, 'execute_array',
+        "a int primary key, b varchar(20), c double")
+    yield table_name
+    _drop_table(cubrid_db_cursor, table_name)
+
+
+def test_executemany_array(cubrid_db_cursor, exc_array_table):
+    cur, _ = cubrid_db_cursor
+    exc_table = exc_array_table
+
+    rows = [(i, f'name{i}', i * 1.5) for i in range(25)]
+    cur.executemany_array = True
+    cur.executemany_batch_size = 10
+    cur.executemany(f'insert into {exc_table} values (?, ?, ?)', rows)
+    assert cur.rowcount == 1
+
+    cur.execute(f'select * from {exc_table} order by 1')
+    assert cur.fetchall() == rows
+
+
+def test_executemany_array_failed_row(cubrid_db_cursor, exc_array_table):
+    cur, _ = cubrid_db_cursor
+    exc_table = exc_array_table
+
+    rows = [(i, f'name{i}', 1.0) for i in (1, 2, 2, 3, 4, 5)]
+    cur.executemany_array = True
+    cur.executemany_batch_size = 4
+    with pytest.raises(cubrid_db.IntegrityError) as exc_info:
+        cur.executemany(f'insert into {exc_table} values (?, ?, ?)', rows)
+    assert exc_info.value.row == 2
+
+    # The server ran the rest of the failed request, not the next one
+    cur.execute(f'select a from {exc_table} order by 1')
+    assert cur.fetchall() == [(1,), (2,), (3,)]
+
+
+def test_executemany_stops_at_failed_row(cubrid_db_cursor, exc_array_table):
+    cur, _ = cubrid_db_cursor
+    exc_table = exc_array_table
+
+    rows = [(i, f'name{i}', 1.0) for i in (1, 2, 2, 3)]
+    with pytest.raises(cubrid_db.IntegrityError):
+        cur.executemany(f'insert into {exc_table} values (?, ?, ?)', rows)
+
+    cur.execute(f'select a from {exc_table} order by 1')
+    assert cur.fetchall() == [(1,), (2,)]
+
+
+def test_array_column_exact_ints():
+    assert get_array_column((1, 2 ** 62, None)) == ((1, 2 ** 62, None), 0)
+    # Rounded as float, or out of BIGINT: bound row by row
+    assert get_array_column((2 ** 53 + 1, 1.5)) is None
+    assert get_array_column((1, 2 ** 63)) is None
+    assert get_array_column((-2 ** 63 - 1,)) is None
+
+
+def test_executemany_mixed_types(cubrid_db_cursor, exc_array_table):
+    cur, _ = cubrid_db_cursor
+    exc_table = exc_array_table
+
+    # Not array bindable: falls back to one execute() per row
+    rows = [(1, 'a', 1.0), ('2', 'b', 2.0)]
+    cur.executemany(f'insert into {exc_table} values (?, ?, ?)', rows)
+
+    cur.execute(f'select count(*) from {exc_table}')
+    assert cur.fetchone() == (2,)
+
+
 def test_execute_select_version(cubrid_db_cursor):
     cur, _ = cubrid_db_cursor
     cur.execute("SELECT VERSION()")
@@ -501,3 +574,44 @@ def test_view_update(cubrid_db_cursor, exc_view_b):
 
     with pytest.raises(cubrid_db.IntegrityError, match = r'-494'):
         cur.execute(f"UPDATE {exc_view_b} SET phone=NULL")
+
+
+def test_query_timeout(cubrid_db_cursor):
+    cur, _ = cubrid_db_cursor
+    assert cur.query_timeout is None
+
+    cur.query_timeout = 0.5
+    assert cur.query_timeout == 0.5
+    start = time.monotonic()
+    with pytest.raises(cubrid_db.QueryCanceledError):
+        cur.execute('select sleep(10) from db_root')
+    assert time.monotonic() - start < 5
+
+    cur.query_timeout = None
+    cur.execute('select 1 + 1 from db_root')
+    assert cur.fetchone() == (2,)
+    cur.query_timeout = 0
+    assert cur.query_timeout == 0
+    cur.execute('select 1 + 1 from db_root')
+    assert cur.fetchone() == (2,)
+    with pytest.raises(ValueError):
+        cur.query_timeout = -1
+
+
+def test_cancel(cubrid_db_cursor):
+    cur, _ = cubrid_db_cursor
+    timer = threading.Timer(0.5, cur.cancel)
+
+    start = time.monotonic()
+    timer.start()
+    try:
+        with pytest.raises(cubrid_db.QueryCanceledError):
+            cur.execute('select sleep(10) from db_root')
+    finally:
+        timer.join()
+    assert time.monotonic() - start < 5
+    assert issubclass(cubrid_db.QueryCanceledError, cubrid_db.OperationalError)
+
+    # The connection is still usable, and a stale cancel does not leak
+    cur.execute('select 1 + 1 from db_root')
+    assert cur.fetchone() == (2,)
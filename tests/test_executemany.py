@@ -111,3 +111,20 @@ def test_primary_delete(cubrid_db_cursor, exc_primary_tables):
     cur.execute(f"select * from {ftb} ")
     rows = [(row[0].strip(), row[1], row[2], row[3]) for row in cur.fetchall()]
     assert rows == [('003', 5, 5, '5656'), ('003', 6, 6, '6767')]
+
+
+def test_steady_state_allocations(cubrid_db_cursor, exc_many_table):
+    cur, _ = cubrid_db_cursor
+    rows = [(f'name{i}', f'category{i}') for i in range(500)]
+    sql = f"insert into {exc_many_table} values(?,?)"
+
+    cur.executemany(sql, rows)
+    assert cur.allocations > 0
+    # The bind buffers of the first batch are reused by the next ones
+    for _ in range(3):
+        cur.executemany(sql, rows)
+        assert cur.allocations == 0
+
+    cur.execute(f"select count(*) from {exc_many_table} where name = ?", ('name1',))
+    assert cur.allocations == 0
+    assert cur.fetchone()[0] == 4
@@ -0,0 +1,86 @@
+# pylint: disable=missing-function-docstring,missing-module-docstring
+import pytest
+
+from conftest import _get_connect_args
+
+import cubrid_db
+from cubrid_db.connections import (
+    ROUTING_LEAST_LOADED, ROUTING_ROUND_ROBIN, _ReplicaRouter, make_url,
+)
+
+
+def test_make_url():
+    dsn = 'CUBRID:primary:33000:demodb:::'
+    assert make_url(dsn) == dsn
+    assert make_url(dsn, 'replica:33100') == 'CUBRID:replica:33100:demodb:::'
+    assert make_url('cci:' + dsn, 'replica:33100') == 'cci:CUBRID:replica:33100:demodb:::'
+    assert (make_url(dsn, alt_hosts=['a:1', ('b', 2)], connect_timeout=1.5)
+            == dsn + '?althosts=a:1,b:2&loginTimeout=1500')
+    assert (make_url(dsn + '?altHosts=x:9&rctime=60', alt_hosts=['a:1'])
+            == dsn + '?rctime=60&althosts=a:1,x:9')
+    assert (make_url(dsn + '?althosts=a:1,x:9', alt_hosts=['a:1', 'b:2'])
+            == dsn + '?althosts=a:1,b:2,x:9')
+    with pytest.raises(ValueError):
+        make_url('CUBRID:primary', 'replica:33100')
+
+
+def test_router_round_robin():
+    router = _ReplicaRouter()
+    hosts = ['a:1', 'b:1', 'c:1']
+    assert router.order(hosts, ROUTING_ROUND_ROBIN) == ['a:1', 'b:1', 'c:1']
+    assert router.order(hosts, ROUTING_ROUND_ROBIN) == ['b:1', 'c:1', 'a:1']
+    assert router.order(hosts, ROUTING_ROUND_ROBIN) == ['c:1', 'a:1', 'b:1']
+    assert router.order(hosts, ROUTING_ROUND_ROBIN) == ['a:1', 'b:1', 'c:1']
+    with pytest.raises(ValueError):
+        router.order(hosts, 'random')
+
+
+def test_router_least_loaded():
+    router = _ReplicaRouter()
+    hosts = ['a:1', 'b:1']
+    router.opened('a:1')
+    assert router.order(hosts, ROUTING_LEAST_LOADED)[0] == 'b:1'
+    router.opened('b:1')
+    router.opened('b:1')
+    assert router.order(hosts, ROUTING_LEAST_LOADED)[0] == 'a:1'
+    router.closed('b:1')
+    router.closed('b:1')
+    assert router.order(hosts, ROUTING_LEAST_LOADED)[0] == 'b:1'
+    assert 'b:1' not in router.open
+
+
+def test_failover_to_alt_host():
+    dsn = _get_connect_args()['dsn']
+    conn = cubrid_db.connect(dsn=make_url(dsn, 'localhost:1'),
+                             alt_hosts=['localhost:33000'], connect_timeout=5)
+    try:
+        assert conn.ping()
+    finally:
+        conn.close()
+
+
+def test_read_only_replicas():
+    conn = cubrid_db.connect(**_get_connect_args(), read_only=True,
+                             replicas=['localhost:33000'])
+    try:
+        assert conn.read_only
+        assert conn.host == 'localhost:33000'
+        assert cubrid_db.connections.replica_router.open['localhost:33000'] >= 1
+        cur = conn.cursor()
+        cur.execute('select 1 from db_root')
+        assert cur.fetchone() == (1,)
+        cur.close()
+    finally:
+        conn.close()
+    assert conn.host is None
+
+
+def test_read_only_replica_released_on_del():
+    router = cubrid_db.connections.replica_router
+    before = router.open['localhost:33000']
+    conn = cubrid_db.connect(**_get_connect_args(), read_only=True,
+                             replicas=['localhost:33000'])
+    assert router.open['localhost:33000'] == before + 1
+    conn.connection.close()
+    del conn
+    assert router.open['localhost:33000'] == before
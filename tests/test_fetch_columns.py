@@ -0,0 +1,96 @@
+# pylint: disable=missing-function-docstring,missing-module-docstring
+import array
+import datetime
+import struct
+
+import pytest
+
+from conftest import TABLE_PREFIX
+
+import cubrid_db
+
+
+EPOCH = datetime.date(1970, 1, 1)
+
+
+@pytest.fixture
+def columns_table(cubrid_db_cursor):
+    cur, _ = cubrid_db_cursor
+    table_name = f'{TABLE_PREFIX}columns'
+    cur.execute(f'drop table if exists {table_name}')
+    cur.execute(f'''create table {table_name} (
+        c_int int, c_bigint bigint, c_double double, c_date date,
+        c_datetime datetime, c_varchar varchar(32), c_varbit bit varying)''')
+    cur.executemany(f'insert into {table_name} values (?,?,?,?,?,?,?)', [
+        (1, 2 ** 40, 1.5, datetime.date(2024, 2, 29),
+         datetime.datetime(2024, 2, 29, 12, 30, 15, 250000), 'ana', b'\xde\xad'),
+        (None, None, None, None, None, None, None),
+        (-3, -1, -0.25, EPOCH, datetime.datetime(1970, 1, 1), '', b'\x01'),
+    ])
+    yield table_name
+    cur.execute(f'drop table if exists {table_name}')
+
+
+def _values(fmt, data):
+    return list(array.array(fmt, bytes(data)))
+
+
+def _strings(data, offsets):
+    ends = list(struct.unpack(f'{len(offsets) // 8}q', bytes(offsets)))
+    return [bytes(data[a:b]) for a, b in zip(ends, ends[1:])]
+
+
+def test_fetch_columns(cubrid_db_cursor, columns_table):
+    cur, _ = cubrid_db_cursor
+    cur.execute(f'select * from {columns_table} order by nvl(c_int, 100) desc')
+    cols = cur.fetch_columns()
+
+    assert [c[0] for c in cols] == ['i', 'l', 'g', 'tdD', 'tsu:', 'U', 'Z']
+    for _, _, validity, _ in cols:
+        assert bytes(validity) == b'\x06'
+
+    assert _values('i', cols[0][1])[1:] == [1, -3]
+    assert _values('q', cols[1][1])[1:] == [2 ** 40, -1]
+    assert _values('d', cols[2][1])[1:] == [1.5, -0.25]
+    assert _values('i', cols[3][1])[1:] == [
+        (datetime.date(2024, 2, 29) - EPOCH).days, 0]
+    stamp = datetime.datetime(2024, 2, 29, 12, 30, 15, 250000) - datetime.datetime(1970, 1, 1)
+    assert _values('q', cols[4][1])[1:] == [stamp // datetime.timedelta(microseconds=1), 0]
+    assert _strings(cols[5][1], cols[5][3]) == [b'', b'ana', b'']
+    assert _strings(cols[6][1], cols[6][3]) == [b'', b'\xde\xad', b'\x01']
+
+
+def test_fetch_columns_size(cubrid_db_cursor, columns_table):
+    cur, _ = cubrid_db_cursor
+    cur.execute(f'select c_int from {columns_table} where c_int is not null order by c_int')
+
+    fmt, data, validity, offsets = cur.fetch_columns(1)[0]
+    assert (fmt, _values('i', data), validity, offsets) == ('i', [-3], None, None)
+    assert cur.fetchone() == (1,)
+    assert not cur.fetch_columns()[0][1]
+
+
+def test_fetch_columns_float(cubrid_db_cursor):
+    cur, _ = cubrid_db_cursor
+    sql = "select cast(1.1 as float), cast(-0.3 as float) from db_root"
+    cur.execute(sql)
+    row = cur.fetchone()
+    cur.execute(sql)
+    # FLOAT columns give the values fetchone() gives
+    assert [_values('d', c[1]) for c in cur.fetch_columns()] == [[v] for v in row]
+    assert row == (1.1, -0.3)
+
+
+def test_fetch_columns_not_supported(cubrid_db_cursor):
+    cur, _ = cubrid_db_cursor
+    cur.execute("select set{1, 2} from db_root")
+    with pytest.raises(cubrid_db.Error):
+        cur.fetch_columns()
+
+
+def test_fetch_columns_no_result(cubrid_db_cursor, columns_table):
+    cur, _ = cubrid_db_cursor
+    cur.execute(f'delete from {columns_table} where c_int = 1')
+    # A statement without a result set has no columns
+    assert cur.fetch_columns() == []
+    assert cur.fetch_columns(10) == []
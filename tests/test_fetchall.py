@@ -113,6 +113,12 @@ def test_fetchall_float(cubrid_db_cursor):
     _test_fetchall_datatype(cur, 'c_float float', rows)
 
 
+def test_fetchall_float_precision(cubrid_db_cursor):
+    cur, _ = cubrid_db_cursor
+    rows = [(x,) for x in [1.234567, 3.4028235e38, -1.5e-7, None]]
+    _test_fetchall_datatype(cur, 'c_float float', rows)
+
+
 def test_fetchall_double(cubrid_db_cursor):
     cur, _ = cubrid_db_cursor
     rows = [(x,) for x in [1.1,0.0,-1.1]]
@@ -174,6 +180,14 @@ def test_fetchall_varbit(cubrid_db_cursor):
     _test_fetchall_datatype(cur, 'c_varbit bit varying', rows)
 
 
+def test_fetchall_binary_nulls(cubrid_db_cursor):
+    cur, _ = cubrid_db_cursor
+    rows = [(None, None, None, None), (1.5, 2.25, decimal.Decimal('3.75'), b'\x01')]
+    _test_fetchall_datatype(
+        cur, 'c_float float, c_double double, c_num numeric(10,2), c_varbit bit varying',
+        rows)
+
+
 def test_fetchall_multiple_columns(cubrid_db_cursor):
     cur, _ = cubrid_db_cursor
     rows = [
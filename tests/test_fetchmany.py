@@ -138,3 +138,57 @@ def test_fetchmany_overflow(cubrid_db_cursor, fetchmany_table):
     cur.execute(f"select * from {fetchmany_table}")
     data = cur.fetchmany(cur.rowcount + 10)
     assert len(data) == cur.rowcount
+
+
+@pytest.mark.parametrize("fetch_size", [1, 7, 1000])
+def test_fetchmany_fetch_size(cubrid_db_cursor, fetchmany_table, fetch_size):
+    cur, _ = cubrid_db_cursor
+
+    cur.fetch_size = fetch_size
+    cur.execute(f"select * from {fetchmany_table}")
+    total = cur.rowcount
+
+    data = cur.fetchmany(10)
+    data += cur.fetchall()
+    assert len(data) == total
+    assert data[0] == (1, 21, 'myName-1')
+
+
+def test_fetch_size_from_arraysize(cubrid_db_cursor):
+    cur, _ = cubrid_db_cursor
+
+    assert cur.fetch_size == 0
+    cur.arraysize = 500
+    assert cur._get_fetch_size() == 500 # pylint: disable=protected-access
+    cur.fetch_size = 50
+    assert cur._get_fetch_size() == 50 # pylint: disable=protected-access
+
+
+def test_fetch_size_invalid(cubrid_cursor):
+    cur, _ = cubrid_cursor
+
+    with pytest.raises(cubrid_db.InterfaceError):
+        cur.set_fetch_size(-1)
+
+
+def test_fetch_size_reset_on_prepared(cubrid_cursor, fetchmany_table):
+    cur, _ = cubrid_cursor
+
+    cur.set_fetch_size(7)
+    cur.prepare(f"select * from {fetchmany_table}")
+    assert cur.fetch_size == 7
+    cur.execute()
+    # Applies to the statement already prepared
+    cur.set_fetch_size(0)
+    assert cur.fetch_size == 0
+    assert len(cur.fetch_many(-1)) == cur.rowcount
+    # and is kept for the next statement
+    cur.prepare(f"select * from {fetchmany_table}")
+    assert cur.fetch_size == 0
+
+
+def test_connection_fetch_size(cubrid_db_connection):
+    cubrid_db_connection.fetch_size = 25
+    cur = cubrid_db_connection.cursor()
+    assert cur.fetch_size == 25
+    cur.close()
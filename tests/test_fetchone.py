@@ -69,3 +69,15 @@ def test_fetchone_multi(cubrid_db_cursor, populated_booze_table):
         l.append(r[0])
 
     assert l == BOOZE_SAMPLES
+
+
+def test_fetchone_row_cursor(cubrid_db_connection, populated_booze_table):
+    cur = cubrid_db_connection.cursor(row_cursor=True)
+    try:
+        cur.execute(f"select name from {populated_booze_table}")
+        r = cur.fetchone()
+        assert r == (BOOZE_SAMPLES[0],)
+        assert r['name'] == BOOZE_SAMPLES[0]
+        assert [row['name'] for row in cur.fetchall()] == BOOZE_SAMPLES[1:]
+    finally:
+        cur.close()
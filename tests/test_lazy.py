@@ -0,0 +1,96 @@
+# pylint: disable=missing-function-docstring,missing-module-docstring
+import pytest
+
+import _cubrid
+import cubrid_db
+from cubrid_db.cursors import LazyCursor
+
+
+ROWS = 99
+
+
+@pytest.fixture
+def lazy_cursor(cubrid_db_connection, fetchmany_table):
+    cur = cubrid_db_connection.cursor(lazy=True)
+    cur.execute(f'select id, name from {fetchmany_table} order by id')
+    yield cur
+    cur.close()
+
+
+def test_lazy_cursor_class(cubrid_db_connection):
+    assert isinstance(cubrid_db_connection.cursor(lazy=True), LazyCursor)
+    with pytest.raises(cubrid_db.InterfaceError):
+        cubrid_db_connection.cursor(stream=True, lazy=True)
+
+
+def test_lazy_rows(lazy_cursor):
+    row = lazy_cursor.fetchone()
+    assert isinstance(row, _cubrid.LazyRow)
+    assert len(row) == 2 and row.keys() == ['id', 'name']
+    assert row['name'] == row[1] == row[-1] == 'myName-1'
+    assert row[:] == tuple(row) == row.values() == (1, 'myName-1')
+    assert row == (1, 'myName-1')
+    with pytest.raises(IndexError):
+        row[2]  # pylint: disable=pointless-statement
+    with pytest.raises(KeyError):
+        row['missing']  # pylint: disable=pointless-statement
+
+
+def test_lazy_rows_read_out_of_order(lazy_cursor):
+    rows = lazy_cursor.fetchmany(50)
+    # Reading old rows must not move the cursor of the next fetch
+    assert rows[40][1] == 'myName-41'
+    assert rows[0][1] == 'myName-1'
+    assert lazy_cursor.fetchone()[1] == 'myName-51'
+    rest = lazy_cursor.fetchall()
+    assert rows[10]['name'] == 'myName-11'
+    assert [row[1] for row in rest] == [f'myName-{i}' for i in range(52, ROWS + 1)]
+    assert lazy_cursor.fetchone() is None
+
+
+def test_lazy_rows_after_execute(lazy_cursor, fetchmany_table):
+    row = lazy_cursor.fetchone()
+    assert row[0] == 1
+    lazy_cursor.execute(f'select id from {fetchmany_table}')
+    # Values read before stay available, the others are gone
+    assert row[0] == 1
+    with pytest.raises(cubrid_db.InterfaceError):
+        row[1]  # pylint: disable=pointless-statement
+
+
+def test_fetch_columns_projection(cubrid_db_connection, fetchmany_table):
+    cur = cubrid_db_connection.cursor(row_cursor=True)
+    cur.execute(f'select id, name from {fetchmany_table} order by id')
+
+    rows = cur.fetch(3, columns=['name'])
+    assert [tuple(row) for row in rows] == [('myName-1',), ('myName-2',), ('myName-3',)]
+    assert rows[0]['name'] == 'myName-1'
+    assert cur.fetch(1, columns=[1, 0]) == [('myName-4', 4)]
+    assert len(cur.fetch()) == ROWS - 4
+
+    with pytest.raises(cubrid_db.ProgrammingError):
+        cur.fetch(columns=['missing'])
+    with pytest.raises(IndexError):
+        cur.fetch(columns=[2])
+    cur.close()
+
+
+def test_lazy_rows_after_end(lazy_cursor):
+    rows = list(iter(lazy_cursor.fetchone, None))
+    assert len(rows) == ROWS
+    # The cursor is past the end: the rows are read again from the server
+    assert rows[0]['name'] == 'myName-1'
+    assert [row[1] for row in rows[-3:]] == [f'myName-{i}' for i in range(ROWS - 2, ROWS + 1)]
+    assert lazy_cursor.fetchone() is None
+
+
+def test_lazy_rows_after_fetch_block(lazy_cursor):
+    # pylint: disable=protected-access
+    rows = lazy_cursor.fetchmany(10)
+    # fetch_block releases the fetch buffer, the lazy rows fetch again
+    assert lazy_cursor._cs.fetch_block(10) == [
+        (i, f'myName-{i}') for i in range(11, 21)]
+    assert rows[4]['name'] == 'myName-5'
+    assert lazy_cursor.fetchone()[0] == 21
+    with pytest.raises(cubrid_db.InterfaceError):
+        lazy_cursor._cs.fetch_block(10, 3)
@@ -0,0 +1,142 @@
+# pylint: disable=missing-function-docstring,missing-module-docstring
+import io
+import os
+import shutil
+
+import pytest
+
+import _cubrid
+from cubrid_db.lob import LobIO
+
+
+LOGO = os.path.join(os.path.dirname(__file__), 'cubrid_logo.png')
+
+
+@pytest.fixture
+def lob_table(cubrid_cursor):
+    cur, _ = cubrid_cursor
+    cur.prepare('drop table if exists test_lob')
+    cur.execute()
+    cur.prepare('create table test_lob (picture blob)')
+    cur.execute()
+    yield cubrid_cursor
+    cur.prepare('drop table if exists test_lob')
+    cur.execute()
+
+
+def _store(cur, con, src, chunk_size=None):
+    lob = con.lob()
+    if chunk_size is not None:
+        lob.chunk_size = chunk_size
+    size = lob.imports(src)
+    cur.prepare('insert into test_lob values (?)')
+    cur.bind_lob(1, lob)
+    cur.execute()
+    lob.close()
+    return size
+
+
+def _fetch(cur, con):
+    cur.prepare('select * from test_lob')
+    cur.execute()
+    lob = con.lob()
+    cur.fetch_lob(1, lob)
+    return lob
+
+
+def _logo_bytes():
+    with open(LOGO, 'rb') as f:
+        return f.read()
+
+
+def test_chunk_size(cubrid_connection):
+    lob = cubrid_connection.lob()
+    assert lob.chunk_size == 1024 * 1024
+    lob.chunk_size = 100
+    assert lob.chunk_size == 100
+    with pytest.raises(_cubrid.InterfaceError):
+        lob.chunk_size = 0
+
+
+def test_import_small_chunks(lob_table):
+    cur, con = lob_table
+    data = _logo_bytes()
+
+    assert _store(cur, con, LOGO, chunk_size=100) == len(data)
+
+    lob = _fetch(cur, con)
+    lob.chunk_size = 77
+    assert lob.size() == len(data)
+    out = bytearray(len(data))
+    assert lob.export(out) == len(data)
+    assert out == data
+    lob.close()
+
+
+def test_import_memoryview(lob_table):
+    cur, con = lob_table
+    data = os.urandom(300000)
+
+    assert _store(cur, con, memoryview(data)) == len(data)
+
+    lob = _fetch(cur, con)
+    buf = bytearray(1000)
+    assert lob.readinto(buf) == 1000
+    assert buf == data[:1000]
+    assert lob.readinto(memoryview(buf)[:10]) == 10
+    assert buf[:10] == data[1000:1010]
+    lob.close()
+
+
+def test_import_export_file_objects(lob_table):
+    cur, con = lob_table
+    data = _logo_bytes()
+
+    with open(LOGO, 'rb') as f:
+        assert _store(cur, con, f, chunk_size=1000) == len(data)
+
+    lob = _fetch(cur, con)
+    out = io.BytesIO()
+    assert lob.export(out) == len(data)
+    assert out.getvalue() == data
+    lob.close()
+
+
+def test_readinto_end(lob_table):
+    cur, con = lob_table
+    _store(cur, con, b'0123456789')
+
+    lob = _fetch(cur, con)
+    buf = bytearray(8)
+    assert lob.readinto(buf) == 8
+    assert lob.readinto(buf) == 2
+    assert buf[:2] == b'89'
+    assert lob.readinto(buf) == 0
+    lob.close()
+
+
+def test_lob_io(lob_table):
+    cur, con = lob_table
+    data = _logo_bytes()
+    _store(cur, con, LOGO)
+
+    with LobIO(_fetch(cur, con), chunk_size=4096) as src:
+        assert src.readable() and src.seekable()
+        assert src.size() == len(data)
+        assert src.read(16) == data[:16]
+        assert src.tell() == 16
+        assert src.seek(-6, io.SEEK_END) == len(data) - 6
+        assert src.read() == data[-6:]
+        assert src.read(1) == b''
+
+        src.seek(0)
+        out = io.BytesIO()
+        shutil.copyfileobj(src, out, 1000)
+        assert out.getvalue() == data
+
+        src.seek(0)
+        assert io.BufferedReader(src).read() == data
+
+    assert src.closed
+    with pytest.raises(ValueError):
+        src.read(1)
@@ -0,0 +1,106 @@
+# pylint: disable=missing-function-docstring,missing-module-docstring
+import time
+
+import pytest
+
+import _cubrid
+from conftest import (
+    TABLE_PREFIX,
+    _get_connect_args,
+)
+
+import cubrid_db
+
+
+@pytest.fixture
+def cached_conn():
+    conn = cubrid_db.connect(meta_cache_ttl=60, **_get_connect_args())
+    yield conn
+    conn.close()
+
+
+@pytest.fixture
+def meta_table(cached_conn):
+    cur = cached_conn.cursor()
+    table_name = f'{TABLE_PREFIX}meta_cache'
+    cur.execute(f'drop table if exists {table_name}')
+    cur.execute(f'create table {table_name} (a int, b varchar(10))')
+    yield table_name
+    cur.execute(f'drop table if exists {table_name}')
+    cur.close()
+
+
+def test_meta_cache_schema_info(cached_conn, meta_table):
+    before = cached_conn.meta_cache_stats()
+
+    first = cached_conn.schema_info(_cubrid.CUBRID_SCH_ATTRIBUTE, meta_table, 'b')
+    first.append('changed by the caller')
+    second = cached_conn.schema_info(_cubrid.CUBRID_SCH_ATTRIBUTE, meta_table, 'b')
+
+    stats = cached_conn.meta_cache_stats()
+    assert stats['ttl'] == 60
+    assert stats['misses'] - before['misses'] == 1
+    assert stats['hits'] - before['hits'] == 1
+    assert second[0] == 'b' and second == first[:-1]
+
+
+def test_meta_cache_cleared_by_ddl(cached_conn, meta_table):
+    cur = cached_conn.cursor()
+    assert cached_conn.schema_info(_cubrid.CUBRID_SCH_ATTRIBUTE, meta_table, 'c') is None
+
+    cur.execute(f'alter table {meta_table} add column c int')
+    assert cached_conn.schema_info(_cubrid.CUBRID_SCH_ATTRIBUTE, meta_table, 'c')[0] == 'c'
+
+    cur.execute(f'select * from {meta_table}')
+    assert [d[0] for d in cur.description] == ['a', 'b', 'c']
+    cur.execute(f'alter table {meta_table} drop column c')
+    cur.execute(f'select * from {meta_table}')
+    assert [d[0] for d in cur.description] == ['a', 'b']
+    cur.close()
+
+
+def test_meta_cache_descriptions(cached_conn, meta_table):
+    sql = f'select a, b from {meta_table}'
+    cur = cached_conn.cursor()
+    cur.execute(sql)
+    description = cur.description
+    cur.close()
+
+    hits = cached_conn.meta_cache_stats()['hits']
+    cur = cached_conn.cursor()
+    cur.execute(sql)
+    assert cur.description is description
+    assert cached_conn.meta_cache_stats()['hits'] == hits + 1
+    cur.close()
+
+
+def test_meta_cache_ttl(meta_table):
+    conn = cubrid_db.connect(meta_cache_ttl=0.2, **_get_connect_args())
+    try:
+        conn.schema_info(_cubrid.CUBRID_SCH_TABLE, meta_table)
+        time.sleep(0.3)
+        conn.schema_info(_cubrid.CUBRID_SCH_TABLE, meta_table)
+        assert conn.meta_cache_stats()['hits'] == 0
+    finally:
+        conn.close()
+
+
+def test_shared_meta_cache(meta_table):
+    first = cubrid_db.connect(meta_cache_ttl=60, shared_meta_cache=True, **_get_connect_args())
+    second = cubrid_db.connect(meta_cache_ttl=60, shared_meta_cache=True, **_get_connect_args())
+    try:
+        first.schema_info(_cubrid.CUBRID_SCH_TABLE, meta_table)
+        second.schema_info(_cubrid.CUBRID_SCH_TABLE, meta_table)
+        assert second.meta_cache_stats()['hits'] == 1
+
+        # DDL through one connection clears the cache of both
+        cur = first.cursor()
+        cur.execute(f'create index {meta_table}_a on {meta_table} (a)')
+        cur.close()
+        second.schema_info(_cubrid.CUBRID_SCH_TABLE, meta_table)
+        assert second.meta_cache_stats()['hits'] == 1
+        with pytest.raises(TypeError):
+            first.connection.set_meta_cache([])
+    finally:
+        first.close()
+        second.close()
@@ -0,0 +1,102 @@
+# pylint: disable=missing-function-docstring,missing-module-docstring
+import struct
+import time
+
+import pytest
+
+from conftest import _create_table, _drop_table, _get_connect_args
+
+import cubrid_db
+from cubrid_db import parallel
+from cubrid_db.pool import ConnectionPool
+
+
+ROWS = 1000
+
+
+@pytest.fixture
+def pool():
+    p = ConnectionPool(maxsize=4, timeout=5, **_get_connect_args())
+    yield p
+    p.close()
+
+
+@pytest.fixture
+def parallel_table(cubrid_db_cursor):
+    cur, con = cubrid_db_cursor
+    table_name = _create_table(cubrid_db_cursor, 'parallel', 'id int, name varchar(20)')
+    cur.executemany(f'insert into {table_name} values (?, ?)',
+                    [(i, None if i % 10 == 0 else f'n{i}') for i in range(ROWS)])
+    con.commit()
+    yield table_name
+    _drop_table(cubrid_db_cursor, table_name)
+
+
+def test_partitions():
+    assert parallel.ranges('id', [10, 20]) == [
+        ('id < ?', (10,)), ('id >= ? and id < ?', (10, 20)), ('id >= ?', (20,))]
+    assert parallel.modulo('id', 2) == [('mod(id, 2) = ?', (0,)), ('mod(id, 2) = ?', (1,))]
+    with pytest.raises(ValueError):
+        parallel.modulo('id', 0)
+
+    # pylint: disable=protected-access
+    sql, params = parallel._partition_sql(
+        'select * from t where a = ? and {partition} and b = ?', 'id < ?', (1, 2), (10,))
+    assert sql == 'select * from t where a = ? and (id < ?) and b = ?'
+    assert params == (1, 10, 2)
+    with pytest.raises(cubrid_db.InterfaceError):
+        parallel._partition_sql('select * from t', 'id < ?', (), (10,))
+
+
+def test_concat_columns():
+    first = [('i', bytearray(struct.pack('3i', 1, 2, 3)), bytearray([0b101]), None),
+             ('U', bytearray(b'abcd'), None, bytearray(struct.pack('4q', 0, 1, 3, 4)))]
+    second = [('i', bytearray(struct.pack('2i', 4, 5)), None, None),
+              ('U', bytearray(b'ef'), bytearray([0b10]), bytearray(struct.pack('3q', 0, 0, 2)))]
+
+    ids, names = parallel.concat_columns([first, [], second])
+
+    assert ids[0] == 'i' and struct.unpack('5i', ids[1]) == (1, 2, 3, 4, 5)
+    assert ids[2] == bytearray([0b11101]) and ids[3] is None
+    assert names[1] == b'abcdef' and names[2] == bytearray([0b10111])
+    assert struct.unpack('6q', names[3]) == (0, 1, 3, 4, 4, 6)
+
+
+def test_parallel_query(pool, parallel_table):
+    rows = parallel.query(pool, f'select id, name from {parallel_table} where {{partition}}'
+                          ' and id >= ? order by id', parallel.modulo('id', 4), params=(100,))
+
+    assert len(rows) == ROWS - 100
+    assert sorted(rows) == [(i, None if i % 10 == 0 else f'n{i}') for i in range(100, ROWS)]
+    # Partition order: all ids = 0 mod 4 come first
+    assert all(row[0] % 4 == 0 for row in rows[:len(rows) // 4])
+
+
+def test_parallel_query_columns(pool, parallel_table):
+    ids, names = parallel.query(
+        pool, f'select id, name from {parallel_table} where {{partition}} order by id',
+        parallel.ranges('id', [250, 500, 750]), max_workers=2, columns=True)
+
+    assert ids[0] == 'i'
+    assert list(struct.unpack(f'{ROWS}i', ids[1])) == list(range(ROWS))
+    assert names[0] == 'U' and len(names[3]) == (ROWS + 1) * 8
+    validity = int.from_bytes(names[2], 'little')
+    assert all(bool(validity >> i & 1) == (i % 10 != 0) for i in range(ROWS))
+
+
+def test_parallel_query_error(pool, parallel_table):
+    partitions = parallel.modulo('id', 8) + [('no_such_column = ?', (1,))]
+    with pytest.raises(cubrid_db.Error):
+        parallel.query(pool, f'select id from {parallel_table} where {{partition}}',
+                       partitions, max_workers=2)
+    assert pool.stats()['in_use'] == 0
+
+
+def test_parallel_query_error_cancels(pool):
+    # The failing partition cancels the statement of the sleeping one
+    partitions = [('sleep(30) = 0', ()), ('no_such_column = ?', (1,))]
+    start = time.monotonic()
+    with pytest.raises(cubrid_db.Error):
+        parallel.query(pool, 'select 1 from db_root where {partition}', partitions)
+    assert time.monotonic() - start < 20
+    assert pool.stats()['in_use'] == 0
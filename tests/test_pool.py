@@ -0,0 +1,114 @@
+# pylint: disable=missing-function-docstring,missing-module-docstring
+import threading
+
+import pytest
+
+import _cubrid
+from conftest import _get_connect_args
+
+import cubrid_db
+from cubrid_db.pool import ConnectionPool, PoolTimeoutError
+
+
+@pytest.fixture
+def pool():
+    p = ConnectionPool(minsize=1, maxsize=2, timeout=5, **_get_connect_args())
+    yield p
+    p.close()
+
+
+def test_pool_reuses_connections(pool):
+    with pool.connection() as conn:
+        first = conn.connection
+        cur = conn.cursor()
+        cur.execute('select 1 + 1 from db_root')
+        assert cur.fetchone() == (2,)
+        cur.close()
+
+    with pool.connection() as conn:
+        assert conn.connection is first
+
+    stats = pool.stats()
+    assert stats['created'] == 1
+    assert stats['acquired'] == 2
+    assert stats['size'] == stats['idle'] == 1
+
+
+def test_pool_closed_connection_is_unusable(pool):
+    conn = pool.acquire()
+    conn.close()
+    with pytest.raises(cubrid_db.InterfaceError):
+        conn.cursor()
+
+
+def test_pool_resets_on_return(pool):
+    with pool.connection() as conn:
+        conn.set_autocommit(False)
+        conn.connection.set_isolation_level(_cubrid.CUBRID_SERIALIZABLE)
+        level = conn.connection.isolation_level
+
+    with pool.connection() as conn:
+        assert conn.autocommit is True
+        assert conn.connection.isolation_level != level
+
+
+def test_pool_timeout(pool):
+    a = pool.acquire()
+    b = pool.acquire()
+    with pytest.raises(PoolTimeoutError):
+        pool.acquire(timeout=0.1)
+    assert pool.stats()['timeouts'] == 1
+    a.close()
+    b.close()
+
+
+
+def test_pool_acquire_without_timeout():
+    p = ConnectionPool(maxsize=1, timeout=0.1, **_get_connect_args())
+    held = p.acquire()
+    timer = threading.Timer(0.5, held.close)
+    timer.start()
+    try:
+        # An explicit None waits past the pool timeout
+        with p.acquire(timeout=None) as conn:
+            assert conn.ping()
+    finally:
+        timer.join()
+        p.close()
+    assert p.stats()['timeouts'] == 0
+
+def test_pool_waiters_are_served(pool):
+    held = [pool.acquire(), pool.acquire()]
+    got = []
+
+    def borrow():
+        with pool.connection(timeout=5) as conn:
+            got.append(conn.ping())
+
+    threads = [threading.Thread(target=borrow) for _ in range(4)]
+    for t in threads:
+        t.start()
+    for conn in held:
+        conn.close()
+    for t in threads:
+        t.join()
+
+    assert got == [1] * 4
+    stats = pool.stats()
+    assert stats['size'] <= 2
+    assert stats['waiting'] == 0
+
+
+def test_pool_replaces_dead_connection(pool):
+    with pool.connection() as conn:
+        raw = conn.connection
+    raw.close()
+
+    with pool.connection() as conn:
+        assert conn.ping() == 1
+    assert pool.stats()['ping_failures'] == 1
+
+
+def test_pool_invalid_sizes():
+    with pytest.raises(ValueError):
+        ConnectionPool(minsize=3, maxsize=2)
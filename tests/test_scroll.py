@@ -0,0 +1,81 @@
+# pylint: disable=missing-function-docstring,missing-module-docstring
+import pytest
+
+import cubrid_db
+from cubrid_db.cursors import ScrollCursor, ScrollDictCursor, ScrollRowCursor
+
+
+ROWS = 99
+
+
+@pytest.fixture
+def scroll_cursor(cubrid_db_connection, fetchmany_table):
+    cur = cubrid_db_connection.cursor(scroll=True)
+    cur.block_size = 10
+    cur.execute(f'select id, name from {fetchmany_table} order by id')
+    yield cur
+    cur.close()
+
+
+def test_scroll_cursor_classes(cubrid_db_connection):
+    assert isinstance(cubrid_db_connection.cursor(scroll=True), ScrollCursor)
+    assert isinstance(cubrid_db_connection.cursor(True, scroll=True), ScrollDictCursor)
+    assert isinstance(cubrid_db_connection.cursor(row_cursor=True, scroll=True),
+                      ScrollRowCursor)
+    with pytest.raises(cubrid_db.InterfaceError):
+        cubrid_db_connection.cursor(stream=True, scroll=True)
+
+
+def test_scroll_fetch(scroll_cursor):
+    assert scroll_cursor.rowcount == ROWS
+    assert scroll_cursor.fetchone()[1] == 'myName-1'
+    rows = scroll_cursor.fetchmany(25)
+    assert [row[1] for row in rows] == [f'myName-{i}' for i in range(2, 27)]
+    assert scroll_cursor.rownumber == 26
+    assert len(scroll_cursor.fetchall()) == ROWS - 26
+    assert scroll_cursor.fetchone() is None
+
+
+def test_scroll_back_is_cached(scroll_cursor):
+    first = scroll_cursor.fetchmany(30)
+    misses = scroll_cursor.cache_stats()['misses']
+
+    scroll_cursor.scroll(0, mode='absolute')
+    assert scroll_cursor.fetchmany(30) == first
+    scroll_cursor.scroll(-15)
+    assert scroll_cursor.fetchone() == first[15]
+
+    stats = scroll_cursor.cache_stats()
+    assert stats['misses'] == misses == 3
+    assert stats['hits'] >= 4 and stats['blocks'] == 3
+
+
+def test_scroll_cache_budget(scroll_cursor):
+    scroll_cursor.cache_size = 1
+    scroll_cursor.fetchall()
+    assert scroll_cursor.cache_stats()['blocks'] == 1
+
+    scroll_cursor.scroll(0, mode='absolute')
+    assert int(scroll_cursor.fetchone()[0]) == 1
+    assert scroll_cursor.cache_stats()['misses'] == 11
+
+
+def test_scroll_out_of_range(scroll_cursor):
+    with pytest.raises(IndexError):
+        scroll_cursor.scroll(-1)
+    with pytest.raises(IndexError):
+        scroll_cursor.scroll(ROWS + 1, mode='absolute')
+    with pytest.raises(cubrid_db.ProgrammingError):
+        scroll_cursor.scroll(1, mode='sideways')
+
+    scroll_cursor.scroll(ROWS, mode='absolute')
+    assert scroll_cursor.fetchone() is None
+
+
+def test_scroll_block_size_change(scroll_cursor):
+    assert len(scroll_cursor.fetchmany(30)) == 30
+    # The cached blocks keep the size of the execute
+    scroll_cursor.block_size = 20
+    assert [int(row[0]) for row in scroll_cursor.fetchmany(5)] == list(range(31, 36))
+    scroll_cursor.scroll(10, mode='absolute')
+    assert int(scroll_cursor.fetchone()[0]) == 11
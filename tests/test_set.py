@@ -1,5 +1,13 @@
 # pylint: disable=missing-function-docstring,missing-module-docstring
-from conftest import TABLE_PREFIX
+from datetime import date, datetime
+from decimal import Decimal
+
+import pytest
+
+from conftest import TABLE_PREFIX, _get_connect_args
+
+import _cubrid
+import cubrid_db
 
 
 def _test_set_prepare(cur, columns_sql, samples, sample_size):
@@ -47,3 +55,96 @@ def test_set_prepare_bit(cubrid_db_cursor):
     samples = [((b'\x14', b'\x12\x90'),)]
     inserted = _test_set_prepare(cubrid_db_cursor[0], 'col_1 set(bit(16))', samples, 1)
     assert inserted == [({'1400', '1290'},)]
+
+
+@pytest.fixture
+def native_cursor():
+    conn = cubrid_db.connect(native_collections=True, **_get_connect_args())
+    cur = conn.cursor()
+    yield cur
+    cur.close()
+    conn.close()
+
+
+def test_set_native_int(native_cursor):
+    members = set(range(-5000, 5000))
+    inserted = _test_set_prepare(native_cursor, 'col_1 set(int)', [(members,)], 1)
+    assert inserted == [(members,)]
+
+
+def test_set_native_bigint_double(native_cursor):
+    samples = [({1, 2 ** 40}, [1.5, 2.0, None])]
+    inserted = _test_set_prepare(native_cursor,
+        'col_1 set(bigint), col_2 sequence(double)', samples, 2)
+    assert inserted == [({1, 2 ** 40}, [1.5, 2.0, None])]
+
+
+def test_set_native_temporal(native_cursor):
+    samples = [([date(2024, 2, 29), date(1999, 1, 1)],
+                [datetime(2024, 2, 29, 12, 30, 15, 250000)])]
+    inserted = _test_set_prepare(native_cursor,
+        'col_1 sequence(date), col_2 multiset(datetime)', samples, 2)
+    assert inserted == samples
+
+
+def test_set_native_mixed_temporal(native_cursor):
+    samples = [([date(2024, 2, 29), datetime(2024, 3, 1, 12, 0)],)]
+    inserted = _test_set_prepare(native_cursor,
+        'col_1 sequence(datetime)', samples, 1)
+    assert inserted == [([datetime(2024, 2, 29), datetime(2024, 3, 1, 12, 0)],)]
+
+
+def test_set_native_numeric_bit(native_cursor):
+    samples = [({Decimal('1.25'), Decimal('-3.50')}, {b'\x14\x00', b'\x12\x90'})]
+    inserted = _test_set_prepare(native_cursor,
+        'col_1 set(numeric(10,2)), col_2 set(bit(16))', samples, 2)
+    assert inserted == samples
+
+
+def test_set_native_strings(native_cursor):
+    samples = [(('abc', 'bcd'),)]
+    inserted = _test_set_prepare(native_cursor, 'col_1 set(varchar)', samples, 1)
+    assert inserted == [({'abc', 'bcd'},)]
+
+
+def test_set_import_values(cubrid_connection):
+    s = cubrid_connection.set()
+    s.imports([1, 2, 3], 0)
+    s.imports((1.0, 2), 0)
+    with pytest.raises(_cubrid.InterfaceError):
+        s.imports((1, 'a'), 0)
+    with pytest.raises(_cubrid.InterfaceError):
+        s.imports((object(),), 0)
+
+
+def test_set_bind_allocations(cubrid_db_cursor):
+    cur = cubrid_db_cursor[0]
+    table_name = f'{TABLE_PREFIX}set_allocs'
+    cur.execute(f'drop table if exists {table_name}')
+    try:
+        cur.execute(f"create table {table_name} (col_1 set(varchar))")
+        cur.execute(f"insert into {table_name} values (?)", (('a', 'b'),))
+        # The set import buffers are counted, unlike an arena that is reused
+        assert cur.allocations > 0
+        cur.execute(f"select count(*) from {table_name}")
+        assert cur.allocations == 0
+    finally:
+        cur.execute(f'drop table if exists {table_name}')
+
+
+def test_set_bind_allocations_per_cursor(cubrid_db_cursor):
+    cur, con = cubrid_db_cursor
+    table_name = f'{TABLE_PREFIX}set_allocs'
+    cur.execute(f'drop table if exists {table_name}')
+    other = con.cursor()
+    try:
+        cur.execute(f"create table {table_name} (col_1 set(varchar))")
+        cur.execute(f"select count(*) from {table_name}")
+        other.execute(f"insert into {table_name} values (?)", (('a', 'b'),))
+        assert other.allocations > 0
+        # The set bound by the other cursor is not charged to this one
+        cur.execute(f"select count(*) from {table_name}")
+        assert cur.allocations == 0
+    finally:
+        other.close()
+        cur.execute(f'drop table if exists {table_name}')
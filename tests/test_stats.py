@@ -0,0 +1,88 @@
+# pylint: disable=missing-function-docstring,missing-module-docstring
+import pytest
+
+from conftest import BOOZE_SAMPLES
+
+import cubrid_db
+
+
+STAT_KEYS = {
+    'prepare_count', 'prepare_time', 'execute_count', 'execute_time',
+    'fetch_calls', 'fetch_time', 'convert_time', 'rows_fetched',
+    'bytes_converted', 'bind_count',
+}
+
+
+def test_stats_disabled(cubrid_db_cursor, populated_booze_table):
+    cur, con = cubrid_db_cursor
+    con.reset_stats()
+
+    cur.execute(f'select name from {populated_booze_table}')
+    cur.fetchall()
+
+    stats = con.stats()
+    assert set(stats) == STAT_KEYS
+    assert all(value == 0 for value in stats.values())
+
+
+def test_stats(cubrid_db_cursor, populated_booze_table):
+    cur, con = cubrid_db_cursor
+    con.reset_stats()
+    con.collect_stats = True
+
+    cur.execute(f'select name from {populated_booze_table} where name <> ?', ('x',))
+    assert cur.fetchone() is not None
+    assert len(cur.fetchall()) == len(BOOZE_SAMPLES) - 1
+
+    stats = con.stats()
+    assert stats['prepare_count'] == 1
+    assert stats['execute_count'] == 1
+    assert stats['bind_count'] == 1
+    assert stats['fetch_calls'] == 2
+    assert stats['rows_fetched'] == len(BOOZE_SAMPLES)
+    assert stats['bytes_converted'] >= sum(len(s) for s in BOOZE_SAMPLES)
+    assert stats['execute_time'] > 0
+    assert 0 < stats['convert_time'] <= stats['fetch_time']
+
+    con.reset_stats()
+    assert con.stats()['execute_count'] == 0
+
+
+def test_trace_callback(cubrid_db_cursor, booze_table):
+    cur, con = cubrid_db_cursor
+    con.reset_stats()
+    calls = []
+    con.set_trace_callback(lambda sql, elapsed, rowcount: calls.append((sql, elapsed, rowcount)))
+
+    try:
+        insert = f"insert into {booze_table} values ('Tooheys')"
+        cur.execute(insert)
+        with pytest.raises(cubrid_db.Error):
+            cur.execute(f"insert into {booze_table} values (1, 2, 3)")
+    finally:
+        con.set_trace_callback(None)
+    cur.execute(f"select * from {booze_table}")
+
+    assert len(calls) == 2
+    assert calls[0][0] == insert and calls[0][1] >= 0 and calls[0][2] == 1
+    assert calls[1][2] == -1
+    # Tracing alone does not count
+    assert all(value == 0 for value in con.stats().values())
+
+
+def test_trace_callback_error(cubrid_db_cursor, booze_table):
+    cur, con = cubrid_db_cursor
+
+    def callback(sql, elapsed, rowcount):
+        raise RuntimeError('tracing failed')
+
+    con.set_trace_callback(callback)
+    try:
+        with pytest.warns(pytest.PytestUnraisableExceptionWarning):
+            cur.execute(f"insert into {booze_table} values ('Tooheys')")
+        assert cur.rowcount == 1
+    finally:
+        con.set_trace_callback(None)
+
+    with pytest.raises(TypeError):
+        con.set_trace_callback(42)
@@ -0,0 +1,159 @@
+# pylint: disable=missing-function-docstring,missing-module-docstring
+import pytest
+
+from conftest import (
+    TABLE_PREFIX,
+    _get_connect_args,
+)
+
+import cubrid_db
+
+
+@pytest.fixture
+def cached_cursor():
+    conn = cubrid_db.connect(stmt_cache_size=2, **_get_connect_args())
+    cur = conn.cursor()
+    yield cur, conn
+    cur.close()
+    conn.close()
+
+
+@pytest.fixture
+def cache_table(cached_cursor):
+    cur, _ = cached_cursor
+    table_name = f'{TABLE_PREFIX}stmt_cache'
+    cur.execute(f'drop table if exists {table_name}')
+    cur.execute(f'create table {table_name} (a int, b varchar(10))')
+    yield table_name
+    cur.execute(f'drop table if exists {table_name}')
+
+
+def test_stmt_cache_hits(cached_cursor, cache_table):
+    cur, conn = cached_cursor
+    before = conn.stmt_cache_stats()
+
+    for i in range(5):
+        cur.execute(f'insert into {cache_table} values (?, ?)', (i, str(i)))
+
+    stats = conn.stmt_cache_stats()
+    assert stats['hits'] - before['hits'] == 4
+    assert stats['misses'] - before['misses'] == 1
+
+    cur.execute(f'select count(*) from {cache_table}')
+    assert cur.fetchone() == (5,)
+
+
+def test_stmt_cache_rebinds_null(cached_cursor, cache_table):
+    cur, _ = cached_cursor
+    sql = f'insert into {cache_table} values (?, ?)'
+
+    cur.execute(sql, (1, 'x'))
+    cur.execute(sql, (2, None))
+
+    cur.execute(f'select b from {cache_table} where a = 2')
+    assert cur.fetchone() == (None,)
+
+
+def test_stmt_cache_select_reuse(cached_cursor, cache_table):
+    cur, conn = cached_cursor
+    cur.execute(f'insert into {cache_table} values (1, ?)', ('one',))
+    sql = f'select b from {cache_table} where a = ?'
+
+    for _ in range(3):
+        cur.execute(sql, (1,))
+        assert cur.fetchall() == [('one',)]
+
+    # Two cursors never share a cached handle
+    other = conn.cursor()
+    other.execute(sql, (1,))
+    cur.execute(sql, (1,))
+    assert other.fetchall() == [('one',)]
+    assert cur.fetchall() == [('one',)]
+    other.close()
+
+
+def test_stmt_cache_eviction(cached_cursor):
+    cur, conn = cached_cursor
+    before = conn.stmt_cache_stats()
+
+    for n in (1, 2, 3, 1):
+        cur.execute(f'select {n} from db_root')
+        assert cur.fetchone() == (n,)
+
+    # select 1 was evicted by select 3, so every prepare missed
+    stats = conn.stmt_cache_stats()
+    assert stats['hits'] == before['hits']
+
+
+def test_stmt_cache_eviction_description(cached_cursor, cache_table):
+    cur, conn = cached_cursor
+    other = conn.cursor()
+    cur.execute(f'insert into {cache_table} values (1, ?)', ('one',))
+    cur.execute(f'select a from {cache_table}')
+    assert [d[0] for d in cur.description] == ['a']
+
+    # Overflow the cache: the evicted handles are closed on the server,
+    # and their ids can come back for other statements
+    for n in range(5):
+        other.execute(f'select b, {n} from {cache_table}')
+        other.execute(f'select b from {cache_table}')
+    other.close()
+
+    cur.execute(f'select b from {cache_table}')
+    assert [d[0] for d in cur.description] == ['b']
+    assert cur.fetchone() == ('one',)
+    cur.execute(f'select a, b from {cache_table}')
+    assert [d[0] for d in cur.description] == ['a', 'b']
+    assert cur.fetchone() == (1, 'one')
+
+
+def test_stmt_cache_invalidated_by_ddl(cached_cursor, cache_table):
+    cur, conn = cached_cursor
+    sql = f'select * from {cache_table}'
+
+    cur.execute(sql)
+    assert cur.description is not None and len(cur.description) == 2
+    cur.execute(f'alter table {cache_table} add column c int')
+
+    misses = conn.stmt_cache_stats()['misses']
+    cur.execute(sql)
+    assert len(cur.description) == 3
+    assert conn.stmt_cache_stats()['misses'] == misses + 1
+
+
+def test_stmt_cache_rollback(cached_cursor, cache_table):
+    cur, conn = cached_cursor
+    sql = f'select count(*) from {cache_table}'
+    cur.execute(sql)
+    cur.fetchone()
+
+    conn.rollback()
+    misses = conn.stmt_cache_stats()['misses']
+    cur.execute(sql)
+    assert cur.fetchone() == (0,)
+    assert conn.stmt_cache_stats()['misses'] == misses + 1
+
+
+def test_stmt_cache_disabled(cubrid_db_cursor):
+    cur, conn = cubrid_db_cursor
+    for _ in range(3):
+        cur.execute('select 1 from db_root')
+    assert conn.stmt_cache_stats() == {'size': 0, 'hits': 0, 'misses': 0}
+
+
+def test_stmt_cache_query_timeout(cached_cursor):
+    cur, conn = cached_cursor
+    sql = 'select sleep(?) from db_root'
+    cur.query_timeout = 0.5
+    cur.execute(sql, (0,))
+    cur.fetchall()
+    cur.close()
+
+    # The cached handle gets the connection default back, not 0.5 s
+    other = conn.cursor()
+    try:
+        other.execute(sql, (1,))
+        assert len(other.fetchall()) == 1
+        assert conn.stmt_cache_stats()['hits'] == 1
+    finally:
+        other.close()
@@ -0,0 +1,92 @@
+# pylint: disable=missing-function-docstring,missing-module-docstring
+import pytest
+
+import cubrid_db
+from cubrid_db.cursors import StreamCursor, StreamDictCursor, StreamRowCursor
+
+
+ROWS = 99
+
+
+@pytest.fixture
+def stream_cursor(cubrid_db_connection, fetchmany_table):
+    cur = cubrid_db_connection.cursor(stream=True)
+    cur.block_size = 10
+    cur.execute(f'select id, name from {fetchmany_table} order by id')
+    yield cur
+    cur.close()
+
+
+def test_stream_cursor_classes(cubrid_db_connection):
+    assert isinstance(cubrid_db_connection.cursor(stream=True), StreamCursor)
+    assert isinstance(cubrid_db_connection.cursor(True, stream=True), StreamDictCursor)
+    assert isinstance(cubrid_db_connection.cursor(row_cursor=True, stream=True),
+                      StreamRowCursor)
+
+
+def test_stream_iterate(stream_cursor):
+    assert stream_cursor.rowcount == ROWS
+    ids = [int(row[0]) for row in stream_cursor]
+    assert ids == list(range(1, ROWS + 1))
+    assert stream_cursor.fetchone() is None
+
+
+def test_stream_block_bound(cubrid_db_connection, stream_cursor):
+    con = cubrid_db_connection
+    con.reset_stats()
+    con.collect_stats = True
+    it = iter(stream_cursor)
+    for _ in range(15):
+        next(it)
+    # The bound is in rows: only the two blocks holding the rows read
+    # came from the server
+    stats = con.stats()
+    assert stats['fetch_calls'] == 2
+    assert stats['rows_fetched'] == 20
+
+
+def test_stream_mixed_fetch(stream_cursor):
+    assert stream_cursor.fetchone()[1] == 'myName-1'
+    rows = stream_cursor.fetchmany(25)
+    assert [row[1] for row in rows] == [f'myName-{i}' for i in range(2, 27)]
+    assert next(iter(stream_cursor))[1] == 'myName-27'
+    assert len(stream_cursor.fetchall()) == ROWS - 27
+    assert stream_cursor.fetchmany(5) == []
+
+
+def test_stream_reexecute(stream_cursor, fetchmany_table):
+    stream_cursor.fetchone()
+    stream_cursor.execute(f'select count(*) from {fetchmany_table}')
+    assert stream_cursor.fetchall() == [(ROWS,)]
+
+
+def test_stream_dict_cursor(cubrid_db_connection, fetchmany_table):
+    cur = cubrid_db_connection.cursor(dict_cursor=True, stream=True)
+    cur.block_size = 7
+    cur.execute(f'select name from {fetchmany_table} order by id')
+    names = [row['name'] for row in cur]
+    assert names == [f'myName-{i}' for i in range(1, ROWS + 1)]
+    cur.close()
+
+
+def test_stream_fetch_block(cubrid_cursor, fetchmany_table):
+    cur, _ = cubrid_cursor
+    cur.set_fetch_size(20)
+    cur.prepare(f'select id from {fetchmany_table} order by id')
+    cur.execute()
+    sizes = []
+    while True:
+        rows = cur.fetch_block(20)
+        if not rows:
+            break
+        sizes.append(len(rows))
+    assert sizes == [20, 20, 20, 20, 19]
+
+
+def test_stream_closed(cubrid_db_connection):
+    cur = cubrid_db_connection.cursor(stream=True)
+    cur.close()
+    with pytest.raises(cubrid_db.InterfaceError):
+        iter(cur)
+    with pytest.raises(cubrid_db.InterfaceError):
+        cur.fetchone()
@@ -0,0 +1,100 @@
+# pylint: disable=missing-function-docstring,missing-module-docstring
+import sys
+import sysconfig
+import threading
+import time
+
+import pytest
+
+from conftest import _get_connect_args
+
+import cubrid_db
+
+
+THREAD_COUNT = 4
+SLEEP_SECONDS = 1
+
+
+def _sleep_query(errors):
+    try:
+        con = cubrid_db.connect(**_get_connect_args())
+        cur = con.cursor()
+        cur.execute(f"select sleep({SLEEP_SECONDS})")
+        cur.fetchall()
+        cur.close()
+        con.close()
+    except cubrid_db.Error as e:
+        errors.append(e)
+
+
+def test_concurrent_queries_overlap():
+    # The extension releases the GIL while waiting on the server, so
+    # N threads running N blocking queries should overlap their waits
+    errors = []
+    threads = [threading.Thread(target=_sleep_query, args=(errors,))
+               for _ in range(THREAD_COUNT)]
+
+    start = time.monotonic()
+    for t in threads:
+        t.start()
+    for t in threads:
+        t.join()
+    elapsed = time.monotonic() - start
+
+    assert not errors
+    assert elapsed < THREAD_COUNT * SLEEP_SECONDS
+
+
+def test_shared_connection_threads(cubrid_db_connection):
+    errors = []
+
+    def worker():
+        try:
+            cur = cubrid_db_connection.cursor()
+            for _ in range(10):
+                cur.execute("select 1 + 1 from db_root")
+                assert cur.fetchone() == (2,)
+            cur.close()
+        except cubrid_db.Error as e:
+            errors.append(e)
+
+    threads = [threading.Thread(target=worker) for _ in range(THREAD_COUNT)]
+    for t in threads:
+        t.start()
+    for t in threads:
+        t.join()
+
+    assert not errors
+
+
+@pytest.mark.skipif(not sysconfig.get_config_var('Py_GIL_DISABLED'),
+                    reason='needs the free-threaded build')
+def test_free_threaded_gil_stays_disabled():
+    # Importing an extension that needs the GIL would enable it again
+    import _cubrid  # pylint: disable=import-outside-toplevel,unused-import
+    assert not sys._is_gil_enabled()  # pylint: disable=protected-access
+
+
+def test_shared_connection_cursors_fetch(cubrid_db_connection):
+    # Cursors of one connection fetching at the same time, which the
+    # free-threaded build runs truly in parallel
+    errors = []
+
+    def worker(n):
+        try:
+            cur = cubrid_db_connection.cursor()
+            for _ in range(20):
+                cur.execute("select ? + 0 from db_root", (n,))
+                assert cur.fetchall() == [(n,)]
+                assert cur.description[0][0] is not None
+            cur.close()
+        except (cubrid_db.Error, AssertionError) as e:
+            errors.append(e)
+
+    threads = [threading.Thread(target=worker, args=(n,)) for n in range(THREAD_COUNT)]
+    for t in threads:
+        t.start()
+    for t in threads:
+        t.join()
+
+    assert not errors